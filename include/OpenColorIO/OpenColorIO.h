@@ -115,6 +115,48 @@ private:
 // restarting.
 extern OCIOEXPORT void ClearAllCaches();
 
+//!cpp:function:: Remove a file from the caches (e.g. the LUT file content and the file
+// modification time) so that it is read again the next time it is used. The path is the one
+// resolved by the context (refer to :cpp:func:`Context::resolveFileLocation`). Note that the
+// file lookups cached by the contexts are kept.
+extern OCIOEXPORT void ClearCachesForFile(const char * filepath);
+
+//!cpp:function:: Set the directory of the LUT store, an on-disk cache where the ops built from
+// the LUT files are saved in a binary form. The other processes using the same directory (e.g.
+// the render processes of a host) then read these files instead of parsing the LUT files again.
+// Only the parsing time is saved, the memory is not shared: each process still holds its own
+// copy of the op values and of the CPU renderer tables.
+// An empty path disables the LUT store, the default being the OCIO_LUT_STORE_DIR environment
+// variable. The directory must exist and is never cleaned up by OCIO.
+extern OCIOEXPORT void SetLutStoreDirectory(const char * dirname);
+
+//!cpp:function:: Watch the files used by the FileTransforms so that a file is removed from the
+// caches (refer to :cpp:func:`ClearCachesForFile`) as soon as it changes. The file system
+// notifications are used on Linux, the files being otherwise polled. The file watch is disabled
+// by default unless the OCIO_FILE_WATCH environment variable is set.
+extern OCIOEXPORT void SetFileWatchEnabled(bool enabled);
+//!cpp:function::
+extern OCIOEXPORT bool IsFileWatchEnabled();
+
+//!cpp:function:: The content of the files used by the FileTransforms is cached and the least
+// recently used files are removed when the estimated memory of the cached files exceeds a
+// limit. The default limit is 1 GB, it could be changed (in megabytes) using the
+// :envvar:`OCIO_FILE_CACHE_MAX_MEMORY` environment variable. The last loaded file is always
+// kept, even if it exceeds the limit on its own. Set the limit (in bytes) and return the
+// previous one.
+extern OCIOEXPORT size_t SetFileCacheMaxMemory(size_t maxMemory);
+
+//!cpp:function:: Get the number of files in the file cache, their estimated memory (in bytes)
+// and the number of cache hits & misses since the last :cpp:func:`ClearAllCaches`.
+extern OCIOEXPORT void GetFileCacheStats(size_t & numFiles, size_t & memory,
+                                         size_t & numHits, size_t & numMisses);
+
+//!cpp:function:: Identical LUT values (e.g. from several copies of the same LUT file, or
+// identical composed LUTs in several processors) are stored once for the whole process.
+// Get the number of distinct LUTs currently stored, the number of LUT ops using them and the
+// memory (in bytes) used by the LUT values.
+extern OCIOEXPORT void GetSharedLutStats(size_t & numLuts, size_t & numUsers, size_t & memory);
+
 //!cpp:function:: Get the version number for the library, as a
 // dot-delimited string (e.g., "1.0.0"). This is also available
 // at compile time as OCIO_VERSION.
@@ -225,6 +267,11 @@ public:
     static ConstConfigRcPtr CreateFromFile(const char * filename);
     //!cpp:function:: Create a configuration using a stream.
     static ConstConfigRcPtr CreateFromStream(std::istream & istream);
+    //!cpp:function:: Create a configuration using a binary snapshot file
+    // (see :cpp:func:`Config::writeSnapshot`).
+    static ConstConfigRcPtr CreateFromSnapshotFile(const char * filename);
+    //!cpp:function:: Create a configuration using a binary snapshot stream.
+    static ConstConfigRcPtr CreateFromSnapshot(std::istream & istream);
 
     //!cpp:function::
     ConfigRcPtr createEditableCopy() const;
@@ -268,6 +315,14 @@ public:
     // This is typically stored on disk in a file with the extension .ocio.
     void serialize(std::ostream & os) const;
 
+    //!cpp:function::
+    // Write a binary snapshot of the config (using the current context) which is much faster
+    // to load than the YAML text form.  The snapshot could also hold the already built ops
+    // of the referenced LUT files and their file hashes (see :cpp:type:`SnapshotFlags`).
+    // The transforms of a config loaded from a snapshot are lazily loaded, and the snapshot
+    // is only valid for the OCIO version that wrote it.
+    void writeSnapshot(std::ostream & os, SnapshotFlags flags) const;
+
     //!cpp:function::
     // This will produce a hash of the all colorspace definitions, etc.
     // All external references, such as files used in FileTransforms, etc.,
@@ -278,6 +333,8 @@ public:
     // If a context is not provided, the current Context will be used.
     // If a null context is provided, file references will not be taken into
     // account (this is essentially a hash of Config::serialize).
+    // The cacheIDs are computed again once the caches are cleared (refer to
+    // :cpp:func:`ClearAllCaches`), so the returned string is only valid until then.
     const char * getCacheID() const;
     //!cpp:function::
     const char * getCacheID(const ConstContextRcPtr & context) const;
@@ -720,6 +777,42 @@ public:
                                         const ConstTransformRcPtr& transform,
                                         TransformDirection direction) const;
 
+    //!rst:: Get the processor for the specified transform, incrementally rebuilt from a
+    // previous processor of this config (e.g. after a look or a CDL of an interactive grading
+    // session was edited).
+    //
+    // The ops of the FileTransform, ColorSpaceTransform and LookTransform (including the ones
+    // nested in a GroupTransform) which did not change since the previous processor are reused
+    // instead of being rebuilt.  The CPU processors also reuse the renderers of the ops which
+    // are still used by the CPU processors of the previous processor.  The result is identical
+    // to the one of the other getProcessor methods.
+    //
+    // Nothing is reused if the config (or the context) was modified or if the caches were
+    // cleared (refer to :cpp:func:`ClearAllCaches`) since the previous processor was built.
+
+    //!cpp:function::
+    ConstProcessorRcPtr getProcessor(const ConstProcessorRcPtr & previous,
+                                     const ConstContextRcPtr & context,
+                                     const ConstTransformRcPtr & transform,
+                                     TransformDirection direction) const;
+
+    //!cpp:function:: Read in parallel all the files referenced by the FileTransforms of the
+    // color spaces, looks and view transforms (resolved using the context, or the current
+    // context if null) so that they are already in the file cache when the processors are
+    // built.  The ops of a file are taken from the loaded config snapshot or from the LUT store
+    // (refer to :cpp:func:`SetLutStoreDirectory`) when available, instead of reading the file,
+    // and the LUT store is filled.  When buildDisplayViewProcessors is true, the processors of
+    // all the active display/view pairs (from the scene_linear role, or the default role) and
+    // their default CPU processors are then built in parallel to also warm up the other caches.
+    // The numThreads is the maximum number of threads used, zero meaning the number of cores.
+    //
+    // As it could take a while, an application could call it from a background thread at
+    // launch.  The errors (e.g. a missing file) are ignored here, they are reported when a
+    // processor using the file is built.
+    void preloadFiles(const ConstContextRcPtr & context,
+                      unsigned int numThreads,
+                      bool buildDisplayViewProcessors) const;
+
     //!rst: Get a processor to convert between color spaces in two separate configs.
 
     //!cpp:function:: This relies on both configs having the aces_interchange role (when srcName
@@ -2509,6 +2602,26 @@ public:
     // If the filename cannot be found, an exception will be thrown.
     const char * resolveFileLocation(const char * filename) const;
 
+    //!cpp:function:: The file lookups are cached, including the files not found, until the
+    // context is modified or all the caches are cleared (i.e. :cpp:func:`ClearAllCaches`, the
+    // lookups being kept by :cpp:func:`ClearCachesForFile`).
+    // Clear the cached lookups so that the search paths are walked again (e.g. after adding
+    // a file).
+    void clearFileLocationCache() const;
+    //!cpp:function:: Set the time (in seconds) after which a cached file lookup is done
+    // again. The default of 0 means that the cached file lookups never expire.
+    void setFileLocationCacheTimeout(double seconds);
+    //!cpp:function::
+    double getFileLocationCacheTimeout() const;
+
+    //!cpp:function:: When enabled, each search path directory is listed once and the file
+    // lookups are answered from the cached listings instead of querying each candidate file.
+    // That is faster for long search paths or network file systems. The default is disabled
+    // unless the OCIO_SEARCH_PATH_LISTING environment variable is set.
+    void setSearchPathListing(bool enabled);
+    //!cpp:function::
+    bool isSearchPathListingEnabled() const;
+
 private:
     Context();
     ~Context();
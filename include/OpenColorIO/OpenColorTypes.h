@@ -522,6 +522,23 @@ enum OptimizationFlags : unsigned long
     // finalization (e.g. ExposureContrast).
     OPTIMIZATION_NO_DYNAMIC_PROPERTIES           = 0x00020000,
 
+    // Select the accuracy of the log, exp and pow functions of the Log, Gamma and Exponent ops
+    // (CPU with SSE only).  By default, the polynomial approximations give about 15 bits of
+    // mantissa (the Exponent op always uses the standard library).  EXACT_MATH uses the
+    // standard library functions instead and FAST_MATH_PREVIEW, intended for interactive use,
+    // uses lower degree approximations giving about 10 bits.  FAST_MATH_PREVIEW takes
+    // precedence if both are set.  Note that GPU evals are not affected.
+    OPTIMIZATION_EXACT_MATH                      = 0x00040000,
+    OPTIMIZATION_FAST_MATH_PREVIEW               = 0x00080000,
+
+    // Allow the CPU renderer to use a compact approximation of the smooth half domain 1D LUTs
+    // (relative error below 1e-5, and the inputs above HALF_MAX are clamped to HALF_MAX).
+    OPTIMIZATION_LUT1D_APPROX                    = 0x00100000,
+
+    // Allow the CPU renderer to use a compact approximation of the large 3D LUTs (the relative
+    // error is below 1e-5 on the LUT entries but is not bounded between them).
+    OPTIMIZATION_LUT3D_APPROX                    = 0x00200000,
+
     // Apply all possible optimizations.
     OPTIMIZATION_ALL                             = 0xFFFFFFFF,
 
@@ -555,6 +572,26 @@ enum OptimizationFlags : unsigned long
     OPTIMIZATION_DEFAULT    = OPTIMIZATION_VERY_GOOD
 };
 
+//!cpp:type:: Provides control over the contents of a config snapshot
+//            (see :cpp:func:`Config::writeSnapshot`).
+enum SnapshotFlags : unsigned long
+{
+    // Only the config itself.
+    SNAPSHOT_CONFIG_ONLY = 0x00000000,
+
+    // The ops built from the LUT files referenced by the FileTransforms so that the files
+    // are not parsed when the snapshot is loaded.  The files are still queried to detect
+    // any change since the snapshot was written.
+    SNAPSHOT_FILE_OPS    = 0x00000001,
+
+    // The fast hashes (i.e. mtime & inode) of the referenced files.  Loading the snapshot
+    // then assumes that the files did not change (until :cpp:func:`ClearAllCaches` is called)
+    // so the file system is not queried at all.
+    SNAPSHOT_FILE_HASHES = 0x00000002,
+
+    SNAPSHOT_ALL         = (SNAPSHOT_FILE_OPS | SNAPSHOT_FILE_HASHES)
+};
+
 
 //!rst::
 // Conversion
@@ -679,6 +716,17 @@ extern OCIOEXPORT const char * OCIO_ACTIVE_VIEWS_ENVVAR;
 //    
 extern OCIOEXPORT const char * OCIO_INACTIVE_COLORSPACES_ENVVAR;
 
+//!rst::
+// .. c:var:: const char * OCIO_LAZY_LOADING_ENVVAR
+//
+//    When the envvar 'OCIO_LAZY_LOADING' is set to a value other than 0, the transforms of
+//    the color spaces, looks and view transforms are only built from the config file content
+//    on first access. It speeds up the config loading when only a few color spaces are used.
+//    Note that the errors in these transforms are then only reported on first access
+//    (e.g. when checking the config sanity or creating a processor).
+//    
+extern OCIOEXPORT const char * OCIO_LAZY_LOADING_ENVVAR;
+
 /*!rst::
 Roles
 *****
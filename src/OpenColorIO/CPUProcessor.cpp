@@ -1,6 +1,8 @@
 // SPDX-License-Identifier: BSD-3-Clause
 // Copyright Contributors to the OpenColorIO Project.
 
+#include <algorithm>
+#include <sstream>
 #include <string.h>
 
 #include <OpenColorIO/OpenColorIO.h>
@@ -11,6 +13,7 @@
 #include "ops/lut3d/Lut3DOpCPU.h"
 #include "ops/matrix/MatrixOp.h"
 #include "ops/range/RangeOpCPU.h"
+#include "OpVecCache.h"
 #include "ScanlineHelper.h"
 
 
@@ -119,6 +122,102 @@ case in:                                              \
     throw Exception("Unsupported bit-depths");
 }
 
+namespace
+{
+
+// Only the renderers of these ops can absorb a following range.
+bool CanFuseRange(const ConstOpDataRcPtr & opData)
+{
+    const OpData::Type type = opData->getType();
+    return type==OpData::MatrixType || type==OpData::Lut1DType || type==OpData::LogType;
+}
+
+ConstOpCPURcPtr CreateCPUOp(const ConstOpRcPtr & op, ConstRangeOpDataRcPtr & range)
+{
+    ConstOpCPURcPtr cpuOp = op->getCPUOp();
+    return range ? GetRangeFusedRenderer(cpuOp, range) : cpuOp;
+}
+
+ConstOpCPURcPtr GetCPUOp(const ConstOpRcPtr & op, ConstRangeOpDataRcPtr & range,
+                         OptimizationFlags oFlags, CPURendererCache * renderers)
+{
+    // The renderers of the dynamic ops are specific to a processor.
+    if (!renderers || op->isDynamic())
+    {
+        return CreateCPUOp(op, range);
+    }
+
+    // Some finalization settings (e.g. the math accuracy) are not part of the cache identifiers.
+    std::ostringstream oss;
+    oss << oFlags << " " << op->getCacheID();
+    if (range)
+    {
+        oss << " " << range->getCacheID();
+    }
+    const std::string key = oss.str();
+
+    ConstOpCPURcPtr cpuOp = renderers->get(key);
+    if (!cpuOp)
+    {
+        cpuOp = CreateCPUOp(op, range);
+        renderers->add(key, cpuOp);
+    }
+    return cpuOp;
+}
+
+}
+
+ConstOpCPURcPtr CPURendererCache::get(const std::string & key) const
+{
+    AutoMutex lock(m_mutex);
+
+    auto iter = m_renderers.find(key);
+    return iter != m_renderers.end() ? iter->second.lock() : ConstOpCPURcPtr();
+}
+
+void CPURendererCache::add(const std::string & key, const ConstOpCPURcPtr & renderer)
+{
+    AutoMutex lock(m_mutex);
+
+    m_renderers[key] = renderer;
+
+    if (m_renderers.size() >= m_sweepSize)
+    {
+        removeExpiredRenderers();
+        m_sweepSize = std::max(size_t(64), 2 * m_renderers.size());
+    }
+}
+
+size_t CPURendererCache::getNumRenderers() const
+{
+    AutoMutex lock(m_mutex);
+
+    size_t numRenderers = 0;
+    for (const auto & renderer : m_renderers)
+    {
+        if (!renderer.second.expired())
+        {
+            ++numRenderers;
+        }
+    }
+    return numRenderers;
+}
+
+void CPURendererCache::removeExpiredRenderers()
+{
+    for (auto iter = m_renderers.begin(); iter != m_renderers.end(); )
+    {
+        if (iter->second.expired())
+        {
+            iter = m_renderers.erase(iter);
+        }
+        else
+        {
+            ++iter;
+        }
+    }
+}
+
 void CreateCPUEngine(const OpRcPtrVec & ops, 
                      BitDepth in, 
                      BitDepth out,
@@ -127,7 +226,10 @@ void CreateCPUEngine(const OpRcPtrVec & ops,
                      // The remaining CPU Ops.
                      ConstOpCPURcPtrVec & cpuOps,
                      // The bit-depth 'cast' or the last CPU Op.
-                     ConstOpCPURcPtr & outBitDepthOp)
+                     ConstOpCPURcPtr & outBitDepthOp,
+                     // The optional cache of the renderers and the finalization flags.
+                     OptimizationFlags oFlags = OPTIMIZATION_NONE,
+                     CPURendererCache * renderers = nullptr)
 {
     const size_t maxOps = ops.size();
     for(size_t idx=0; idx<maxOps; ++idx)
@@ -135,48 +237,75 @@ void CreateCPUEngine(const OpRcPtrVec & ops,
         ConstOpRcPtr op = ops[idx];
         ConstOpDataRcPtr opData = op->data();
 
+        const bool isLut1D = opData->getType()==OpData::Lut1DType;
+
+        // A range following a matrix, a 1D LUT or a log is folded into the renderer of
+        // that op so the clamp does not cost a separate pass over the pixels. The 1D LUT
+        // renderer handling the input bit-depth conversion is excluded, as its input
+        // is not float.
+        ConstRangeOpDataRcPtr range;
+        if(idx+1<maxOps && CanFuseRange(opData) && !(idx==0 && isLut1D && in!=BIT_DEPTH_F32))
+        {
+            ConstOpRcPtr next = ops[idx+1];
+            range = DynamicPtrCast<const RangeOpData>(next->data());
+        }
+
+        const bool isLast = (range ? idx+1 : idx)==(maxOps-1);
+
         if(idx==0)
         {
-            if(opData->getType()==OpData::Lut1DType)
+            if(isLut1D)
             {
                 ConstLut1DOpDataRcPtr lut = DynamicPtrCast<const Lut1DOpData>(opData);
                 inBitDepthOp = GetLut1DRenderer(lut, in, BIT_DEPTH_F32);
+                if(range)
+                {
+                    inBitDepthOp = GetRangeFusedRenderer(inBitDepthOp, range);
+                }
             }
             else if(in==BIT_DEPTH_F32)
             {
-                inBitDepthOp = op->getCPUOp();
+                inBitDepthOp = GetCPUOp(op, range, oFlags, renderers);
             }
             else
             {
                 inBitDepthOp = CreateGenericBitDepthHelper(in, BIT_DEPTH_F32);
-                cpuOps.push_back(op->getCPUOp());
+                cpuOps.push_back(GetCPUOp(op, range, oFlags, renderers));
             }
 
-            if(maxOps==1)
+            if(isLast)
             {
                 outBitDepthOp = CreateGenericBitDepthHelper(BIT_DEPTH_F32, out);
             }
         }
-        else if(idx==(maxOps-1))
+        else if(isLast)
         {
-            if(opData->getType()==OpData::Lut1DType)
+            // The 1D LUT renderer handling the output bit-depth conversion cannot be fused
+            // as its output is not float.
+            if(isLut1D && !range)
             {
                 ConstLut1DOpDataRcPtr lut = DynamicPtrCast<const Lut1DOpData>(opData);
                 outBitDepthOp = GetLut1DRenderer(lut, BIT_DEPTH_F32, out);
             }
             else if(out==BIT_DEPTH_F32)
             {
-                outBitDepthOp = op->getCPUOp();
+                outBitDepthOp = GetCPUOp(op, range, oFlags, renderers);
             }
             else
             {
                 outBitDepthOp = CreateGenericBitDepthHelper(BIT_DEPTH_F32, out);
-                cpuOps.push_back(op->getCPUOp());
+                cpuOps.push_back(GetCPUOp(op, range, oFlags, renderers));
             }
         }
         else
         {
-            cpuOps.push_back(op->getCPUOp());
+            cpuOps.push_back(GetCPUOp(op, range, oFlags, renderers));
+        }
+
+        if(range)
+        {
+            // Skip the fused range.
+            ++idx;
         }
     }
 }
@@ -260,12 +389,8 @@ DynamicPropertyRcPtr CPUProcessor::Impl::getDynamicProperty(DynamicPropertyType
     throw Exception("Cannot find dynamic property; not used by CPU processor.");
 }
 
-void FinalizeOpsForCPU(OpRcPtrVec & ops, const OpRcPtrVec & rawOps,
-                       BitDepth in, BitDepth out,
-                       OptimizationFlags oFlags)
+void FinalizeOpsForCPU(OpRcPtrVec & ops, BitDepth in, BitDepth out, OptimizationFlags oFlags)
 {
-    ops = rawOps;
-
     if(!ops.empty())
     {
         // Optimize the ops.
@@ -303,12 +428,21 @@ void FinalizeOpsForCPU(OpRcPtrVec & ops, const OpRcPtrVec & rawOps,
 
 void CPUProcessor::Impl::finalize(const OpRcPtrVec & rawOps,
                                   BitDepth in, BitDepth out,
-                                  OptimizationFlags oFlags)
+                                  OptimizationFlags oFlags,
+                                  CPURendererCache * renderers)
 {
     AutoMutex lock(m_mutex);
 
+    std::ostringstream oss;
+    oss << "CPU from " << BitDepthToString(in) << " to " << BitDepthToString(out)
+        << " oFlags " << oFlags;
+
     OpRcPtrVec ops;
-    FinalizeOpsForCPU(ops, rawOps, in, out, oFlags);
+    FinalizeOpVecCached(ops, rawOps, oss.str(),
+                        [in, out, oFlags](OpRcPtrVec & finalizedOps)
+                        {
+                            FinalizeOpsForCPU(finalizedOps, in, out, oFlags);
+                        });
 
     m_inBitDepth  = in;
     m_outBitDepth = out;
@@ -324,7 +458,7 @@ void CPUProcessor::Impl::finalize(const OpRcPtrVec & rawOps,
     m_cpuOps.clear();
     m_inBitDepthOp = nullptr;
     m_outBitDepthOp = nullptr;
-    CreateCPUEngine(ops, in, out, m_inBitDepthOp, m_cpuOps, m_outBitDepthOp);
+    CreateCPUEngine(ops, in, out, m_inBitDepthOp, m_cpuOps, m_outBitDepthOp, oFlags, renderers);
 
     // Compute the cache id.
 
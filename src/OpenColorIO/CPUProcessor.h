@@ -6,8 +6,13 @@
 #define INCLUDED_OCIO_CPUPROCESSOR_H
 
 
+#include <map>
+#include <memory>
+#include <string>
+
 #include <OpenColorIO/OpenColorIO.h>
 
+#include "Mutex.h"
 #include "Op.h"
 
 
@@ -16,6 +21,35 @@ namespace OCIO_NAMESPACE
 
 class ScanlineHelper;
 
+// Renderers of the finalized ops shared by the CPU processors of a processor and of the
+// processors incrementally rebuilt from it (refer to Config::getProcessor with a previous
+// processor).  The renderers are only weakly referenced so they are released with the last
+// CPU processor using them.
+class CPURendererCache
+{
+public:
+    CPURendererCache() = default;
+    CPURendererCache(const CPURendererCache &) = delete;
+    CPURendererCache & operator=(const CPURendererCache &) = delete;
+
+    // Return a null pointer if there is no live renderer for the key.
+    ConstOpCPURcPtr get(const std::string & key) const;
+    void add(const std::string & key, const ConstOpCPURcPtr & renderer);
+
+    // Number of live renderers.
+    size_t getNumRenderers() const;
+
+private:
+    // You must manually acquire the mutex before calling this.
+    void removeExpiredRenderers();
+
+    mutable Mutex m_mutex;
+    std::map<std::string, std::weak_ptr<const OpCPU>> m_renderers;
+    size_t m_sweepSize = 64;
+};
+
+typedef OCIO_SHARED_PTR<CPURendererCache> CPURendererCacheRcPtr;
+
 class CPUProcessor::Impl
 {
 public:
@@ -53,7 +87,9 @@ public:
     //
     // Functions not exposed to the OCIO public API.
 
-    void finalize(const OpRcPtrVec & rawOps, BitDepth in, BitDepth out, OptimizationFlags oFlags);
+    // The renderers are looked up in (and added to) the optional renderer cache.
+    void finalize(const OpRcPtrVec & rawOps, BitDepth in, BitDepth out, OptimizationFlags oFlags,
+                  CPURendererCache * renderers = nullptr);
 
 private:
     ConstOpCPURcPtr    m_inBitDepthOp; // Converts from in to F32. It could be done by the first op.
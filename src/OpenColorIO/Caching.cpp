@@ -1,14 +1,27 @@
 // SPDX-License-Identifier: BSD-3-Clause
 // Copyright Contributors to the OpenColorIO Project.
 
+#include <atomic>
+#include <string>
+
 #include <OpenColorIO/OpenColorIO.h>
 
+#include "Caching.h"
+#include "ConfigSnapshot.h"
 #include "transforms/CDLTransform.h"
+#include "FileWatcher.h"
+#include "OpVecCache.h"
 #include "PathUtils.h"
 #include "transforms/FileTransform.h"
 
 namespace OCIO_NAMESPACE
 {
+namespace
+{
+std::atomic<unsigned> g_cachesGeneration{ 0 };
+std::atomic<unsigned> g_fileLookupsGeneration{ 0 };
+}
+
 // TODO: Processors which the user hangs onto have local caches.
 // Should these be cleared?
 
@@ -17,5 +30,32 @@ void ClearAllCaches()
     ClearPathCaches();
     ClearFileTransformCaches();
     ClearCDLTransformFileCache();
+    ClearOpVecCache();
+    ClearConfigSnapshotCache();
+    ClearWatchedFiles();
+
+    ++g_cachesGeneration;
+    ++g_fileLookupsGeneration;
+}
+
+void ClearCachesForFile(const char * filepath)
+{
+    const std::string path(filepath ? filepath : "");
+
+    ClearPathCaches(path);
+    ClearFileTransformCaches(path);
+    ClearCDLTransformFileCache(path);
+
+    ++g_cachesGeneration;
+}
+
+unsigned GetCachesGeneration()
+{
+    return g_cachesGeneration;
+}
+
+unsigned GetFileLookupsGeneration()
+{
+    return g_fileLookupsGeneration;
 }
 } // namespace OCIO_NAMESPACE
@@ -0,0 +1,25 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+
+#ifndef INCLUDED_OCIO_CACHING_H
+#define INCLUDED_OCIO_CACHING_H
+
+#include <OpenColorIO/OpenColorIO.h>
+
+
+namespace OCIO_NAMESPACE
+{
+
+// Incremented by each ClearAllCaches or ClearCachesForFile call so the data derived from the
+// cached files (e.g. the ops a processor keeps for the incremental rebuilds) can detect that it
+// could be outdated.
+unsigned GetCachesGeneration();
+
+// Incremented by each ClearAllCaches call only, the context file lookups being kept by the
+// ClearCachesForFile calls (i.e. a changed file content does not move the file).
+unsigned GetFileLookupsGeneration();
+
+} // namespace OCIO_NAMESPACE
+
+#endif
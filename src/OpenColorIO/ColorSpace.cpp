@@ -8,6 +8,7 @@
 #include <OpenColorIO/OpenColorIO.h>
 
 #include "Categories.h"
+#include "LazyTransform.h"
 #include "PrivateTypes.h"
 #include "utils/StringUtils.h"
 
@@ -31,8 +32,8 @@ public:
     Allocation m_allocation{ ALLOCATION_UNIFORM };
     std::vector<float> m_allocationVars;
 
-    TransformRcPtr m_toRefTransform;
-    TransformRcPtr m_fromRefTransform;
+    LazyTransform m_toRefTransform;
+    LazyTransform m_fromRefTransform;
 
     bool m_toRefSpecified{ false };
     bool m_fromRefSpecified{ false };
@@ -64,13 +65,8 @@ public:
             m_allocation = rhs.m_allocation;
             m_allocationVars = rhs.m_allocationVars;
 
-            m_toRefTransform = rhs.m_toRefTransform?
-                rhs.m_toRefTransform->createEditableCopy()
-                : rhs.m_toRefTransform;
-
-            m_fromRefTransform = rhs.m_fromRefTransform?
-                rhs.m_fromRefTransform->createEditableCopy()
-                : rhs.m_fromRefTransform;
+            m_toRefTransform = rhs.m_toRefTransform;
+            m_fromRefTransform = rhs.m_fromRefTransform;
 
             m_toRefSpecified = rhs.m_toRefSpecified;
             m_fromRefSpecified = rhs.m_fromRefSpecified;
@@ -254,9 +250,9 @@ void ColorSpace::setAllocationVars(int numvars, const float * vars)
 ConstTransformRcPtr ColorSpace::getTransform(ColorSpaceDirection dir) const
 {
     if(dir == COLORSPACE_DIR_TO_REFERENCE)
-        return getImpl()->m_toRefTransform;
+        return getImpl()->m_toRefTransform.get();
     else if(dir == COLORSPACE_DIR_FROM_REFERENCE)
-        return getImpl()->m_fromRefTransform;
+        return getImpl()->m_fromRefTransform.get();
 
     throw Exception("Unspecified ColorSpaceDirection");
 }
@@ -268,13 +264,18 @@ void ColorSpace::setTransform(const ConstTransformRcPtr & transform,
     if(transform) transformCopy = transform->createEditableCopy();
 
     if(dir == COLORSPACE_DIR_TO_REFERENCE)
-        getImpl()->m_toRefTransform = transformCopy;
+        getImpl()->m_toRefTransform.set(transformCopy);
     else if(dir == COLORSPACE_DIR_FROM_REFERENCE)
-        getImpl()->m_fromRefTransform = transformCopy;
+        getImpl()->m_fromRefTransform.set(transformCopy);
     else
         throw Exception("Unspecified ColorSpaceDirection");
 }
 
+void SetTransformLoader(ColorSpace & cs, ColorSpaceDirection dir, const TransformLoader & loader)
+{
+    cs.setTransform(std::make_shared<LoaderTransform>(loader), dir);
+}
+
 std::ostream & operator<< (std::ostream & os, const ColorSpace & cs)
 {
     int numVars(cs.getAllocationNumVars());
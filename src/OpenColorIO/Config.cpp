@@ -2,16 +2,23 @@
 // Copyright Contributors to the OpenColorIO Project.
 
 
+#include <algorithm>
+#include <atomic>
 #include <cstdlib>
 #include <cstring>
+#include <functional>
+#include <map>
 #include <set>
 #include <sstream>
 #include <fstream>
+#include <thread>
 #include <utility>
 #include <vector>
 
 #include <OpenColorIO/OpenColorIO.h>
 
+#include "Caching.h"
+#include "ConfigSnapshot.h"
 #include "Display.h"
 #include "FileRules.h"
 #include "HashUtils.h"
@@ -26,6 +33,7 @@
 #include "Platform.h"
 #include "PrivateTypes.h"
 #include "Processor.h"
+#include "transforms/FileTransform.h"
 #include "utils/StringUtils.h"
 
 
@@ -36,6 +44,7 @@ const char * OCIO_CONFIG_ENVVAR               = "OCIO";
 const char * OCIO_ACTIVE_DISPLAYS_ENVVAR      = "OCIO_ACTIVE_DISPLAYS";
 const char * OCIO_ACTIVE_VIEWS_ENVVAR         = "OCIO_ACTIVE_VIEWS";
 const char * OCIO_INACTIVE_COLORSPACES_ENVVAR = "OCIO_INACTIVE_COLORSPACES";
+const char * OCIO_LAZY_LOADING_ENVVAR         = "OCIO_LAZY_LOADING";
 
 namespace
 {
@@ -85,13 +94,23 @@ int GetVersionHex()
 namespace
 {
 ConstConfigRcPtr g_currentConfig;
-Mutex g_currentConfigLock;
+SharedMutex g_currentConfigLock;
 }
 
 ConstConfigRcPtr GetCurrentConfig()
 {
-    AutoMutex lock(g_currentConfigLock);
+    {
+        AutoSharedMutex lock(g_currentConfigLock);
+
+        if(g_currentConfig)
+        {
+            return g_currentConfig;
+        }
+    }
 
+    AutoExclusiveMutex lock(g_currentConfigLock);
+
+    // Another thread may have already created it.
     if(!g_currentConfig)
     {
         g_currentConfig = Config::CreateFromEnv();
@@ -102,9 +121,12 @@ ConstConfigRcPtr GetCurrentConfig()
 
 void SetCurrentConfig(const ConstConfigRcPtr & config)
 {
-    AutoMutex lock(g_currentConfigLock);
+    // Copy the config outside of the lock.
+    ConstConfigRcPtr newConfig = config->createEditableCopy();
+
+    AutoExclusiveMutex lock(g_currentConfigLock);
 
-    g_currentConfig = config->createEditableCopy();
+    g_currentConfig.swap(newConfig);
 }
 
 namespace
@@ -146,6 +168,122 @@ void GetFileReferences(std::set<std::string> & files, const ConstTransformRcPtr
     }
 }
 
+// Collect the distinct FileTransforms, the key being their serialization.
+void GetFileTransforms(std::map<std::string, ConstFileTransformRcPtr> & fileTransforms,
+                       const ConstTransformRcPtr & transform)
+{
+    if(!transform) return;
+
+    if(ConstGroupTransformRcPtr groupTransform = \
+        DynamicPtrCast<const GroupTransform>(transform))
+    {
+        for(int i=0; i<groupTransform->getNumTransforms(); ++i)
+        {
+            GetFileTransforms(fileTransforms, groupTransform->getTransform(i));
+        }
+    }
+    else if(ConstFileTransformRcPtr fileTransform = \
+        DynamicPtrCast<const FileTransform>(transform))
+    {
+        std::ostringstream oss;
+        oss << *fileTransform;
+        fileTransforms.emplace(oss.str(), fileTransform);
+    }
+}
+
+void GetElementFileReferences(std::set<std::string> & files, const ConstColorSpaceRcPtr & cs)
+{
+    GetFileReferences(files, cs->getTransform(COLORSPACE_DIR_TO_REFERENCE));
+    GetFileReferences(files, cs->getTransform(COLORSPACE_DIR_FROM_REFERENCE));
+}
+
+void GetElementFileReferences(std::set<std::string> & files, const ConstLookRcPtr & look)
+{
+    GetFileReferences(files, look->getTransform());
+    GetFileReferences(files, look->getInverseTransform());
+}
+
+void GetElementFileReferences(std::set<std::string> & files, const ConstViewTransformRcPtr & vt)
+{
+    GetFileReferences(files, vt->getTransform(VIEWTRANSFORM_DIR_TO_REFERENCE));
+    GetFileReferences(files, vt->getTransform(VIEWTRANSFORM_DIR_FROM_REFERENCE));
+}
+
+// Number of threads to use for numItems small items: one thread per minItemsPerThread items.
+size_t GetNumThreads(size_t numItems, size_t minItemsPerThread)
+{
+    static constexpr size_t MaxThreads = 16;
+
+    return std::min({ static_cast<size_t>(std::thread::hardware_concurrency()),
+                      numItems / minItemsPerThread,
+                      MaxThreads });
+}
+
+// Call func for each index using up to numThreads threads (including the calling thread).
+// Note: func must not throw.
+void ParallelFor(size_t numItems, size_t numThreads, const std::function<void(size_t)> & func)
+{
+    numThreads = std::min(numThreads, numItems);
+    if (numThreads < 2)
+    {
+        for (size_t idx = 0; idx < numItems; ++idx)
+        {
+            func(idx);
+        }
+        return;
+    }
+
+    std::atomic<size_t> nextItem{ 0 };
+    auto worker = [&]()
+    {
+        for (size_t idx = nextItem++; idx < numItems; idx = nextItem++)
+        {
+            func(idx);
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for (size_t idx = 1; idx < numThreads; ++idx)
+    {
+        threads.emplace_back(worker);
+    }
+    worker();
+
+    for (auto & thread : threads)
+    {
+        thread.join();
+    }
+}
+
+// Hash the file references once resolved with the context. Unresolved files are not an error
+// at this point.
+std::string ComputeFileReferencesHash(const StringUtils::StringVec & files,
+                                      const ConstContextRcPtr & context)
+{
+    std::vector<std::string> hashes(files.size());
+    ParallelFor(files.size(), GetNumThreads(files.size(), 8), [&files, &hashes, &context](size_t idx)
+    {
+        try
+        {
+            const std::string resolvedLocation = context->resolveFileLocation(files[idx].c_str());
+            hashes[idx] = GetFastFileHash(resolvedLocation);
+        }
+        catch(...)
+        {
+            hashes[idx] = "?";
+        }
+    });
+
+    std::ostringstream filehash;
+    for (size_t idx = 0; idx < files.size(); ++idx)
+    {
+        filehash << files[idx] << "=" << hashes[idx] << " ";
+    }
+
+    const std::string fullstr = filehash.str();
+    return CacheIDHash(fullstr.c_str(), fullstr.size());
+}
+
 void GetColorSpaceReferences(std::set<std::string> & colorSpaceNames,
                              const ConstTransformRcPtr & transform,
                              const ConstContextRcPtr & context)
@@ -181,6 +319,14 @@ void GetColorSpaceReferences(std::set<std::string> & colorSpaceNames,
 
 static constexpr char AddedDefault[]{ "added_default_rule_colorspace" };
 
+std::atomic<unsigned> g_configRevision{ 0 };
+
+// Each content of each config gets a distinct revision.
+unsigned NextConfigRevision()
+{
+    return ++g_configRevision;
+}
+
 void FindAvailableName(const ColorSpaceSetRcPtr & colorspaces, std::string & csname)
 {
     int i = 0;
@@ -246,9 +392,19 @@ public:
 
     std::vector<ViewTransformRcPtr> m_viewTransforms;
 
+    // Case-insensitive indexes of the looks, the view transforms, the displays and the views
+    // (one index per display) kept in sync with the lists to avoid linear searches.
+    NameIndexMap m_lookIndex;
+    NameIndexMap m_viewTransformIndex;
+    NameIndexMap m_displayIndex;
+    std::vector<NameIndexMap> m_viewIndexes;
+
     mutable std::string m_activeDisplaysStr;
     mutable std::string m_activeViewsStr;
+    // The active displays, lazily computed by the first query.
     mutable StringUtils::StringVec m_displayCache;
+    mutable std::atomic<bool> m_displayCacheComputed{ false };
+    mutable Mutex m_displayCacheMutex;
 
     // Misc
     std::vector<double> m_defaultLumaCoefs;
@@ -257,9 +413,29 @@ public:
     mutable Sanity m_sanity;
     mutable std::string m_sanitytext;
 
-    mutable Mutex m_cacheidMutex;
+    // Guards the cache identifiers so that concurrent queries only take a shared lock.
+    mutable SharedMutex m_cacheidMutex;
     mutable StringMap m_cacheids;
+    // The caches generation of m_cacheids (i.e. the file hashes could have changed since).
+    mutable unsigned m_cacheidsGeneration = 0;
     mutable std::string m_cacheidnocontext;
+    // All the file references (sorted) used by the cache identifiers.
+    mutable StringUtils::StringVec m_fileReferences;
+
+    // The cache identifier and the file references of each config element (i.e. color space,
+    // look & view transform).  As the elements are immutable once added to the config, the
+    // entries are keyed by the element address and the element is held to prevent any address
+    // reuse.  Only the new or changed elements are then serialized after an edit.
+    struct ElementCacheID
+    {
+        std::shared_ptr<const void> m_element;
+        std::string m_cacheID;
+        std::set<std::string> m_files;
+    };
+    typedef std::map<const void *, ElementCacheID> ElementCacheIDMap;
+    mutable ElementCacheIDMap m_elementCacheIDs;
+    // Changes with the cache identifiers but is much cheaper to get.
+    unsigned m_revision = NextConfigRevision();
     FileRulesRcPtr m_fileRules;
 
     Impl() :
@@ -324,17 +500,20 @@ public:
             {
                 m_looksList.push_back(rhs.m_looksList[i]->createEditableCopy());
             }
+            m_lookIndex = rhs.m_lookIndex;
 
             // Assignment operator will suffice for these.
             m_roles = rhs.m_roles;
 
             m_displays = rhs.m_displays;
+            m_displayIndex = rhs.m_displayIndex;
+            m_viewIndexes = rhs.m_viewIndexes;
             m_activeDisplays = rhs.m_activeDisplays;
             m_activeViews = rhs.m_activeViews;
             m_activeViewsEnvOverride = rhs.m_activeViewsEnvOverride;
             m_activeDisplaysEnvOverride = rhs.m_activeDisplaysEnvOverride;
             m_activeDisplaysStr = rhs.m_activeDisplaysStr;
-            m_displayCache = rhs.m_displayCache;
+            resetDisplayCache();
 
             // Deep copy view transforms.
             m_viewTransforms.clear();
@@ -343,6 +522,7 @@ public:
             {
                 m_viewTransforms.push_back(vt->createEditableCopy());
             }
+            m_viewTransformIndex = rhs.m_viewTransformIndex;
 
             m_defaultLumaCoefs = rhs.m_defaultLumaCoefs;
             m_strictParsing = rhs.m_strictParsing;
@@ -350,14 +530,94 @@ public:
             m_sanity = rhs.m_sanity;
             m_sanitytext = rhs.m_sanitytext;
 
-            m_cacheids = rhs.m_cacheids;
-            m_cacheidnocontext = rhs.m_cacheidnocontext;
+            {
+                // The caches of the source config could be concurrently updated.
+                AutoSharedMutex lock(rhs.m_cacheidMutex);
+                m_cacheids = rhs.m_cacheids;
+                m_cacheidsGeneration = rhs.m_cacheidsGeneration;
+                m_cacheidnocontext = rhs.m_cacheidnocontext;
+                m_fileReferences = rhs.m_fileReferences;
+            }
+            // The elements are copies so their cache identifiers are computed again if needed.
+            m_elementCacheIDs.clear();
+            m_revision = rhs.m_revision;
 
             m_fileRules = rhs.m_fileRules->createEditableCopy();
         }
         return *this;
     }
 
+    // Return the active displays (computed only once).
+    const StringUtils::StringVec & getDisplayCache() const
+    {
+        if (!m_displayCacheComputed.load(std::memory_order_acquire))
+        {
+            AutoMutex lock(m_displayCacheMutex);
+            if (!m_displayCacheComputed.load(std::memory_order_relaxed))
+            {
+                ComputeDisplays(m_displayCache,
+                                m_displays,
+                                m_activeDisplays,
+                                m_activeDisplaysEnvOverride);
+                m_displayCacheComputed.store(true, std::memory_order_release);
+            }
+        }
+        return m_displayCache;
+    }
+
+    // Any time you modify the displays, you must call this to reset the display cache.
+    void resetDisplayCache()
+    {
+        m_displayCache.clear();
+        m_displayCacheComputed = false;
+    }
+
+    // Return the position of the display in the display list or -1 if not found.
+    int findDisplay(const char * display) const
+    {
+        if (!display) return -1;
+
+        const auto it = m_displayIndex.find(StringUtils::Lower(display));
+        return it == m_displayIndex.end() ? -1 : static_cast<int>(it->second);
+    }
+
+    // Return the position of the view in the view list of the display or -1 if not found.
+    int findView(int displayIndex, const char * view) const
+    {
+        if (displayIndex < 0 || !view) return -1;
+
+        const NameIndexMap & views = m_viewIndexes[displayIndex];
+        const auto it = views.find(StringUtils::Lower(view));
+        return it == views.end() ? -1 : static_cast<int>(it->second);
+    }
+
+    const View * getView(const char * display, const char * view) const
+    {
+        const int displayIndex = findDisplay(display);
+        const int viewIndex = findView(displayIndex, view);
+        return viewIndex < 0 ? nullptr : &m_displays[displayIndex].second[viewIndex];
+    }
+
+    // Must be called each time the display list changes, except when adding a display/view
+    // pair where AddDisplay() updates the indexes.
+    void rebuildDisplayIndexes()
+    {
+        m_displayIndex.clear();
+        m_viewIndexes.clear();
+        m_viewIndexes.resize(m_displays.size());
+
+        for (size_t idx = 0; idx < m_displays.size(); ++idx)
+        {
+            m_displayIndex[StringUtils::Lower(m_displays[idx].first)] = idx;
+
+            const ViewVec & views = m_displays[idx].second;
+            for (size_t v = 0; v < views.size(); ++v)
+            {
+                m_viewIndexes[idx][StringUtils::Lower(views[v].m_name)] = v;
+            }
+        }
+    }
+
     // Only search for a color space name (i.e. not for a role name).
     int getColorSpaceIndex(const char * csname) const
     {
@@ -378,11 +638,31 @@ public:
     // thread safe manner by acquiring the m_cacheidMutex.
     void resetCacheIDs();
 
+    // Compute m_cacheidnocontext and m_fileReferences from the config header and the element
+    // cache identifiers.  You must manually acquire the m_cacheidMutex.
+    void updateCacheIDNoContext(const Config & config) const;
+
+    template<typename T>
+    const ElementCacheID & getElementCacheID(const std::shared_ptr<T> & element,
+                                             ElementCacheIDMap & elementCacheIDs) const;
+
+    // Identifies the config content, the context and the file caches used to build processors.
+    std::string getProcessorBuildID(const ConstContextRcPtr & context) const
+    {
+        std::ostringstream oss;
+        oss << m_revision << " " << GetCachesGeneration() << " "
+            << (context ? context->getCacheID() : "");
+        return oss.str();
+    }
+
     // Get all internal transforms (to generate cacheIDs, validation, etc).
     // This currently crawls colorspaces + looks + view transforms.
     void getAllInternalTransforms(ConstTransformVec & transformVec) const;
 
-    static ConstConfigRcPtr Read(std::istream & istream, const char * filename);
+    static ConfigRcPtr Read(std::istream & istream, const char * filename,
+                            bool lazyLoading = false);
+
+    static ConstConfigRcPtr ReadSnapshot(std::istream & istream, const char * filename);
 
     // Upgrade from v1 to v2.
     void upgradeFromVersion1ToVersion2()
@@ -443,7 +723,7 @@ public:
         // inactiveColorSpaceNamesAPI_ list highlights the API request precedence.
         m_inactiveColorSpaceNamesAPI = m_inactiveColorSpaceNamesConf;
 
-        AutoMutex lock(m_cacheidMutex);
+        AutoExclusiveMutex lock(m_cacheidMutex);
         resetCacheIDs();
         refreshActiveColorSpaces();
     }
@@ -503,6 +783,25 @@ ConstConfigRcPtr Config::CreateFromStream(std::istream & istream)
     return Config::Impl::Read(istream, nullptr);
 }
 
+ConstConfigRcPtr Config::CreateFromSnapshotFile(const char * filename)
+{
+    std::ifstream istream(filename, std::ios_base::in | std::ios_base::binary);
+    if (istream.fail())
+    {
+        std::ostringstream os;
+        os << "Error could not read '" << filename;
+        os << "' OCIO config snapshot.";
+        throw Exception (os.str().c_str());
+    }
+
+    return Config::Impl::ReadSnapshot(istream, filename);
+}
+
+ConstConfigRcPtr Config::CreateFromSnapshot(std::istream & istream)
+{
+    return Config::Impl::ReadSnapshot(istream, nullptr);
+}
+
 ///////////////////////////////////////////////////////////////////////////
 
 Config::Config()
@@ -537,7 +836,7 @@ void Config::setMajorVersion(unsigned int version)
     }
     m_impl->m_majorVersion = version;
 
-    AutoMutex lock(getImpl()->m_cacheidMutex);
+    AutoExclusiveMutex lock(getImpl()->m_cacheidMutex);
     getImpl()->resetCacheIDs();
 }
 
@@ -1035,7 +1334,7 @@ void Config::setFamilySeparator(char separator)
 
     getImpl()->m_familySeparator = separator;
     
-    AutoMutex lock(getImpl()->m_cacheidMutex);
+    AutoExclusiveMutex lock(getImpl()->m_cacheidMutex);
     getImpl()->resetCacheIDs();
 }
 
@@ -1050,7 +1349,7 @@ void Config::setDescription(const char * description)
 {
     getImpl()->m_description = description;
 
-    AutoMutex lock(getImpl()->m_cacheidMutex);
+    AutoExclusiveMutex lock(getImpl()->m_cacheidMutex);
     getImpl()->resetCacheIDs();
 }
 
@@ -1074,7 +1373,7 @@ void Config::addEnvironmentVar(const char * name, const char * defaultValue)
         if(iter != getImpl()->m_env.end()) getImpl()->m_env.erase(iter);
     }
 
-    AutoMutex lock(getImpl()->m_cacheidMutex);
+    AutoExclusiveMutex lock(getImpl()->m_cacheidMutex);
     getImpl()->resetCacheIDs();
 }
 
@@ -1101,7 +1400,7 @@ void Config::clearEnvironmentVars()
     getImpl()->m_env.clear();
     getImpl()->m_context->clearStringVars();
 
-    AutoMutex lock(getImpl()->m_cacheidMutex);
+    AutoExclusiveMutex lock(getImpl()->m_cacheidMutex);
     getImpl()->resetCacheIDs();
 }
 
@@ -1109,7 +1408,7 @@ void Config::setEnvironmentMode(EnvironmentMode mode)
 {
     getImpl()->m_context->setEnvironmentMode(mode);
 
-    AutoMutex lock(getImpl()->m_cacheidMutex);
+    AutoExclusiveMutex lock(getImpl()->m_cacheidMutex);
     getImpl()->resetCacheIDs();
 }
 
@@ -1122,7 +1421,7 @@ void Config::loadEnvironment()
 {
     getImpl()->m_context->loadEnvironment();
 
-    AutoMutex lock(getImpl()->m_cacheidMutex);
+    AutoExclusiveMutex lock(getImpl()->m_cacheidMutex);
     getImpl()->resetCacheIDs();
 }
 
@@ -1135,7 +1434,7 @@ void Config::setSearchPath(const char * path)
 {
     getImpl()->m_context->setSearchPath(path);
 
-    AutoMutex lock(getImpl()->m_cacheidMutex);
+    AutoExclusiveMutex lock(getImpl()->m_cacheidMutex);
     getImpl()->resetCacheIDs();
 }
 
@@ -1153,7 +1452,7 @@ void Config::clearSearchPaths()
 {
     getImpl()->m_context->clearSearchPaths();
 
-    AutoMutex lock(getImpl()->m_cacheidMutex);
+    AutoExclusiveMutex lock(getImpl()->m_cacheidMutex);
     getImpl()->resetCacheIDs();
 }
 
@@ -1161,7 +1460,7 @@ void Config::addSearchPath(const char * path)
 {
     getImpl()->m_context->addSearchPath(path);
 
-    AutoMutex lock(getImpl()->m_cacheidMutex);
+    AutoExclusiveMutex lock(getImpl()->m_cacheidMutex);
     getImpl()->resetCacheIDs();
 }
 
@@ -1174,7 +1473,7 @@ void Config::setWorkingDir(const char * dirname)
 {
     getImpl()->m_context->setWorkingDir(dirname);
 
-    AutoMutex lock(getImpl()->m_cacheidMutex);
+    AutoExclusiveMutex lock(getImpl()->m_cacheidMutex);
     getImpl()->resetCacheIDs();
 }
 
@@ -1450,7 +1749,7 @@ void Config::addColorSpace(const ConstColorSpaceRcPtr & original)
 {
     getImpl()->m_allColorSpaces->addColorSpace(original);
     
-    AutoMutex lock(getImpl()->m_cacheidMutex);
+    AutoExclusiveMutex lock(getImpl()->m_cacheidMutex);
     getImpl()->resetCacheIDs();
     getImpl()->refreshActiveColorSpaces();
 }
@@ -1459,7 +1758,7 @@ void Config::removeColorSpace(const char * name)
 {
     getImpl()->m_allColorSpaces->removeColorSpace(name);
     
-    AutoMutex lock(getImpl()->m_cacheidMutex);
+    AutoExclusiveMutex lock(getImpl()->m_cacheidMutex);
     getImpl()->resetCacheIDs();
     getImpl()->refreshActiveColorSpaces();
 }
@@ -1556,7 +1855,7 @@ void Config::clearColorSpaces()
 {
     getImpl()->m_allColorSpaces->clearColorSpaces();
     
-    AutoMutex lock(getImpl()->m_cacheidMutex);
+    AutoExclusiveMutex lock(getImpl()->m_cacheidMutex);
     getImpl()->resetCacheIDs();
     getImpl()->refreshActiveColorSpaces();
 }
@@ -1600,7 +1899,7 @@ void Config::setStrictParsingEnabled(bool enabled)
 {
     getImpl()->m_strictParsing = enabled;
 
-    AutoMutex lock(getImpl()->m_cacheidMutex);
+    AutoExclusiveMutex lock(getImpl()->m_cacheidMutex);
     getImpl()->resetCacheIDs();
 }
 
@@ -1622,7 +1921,7 @@ void Config::setRole(const char * role, const char * colorSpaceName)
         }
     }
 
-    AutoMutex lock(getImpl()->m_cacheidMutex);
+    AutoExclusiveMutex lock(getImpl()->m_cacheidMutex);
     getImpl()->resetCacheIDs();
 }
 
@@ -1662,30 +1961,16 @@ const char * Config::getDefaultDisplay() const
 
 int Config::getNumDisplays() const
 {
-    if(getImpl()->m_displayCache.empty())
-    {
-        ComputeDisplays(getImpl()->m_displayCache,
-                        getImpl()->m_displays,
-                        getImpl()->m_activeDisplays,
-                        getImpl()->m_activeDisplaysEnvOverride);
-    }
-
-    return static_cast<int>(getImpl()->m_displayCache.size());
+    return static_cast<int>(getImpl()->getDisplayCache().size());
 }
 
 const char * Config::getDisplay(int index) const
 {
-    if(getImpl()->m_displayCache.empty())
-    {
-        ComputeDisplays(getImpl()->m_displayCache,
-                        getImpl()->m_displays,
-                        getImpl()->m_activeDisplays,
-                        getImpl()->m_activeDisplaysEnvOverride);
-    }
+    const StringUtils::StringVec & displays = getImpl()->getDisplayCache();
 
-    if(index>=0 || index < static_cast<int>(getImpl()->m_displayCache.size()))
+    if(index >= 0 && index < static_cast<int>(displays.size()))
     {
-        return getImpl()->m_displayCache[index].c_str();
+        return displays[index].c_str();
     }
 
     return "";
@@ -1698,20 +1983,10 @@ const char * Config::getDefaultView(const char * display) const
 
 int Config::getNumViews(const char * display) const
 {
-    if(getImpl()->m_displayCache.empty())
-    {
-        ComputeDisplays(getImpl()->m_displayCache,
-                        getImpl()->m_displays,
-                        getImpl()->m_activeDisplays,
-                        getImpl()->m_activeDisplaysEnvOverride);
-    }
-
-    if(!display) return 0;
-
-    DisplayMap::const_iterator iter = find_display_const(getImpl()->m_displays, display);
-    if(iter == getImpl()->m_displays.end()) return 0;
+    const int displayIndex = getImpl()->findDisplay(display);
+    if(displayIndex < 0) return 0;
 
-    const ViewVec & views = iter->second;
+    const ViewVec & views = getImpl()->m_displays[displayIndex].second;
 
     StringUtils::StringVec masterViews;
     for(unsigned int i=0; i<views.size(); ++i)
@@ -1745,20 +2020,10 @@ int Config::getNumViews(const char * display) const
 
 const char * Config::getView(const char * display, int index) const
 {
-    if(getImpl()->m_displayCache.empty())
-    {
-        ComputeDisplays(getImpl()->m_displayCache,
-                        getImpl()->m_displays,
-                        getImpl()->m_activeDisplays,
-                        getImpl()->m_activeDisplaysEnvOverride);
-    }
+    const int displayIndex = getImpl()->findDisplay(display);
+    if(displayIndex < 0) return "";
 
-    if(!display) return "";
-
-    DisplayMap::const_iterator iter = find_display_const(getImpl()->m_displays, display);
-    if(iter == getImpl()->m_displays.end()) return "";
-
-    const ViewVec & views = iter->second;
+    const ViewVec & views = getImpl()->m_displays[displayIndex].second;
 
     StringUtils::StringVec masterViews;
     for(unsigned int i = 0; i < views.size(); ++i)
@@ -1804,44 +2069,20 @@ const char * Config::getView(const char * display, int index) const
 
 const char * Config::getDisplayViewTransformName(const char * display, const char * view) const
 {
-    if (!display || !view) return "";
-
-    DisplayMap::const_iterator iter = find_display_const(getImpl()->m_displays, display);
-    if (iter == getImpl()->m_displays.end()) return "";
-
-    const ViewVec & views = iter->second;
-    const int index = find_view(views, view);
-    if (index<0) return "";
-
-    return views[index].m_viewTransform.c_str();
+    const View * viewPtr = getImpl()->getView(display, view);
+    return viewPtr ? viewPtr->m_viewTransform.c_str() : "";
 }
 
 const char * Config::getDisplayColorSpaceName(const char * display, const char * view) const
 {
-    if(!display || !view) return "";
-
-    DisplayMap::const_iterator iter = find_display_const(getImpl()->m_displays, display);
-    if(iter == getImpl()->m_displays.end()) return "";
-
-    const ViewVec & views = iter->second;
-    const int index = find_view(views, view);
-    if(index<0) return "";
-
-    return views[index].m_colorspace.c_str();
+    const View * viewPtr = getImpl()->getView(display, view);
+    return viewPtr ? viewPtr->m_colorspace.c_str() : "";
 }
 
 const char * Config::getDisplayLooks(const char * display, const char * view) const
 {
-    if(!display || !view) return "";
-
-    DisplayMap::const_iterator iter = find_display_const(getImpl()->m_displays, display);
-    if(iter == getImpl()->m_displays.end()) return "";
-
-    const ViewVec & views = iter->second;
-    const int index = find_view(views, view);
-    if(index<0) return "";
-
-    return views[index].m_looks.c_str();
+    const View * viewPtr = getImpl()->getView(display, view);
+    return viewPtr ? viewPtr->m_looks.c_str() : "";
 }
 
 
@@ -1856,10 +2097,11 @@ void Config::addDisplay(const char * display, const char * view, const char * vi
 {
     if (!display || !view || !displayColorSpaceName) return;
 
-    AddDisplay(getImpl()->m_displays, display, view, viewTransform, displayColorSpaceName, looks);
-    getImpl()->m_displayCache.clear();
+    AddDisplay(getImpl()->m_displays, getImpl()->m_displayIndex, getImpl()->m_viewIndexes,
+               display, view, viewTransform, displayColorSpaceName, looks);
+    getImpl()->resetDisplayCache();
 
-    AutoMutex lock(getImpl()->m_cacheidMutex);
+    AutoExclusiveMutex lock(getImpl()->m_cacheidMutex);
     getImpl()->resetCacheIDs();
 }
 
@@ -1872,12 +2114,14 @@ void Config::removeDisplay(const char * display, const char * view)
 
     // Check if the display exists.
 
-    DisplayMap::iterator iter = find_display(getImpl()->m_displays, display);
-    if (iter==getImpl()->m_displays.end())
+    const int displayIndex = getImpl()->findDisplay(display);
+    if (displayIndex < 0)
     {
         return;
     }
 
+    DisplayMap::iterator iter = getImpl()->m_displays.begin() + displayIndex;
+
     // Check if the display needs to be removed also.
 
     const bool removeDisplay = iter->second.size()<=1;
@@ -1909,18 +2153,20 @@ void Config::removeDisplay(const char * display, const char * view)
                     views.end());
     }
 
-    getImpl()->m_displayCache.clear();
+    getImpl()->rebuildDisplayIndexes();
+    getImpl()->resetDisplayCache();
 
-    AutoMutex lock(getImpl()->m_cacheidMutex);
+    AutoExclusiveMutex lock(getImpl()->m_cacheidMutex);
     getImpl()->resetCacheIDs();
 }
 
 void Config::clearDisplays()
 {
     getImpl()->m_displays.clear();
-    getImpl()->m_displayCache.clear();
+    getImpl()->rebuildDisplayIndexes();
+    getImpl()->resetDisplayCache();
 
-    AutoMutex lock(getImpl()->m_cacheidMutex);
+    AutoExclusiveMutex lock(getImpl()->m_cacheidMutex);
     getImpl()->resetCacheIDs();
 }
 
@@ -1929,9 +2175,9 @@ void Config::setActiveDisplays(const char * displays)
     getImpl()->m_activeDisplays.clear();
     SplitStringEnvStyle(getImpl()->m_activeDisplays, displays);
 
-    getImpl()->m_displayCache.clear();
+    getImpl()->resetDisplayCache();
 
-    AutoMutex lock(getImpl()->m_cacheidMutex);
+    AutoExclusiveMutex lock(getImpl()->m_cacheidMutex);
     getImpl()->resetCacheIDs();
 }
 
@@ -1946,9 +2192,9 @@ void Config::setActiveViews(const char * views)
     getImpl()->m_activeViews.clear();
     SplitStringEnvStyle(getImpl()->m_activeViews, views);
 
-    getImpl()->m_displayCache.clear();
+    getImpl()->resetDisplayCache();
 
-    AutoMutex lock(getImpl()->m_cacheidMutex);
+    AutoExclusiveMutex lock(getImpl()->m_cacheidMutex);
     getImpl()->resetCacheIDs();
 }
 
@@ -1970,7 +2216,7 @@ void Config::setDefaultLumaCoefs(const double * c3)
 {
     memcpy(&getImpl()->m_defaultLumaCoefs[0], c3, 3*sizeof(double));
 
-    AutoMutex lock(getImpl()->m_cacheidMutex);
+    AutoExclusiveMutex lock(getImpl()->m_cacheidMutex);
     getImpl()->resetCacheIDs();
 }
 
@@ -1978,14 +2224,12 @@ void Config::setDefaultLumaCoefs(const double * c3)
 
 ConstLookRcPtr Config::getLook(const char * name) const
 {
-    const std::string namelower = StringUtils::Lower(name);
+    if (!name) return ConstLookRcPtr();
 
-    for(unsigned int i=0; i<getImpl()->m_looksList.size(); ++i)
+    const auto it = getImpl()->m_lookIndex.find(StringUtils::Lower(name));
+    if (it != getImpl()->m_lookIndex.end())
     {
-        if(StringUtils::Lower(getImpl()->m_looksList[i]->getName()) == namelower)
-        {
-            return getImpl()->m_looksList[i];
-        }
+        return getImpl()->m_looksList[it->second];
     }
 
     return ConstLookRcPtr();
@@ -2015,27 +2259,27 @@ void Config::addLook(const ConstLookRcPtr & look)
     const std::string namelower = StringUtils::Lower(name);
 
     // If the look exists, replace it
-    for(unsigned int i=0; i<getImpl()->m_looksList.size(); ++i)
+    const auto it = getImpl()->m_lookIndex.find(namelower);
+    if (it != getImpl()->m_lookIndex.end())
     {
-        if(StringUtils::Lower(getImpl()->m_looksList[i]->getName()) == namelower)
-        {
-            getImpl()->m_looksList[i] = look->createEditableCopy();
-            return;
-        }
+        getImpl()->m_looksList[it->second] = look->createEditableCopy();
+        return;
     }
 
     // Otherwise, add it
+    getImpl()->m_lookIndex[namelower] = getImpl()->m_looksList.size();
     getImpl()->m_looksList.push_back(look->createEditableCopy());
 
-    AutoMutex lock(getImpl()->m_cacheidMutex);
+    AutoExclusiveMutex lock(getImpl()->m_cacheidMutex);
     getImpl()->resetCacheIDs();
 }
 
 void Config::clearLooks()
 {
     getImpl()->m_looksList.clear();
+    getImpl()->m_lookIndex.clear();
 
-    AutoMutex lock(getImpl()->m_cacheidMutex);
+    AutoExclusiveMutex lock(getImpl()->m_cacheidMutex);
     getImpl()->resetCacheIDs();
 }
 
@@ -2048,14 +2292,12 @@ int Config::getNumViewTransforms() const noexcept
 
 ConstViewTransformRcPtr Config::getViewTransform(const char * name) const noexcept
 {
-    const std::string namelower = StringUtils::Lower(name);
+    if (!name) return ConstViewTransformRcPtr();
 
-    for (auto vt : getImpl()->m_viewTransforms)
+    const auto it = getImpl()->m_viewTransformIndex.find(StringUtils::Lower(name));
+    if (it != getImpl()->m_viewTransformIndex.end())
     {
-        if (StringUtils::Lower(vt->getName()) == namelower)
-        {
-            return vt;
-        }
+        return getImpl()->m_viewTransforms[it->second];
     }
 
     return ConstViewTransformRcPtr();
@@ -2102,34 +2344,29 @@ void Config::addViewTransform(const ConstViewTransformRcPtr & viewTransform)
 
     const std::string namelower = StringUtils::Lower(name);
 
-    bool addIt = true;
-
     // If the view transform exists, replace it.
-    for (auto && vt : getImpl()->m_viewTransforms)
+    const auto it = getImpl()->m_viewTransformIndex.find(namelower);
+    if (it != getImpl()->m_viewTransformIndex.end())
     {
-        if (StringUtils::Lower(vt->getName()) == namelower)
-        {
-            vt = viewTransform->createEditableCopy();
-            addIt = false;
-            break;
-        }
+        getImpl()->m_viewTransforms[it->second] = viewTransform->createEditableCopy();
     }
-
     // Otherwise, add it.
-    if (addIt)
+    else
     {
+        getImpl()->m_viewTransformIndex[namelower] = getImpl()->m_viewTransforms.size();
         getImpl()->m_viewTransforms.push_back(viewTransform->createEditableCopy());
     }
 
-    AutoMutex lock(getImpl()->m_cacheidMutex);
+    AutoExclusiveMutex lock(getImpl()->m_cacheidMutex);
     getImpl()->resetCacheIDs();
 }
 
 void Config::clearViewTransforms()
 {
     getImpl()->m_viewTransforms.clear();
+    getImpl()->m_viewTransformIndex.clear();
 
-    AutoMutex lock(getImpl()->m_cacheidMutex);
+    AutoExclusiveMutex lock(getImpl()->m_cacheidMutex);
     getImpl()->resetCacheIDs();
 }
 
@@ -2149,7 +2386,7 @@ void Config::setFileRules(ConstFileRulesRcPtr fileRules)
 
     getImpl()->m_fileRules = fileRules->createEditableCopy();
 
-    AutoMutex lock(getImpl()->m_cacheidMutex);
+    AutoExclusiveMutex lock(getImpl()->m_cacheidMutex);
     getImpl()->resetCacheIDs();
 }
 
@@ -2265,11 +2502,106 @@ ConstProcessorRcPtr Config::getProcessor(const ConstContextRcPtr & context,
                                             TransformDirection direction) const
 {
     ProcessorRcPtr processor = Processor::Create();
-    processor->getImpl()->setTransform(*this, context, transform, direction);
+    processor->getImpl()->setTransform(*this, context, transform, direction,
+                                       getImpl()->getProcessorBuildID(context));
     processor->getImpl()->computeMetadata();
     return processor;
 }
 
+ConstProcessorRcPtr Config::getProcessor(const ConstProcessorRcPtr & previous,
+                                         const ConstContextRcPtr & context,
+                                         const ConstTransformRcPtr & transform,
+                                         TransformDirection direction) const
+{
+    ProcessorRcPtr processor = Processor::Create();
+    processor->getImpl()->setTransform(*this, context, transform, direction,
+                                       getImpl()->getProcessorBuildID(context),
+                                       previous ? previous->getImpl() : nullptr);
+    processor->getImpl()->computeMetadata();
+    return processor;
+}
+
+void Config::preloadFiles(const ConstContextRcPtr & context,
+                          unsigned int numThreads,
+                          bool buildDisplayViewProcessors) const
+{
+    const ConstContextRcPtr ctx = context ? context : getCurrentContext();
+
+    if (numThreads == 0)
+    {
+        numThreads = std::max(1u, std::thread::hardware_concurrency());
+    }
+
+    std::map<std::string, ConstFileTransformRcPtr> fileTransforms;
+    ConstTransformVec allTransforms;
+    getImpl()->getAllInternalTransforms(allTransforms);
+    for (const auto & transform : allTransforms)
+    {
+        GetFileTransforms(fileTransforms, transform);
+    }
+
+    std::vector<ConstFileTransformRcPtr> fileTransformVec;
+    for (const auto & fileTransform : fileTransforms)
+    {
+        fileTransformVec.push_back(fileTransform.second);
+    }
+
+    ParallelFor(fileTransformVec.size(), numThreads, [this, &fileTransformVec, &ctx](size_t idx)
+    {
+        try
+        {
+            // Build the ops like a processor would so that a loaded config snapshot or the LUT
+            // store is used (and filled) instead of always reading the file.
+            OpRcPtrVec ops;
+            BuildFileTransformOps(ops, *this, ctx, *fileTransformVec[idx], TRANSFORM_DIR_FORWARD);
+        }
+        catch (...)
+        {
+            // The error is reported when a processor using the file is built.
+        }
+    });
+
+    if (!buildDisplayViewProcessors)
+    {
+        return;
+    }
+
+    ConstColorSpaceRcPtr src = getColorSpace(ROLE_SCENE_LINEAR);
+    if (!src)
+    {
+        src = getColorSpace(ROLE_DEFAULT);
+    }
+    if (!src)
+    {
+        return;
+    }
+
+    std::vector<std::pair<std::string, std::string>> displayViews;
+    for (int displayIdx = 0; displayIdx < getNumDisplays(); ++displayIdx)
+    {
+        const char * display = getDisplay(displayIdx);
+        for (int viewIdx = 0; viewIdx < getNumViews(display); ++viewIdx)
+        {
+            displayViews.emplace_back(display, getView(display, viewIdx));
+        }
+    }
+
+    ParallelFor(displayViews.size(), numThreads, [this, &displayViews, &ctx, &src](size_t idx)
+    {
+        try
+        {
+            ConstProcessorRcPtr processor = getProcessor(ctx, src->getName(),
+                                                         displayViews[idx].first.c_str(),
+                                                         displayViews[idx].second.c_str());
+            processor->getDefaultCPUProcessor();
+        }
+        catch (...)
+        {
+            // The error is reported when the processor is built again.
+        }
+    });
+}
+
 ConstProcessorRcPtr Config::GetProcessor(const ConstConfigRcPtr & srcConfig,
                                          const char * srcName,
                                          const ConstConfigRcPtr & dstConfig,
@@ -2421,66 +2753,83 @@ const char * Config::getCacheID() const
 
 const char * Config::getCacheID(const ConstContextRcPtr & context) const
 {
-    AutoMutex lock(getImpl()->m_cacheidMutex);
-
     // A null context will use the empty cacheid
     std::string contextcacheid;
-    if(context) contextcacheid = context->getCacheID();
-
-    StringMap::const_iterator cacheiditer = getImpl()->m_cacheids.find(contextcacheid);
-    if(cacheiditer != getImpl()->m_cacheids.end())
+    if(context)
     {
-        return cacheiditer->second.c_str();
+        contextcacheid = context->getCacheID();
     }
 
-    // Include the hash of the yaml config serialization
-    if(getImpl()->m_cacheidnocontext.empty())
     {
-        std::ostringstream cacheid;
-        serialize(cacheid);
-        const std::string fullstr = cacheid.str();
-        getImpl()->m_cacheidnocontext = CacheIDHash(fullstr.c_str(), (int)fullstr.size());
+        // Most of the queries are for an already computed cache identifier.
+        AutoSharedMutex lock(getImpl()->m_cacheidMutex);
+
+        if (getImpl()->m_cacheidsGeneration == GetCachesGeneration())
+        {
+            StringMap::const_iterator cacheiditer = getImpl()->m_cacheids.find(contextcacheid);
+            if(cacheiditer != getImpl()->m_cacheids.end())
+            {
+                return cacheiditer->second.c_str();
+            }
+        }
     }
 
-    // Also include all file references, using the context (if specified)
-    std::string fileReferencesFashHash;
-    if(context)
+    while (true)
     {
-        std::ostringstream filehash;
+        std::string cacheidnocontext;
+        StringUtils::StringVec files;
+        unsigned revision = 0;
+        unsigned generation = 0;
 
-        ConstTransformVec allTransforms;
-        getImpl()->getAllInternalTransforms(allTransforms);
-
-        std::set<std::string> files;
-        for(unsigned int i=0; i<allTransforms.size(); ++i)
         {
-            GetFileReferences(files, allTransforms[i]);
-        }
+            AutoExclusiveMutex lock(getImpl()->m_cacheidMutex);
 
-        for(std::set<std::string>::iterator iter = files.begin();
-            iter != files.end(); ++iter)
-        {
-            if(iter->empty()) continue;
-            filehash << *iter << "=";
+            // The file hashes could have changed since the caches were cleared.
+            generation = GetCachesGeneration();
+            if (getImpl()->m_cacheidsGeneration != generation)
+            {
+                getImpl()->m_cacheids.clear();
+                getImpl()->m_cacheidsGeneration = generation;
+            }
 
-            try
+            StringMap::const_iterator cacheiditer = getImpl()->m_cacheids.find(contextcacheid);
+            if(cacheiditer != getImpl()->m_cacheids.end())
             {
-                const std::string resolvedLocation = context->resolveFileLocation(iter->c_str());
-                filehash << GetFastFileHash(resolvedLocation) << " ";
+                return cacheiditer->second.c_str();
             }
-            catch(...)
+
+            if(getImpl()->m_cacheidnocontext.empty())
             {
-                filehash << "? ";
-                continue;
+                getImpl()->updateCacheIDNoContext(*this);
             }
+
+            if(!context)
+            {
+                std::string & cacheid = getImpl()->m_cacheids[contextcacheid];
+                cacheid = getImpl()->m_cacheidnocontext + ":";
+                return cacheid.c_str();
+            }
+
+            cacheidnocontext = getImpl()->m_cacheidnocontext;
+            files = getImpl()->m_fileReferences;
+            revision = getImpl()->m_revision;
         }
 
-        const std::string fullstr = filehash.str();
-        fileReferencesFashHash = CacheIDHash(fullstr.c_str(), (int)fullstr.size());
-    }
+        // Also include all file references, using the context. The file system queries are
+        // done outside of the lock and in parallel as they are the most expensive part.
+        const std::string fileReferencesFashHash = ComputeFileReferencesHash(files, context);
+
+        AutoExclusiveMutex lock(getImpl()->m_cacheidMutex);
 
-    getImpl()->m_cacheids[contextcacheid] = getImpl()->m_cacheidnocontext + ":" + fileReferencesFashHash;
-    return getImpl()->m_cacheids[contextcacheid].c_str();
+        // Start again if the config was edited or the caches were cleared in the meantime.
+        if (revision == getImpl()->m_revision && generation == getImpl()->m_cacheidsGeneration)
+        {
+            // Another thread may have already added the same cache identifier.
+            auto res = getImpl()->m_cacheids.emplace(contextcacheid,
+                                                     cacheidnocontext + ":" + fileReferencesFashHash);
+            return res.first->second.c_str();
+        }
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////
@@ -2500,6 +2849,14 @@ void Config::serialize(std::ostream& os) const
     }
 }
 
+void Config::writeSnapshot(std::ostream & os, SnapshotFlags flags) const
+{
+    ConstTransformVec allTransforms;
+    getImpl()->getAllInternalTransforms(allTransforms);
+
+    WriteConfigSnapshot(os, *this, allTransforms, flags);
+}
+
 
 ///////////////////////////////////////////////////////////////////////////
 //  Config::Impl
@@ -2564,10 +2921,92 @@ void Config::Impl::resetCacheIDs()
 {
     m_cacheids.clear();
     m_cacheidnocontext = "";
+    m_revision = NextConfigRevision();
     m_sanity = SANITY_UNKNOWN;
     m_sanitytext = "";
 }
 
+template<typename T>
+const Config::Impl::ElementCacheID &
+Config::Impl::getElementCacheID(const std::shared_ptr<T> & element,
+                                ElementCacheIDMap & elementCacheIDs) const
+{
+    ElementCacheID & entry = elementCacheIDs[element.get()];
+
+    auto iter = m_elementCacheIDs.find(element.get());
+    if (iter != m_elementCacheIDs.end())
+    {
+        entry = iter->second;
+    }
+    else
+    {
+        const std::shared_ptr<const T> constElement = element;
+
+        std::ostringstream os;
+        OCIOYaml::Write(os, constElement);
+        const std::string str = os.str();
+
+        entry.m_element = element;
+        entry.m_cacheID = CacheIDHash(str.c_str(), str.size());
+        GetElementFileReferences(entry.m_files, constElement);
+    }
+
+    return entry;
+}
+
+void Config::Impl::updateCacheIDNoContext(const Config & config) const
+{
+    // Only keep the entries of the current elements.
+    ElementCacheIDMap elementCacheIDs;
+    std::set<std::string> files;
+
+    CacheIDHasher hasher;
+
+    try
+    {
+        std::ostringstream header;
+        OCIOYaml::WriteHeader(header, &config);
+        hasher.append(header.str());
+
+        hasher.append("looks:");
+        for (const auto & look : m_looksList)
+        {
+            const ElementCacheID & entry = getElementCacheID(look, elementCacheIDs);
+            hasher.append(entry.m_cacheID);
+            files.insert(entry.m_files.begin(), entry.m_files.end());
+        }
+
+        hasher.append("view_transforms:");
+        for (const auto & vt : m_viewTransforms)
+        {
+            const ElementCacheID & entry = getElementCacheID(vt, elementCacheIDs);
+            hasher.append(entry.m_cacheID);
+            files.insert(entry.m_files.begin(), entry.m_files.end());
+        }
+
+        hasher.append("colorspaces:");
+        for (int i = 0; i < m_allColorSpaces->getNumColorSpaces(); ++i)
+        {
+            const ElementCacheID & entry
+                = getElementCacheID(m_allColorSpaces->getColorSpaceByIndex(i), elementCacheIDs);
+            hasher.append(entry.m_cacheID);
+            files.insert(entry.m_files.begin(), entry.m_files.end());
+        }
+    }
+    catch (const std::exception & e)
+    {
+        std::ostringstream error;
+        error << "Error building YAML: " << e.what();
+        throw Exception(error.str().c_str());
+    }
+
+    m_elementCacheIDs.swap(elementCacheIDs);
+
+    files.erase("");
+    m_fileReferences.assign(files.begin(), files.end());
+    m_cacheidnocontext = hasher.getPrintableHash();
+}
+
 void Config::Impl::getAllInternalTransforms(ConstTransformVec & transformVec) const
 {
     // Grab all transforms from the ColorSpaces.
@@ -2623,10 +3062,10 @@ void Config::Impl::getAllInternalTransforms(ConstTransformVec & transformVec) co
     }
 }
 
-ConstConfigRcPtr Config::Impl::Read(std::istream & istream, const char * filename)
+ConfigRcPtr Config::Impl::Read(std::istream & istream, const char * filename, bool lazyLoading)
 {
     ConfigRcPtr config = Config::Create();
-    OCIOYaml::Read(istream, config, filename);
+    OCIOYaml::Read(istream, config, filename, lazyLoading);
 
     // An API request always supersedes the env. variable. As the OCIOYaml helper methods
     // use the Config public API, the variable reset highlights that only the
@@ -2637,5 +3076,30 @@ ConstConfigRcPtr Config::Impl::Read(std::istream & istream, const char * filenam
     return config;
 }
 
+ConstConfigRcPtr Config::Impl::ReadSnapshot(std::istream & istream, const char * filename)
+{
+    ConfigSnapshot snapshot;
+    try
+    {
+        ReadConfigSnapshot(istream, snapshot);
+    }
+    catch (const Exception & e)
+    {
+        std::ostringstream os;
+        os << "Error: Loading the OCIO config snapshot ";
+        if (filename) os << "'" << filename << "' ";
+        os << "failed. " << e.what();
+        throw Exception(os.str().c_str());
+    }
+
+    // The file transforms are only loaded when needed as most of them are never used by a
+    // given process (and the file ops are already in the caches).
+    std::istringstream yaml(snapshot.m_config);
+    ConfigRcPtr config = Read(yaml, filename, true);
+    config->setWorkingDir(snapshot.m_workingDir.c_str());
+
+    return config;
+}
+
 } // namespace OCIO_NAMESPACE
 
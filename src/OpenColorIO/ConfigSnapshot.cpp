@@ -0,0 +1,969 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <initializer_list>
+#include <iterator>
+#include <map>
+#include <random>
+#include <set>
+#include <sstream>
+#include <vector>
+
+#include <OpenColorIO/OpenColorIO.h>
+
+#include "ConfigSnapshot.h"
+#include "fileformats/FormatMetadata.h"
+#include "HashUtils.h"
+#include "Logging.h"
+#include "Mutex.h"
+#include "OpBuilders.h"
+#include "ops/cdl/CDLOpData.h"
+#include "ops/lut1d/Lut1DOpData.h"
+#include "ops/lut3d/Lut3DOpData.h"
+#include "ops/matrix/MatrixOpData.h"
+#include "ops/noop/NoOps.h"
+#include "ops/range/RangeOpData.h"
+#include "PathUtils.h"
+#include "Platform.h"
+#include "pystring/pystring.h"
+#include "utils/StringUtils.h"
+
+
+namespace OCIO_NAMESPACE
+{
+namespace
+{
+
+const char SnapshotMagic[8] = { 'O', 'C', 'I', 'O', 'S', 'N', 'A', 'P' };
+const uint32_t SnapshotVersion = 1;
+// Written in the native byte order to detect a snapshot from a different platform.
+const uint32_t SnapshotByteOrder = 0x01020304;
+
+// A LUT store file holds a single file entry.
+const char LutStoreMagic[8] = { 'O', 'C', 'I', 'O', 'L', 'U', 'T', 'S' };
+
+constexpr static const char * OCIO_LUT_STORE_DIR_ENVVAR = "OCIO_LUT_STORE_DIR";
+
+class SnapshotWriter
+{
+public:
+    explicit SnapshotWriter(std::ostream & os) : m_os(os) {}
+
+    void writeUInt(uint32_t value)
+    {
+        write(&value, sizeof(value));
+    }
+
+    void writeDoubles(const double * values, size_t numValues)
+    {
+        write(values, numValues * sizeof(double));
+    }
+
+    void writeString(const std::string & str)
+    {
+        writeUInt(static_cast<uint32_t>(str.size()));
+        write(str.data(), str.size());
+    }
+
+    template<typename T>
+    void writeValues(const std::vector<T> & values)
+    {
+        writeUInt(static_cast<uint32_t>(values.size()));
+        write(values.data(), values.size() * sizeof(T));
+    }
+
+    void write(const void * data, size_t size)
+    {
+        m_os.write(reinterpret_cast<const char *>(data), size);
+    }
+
+private:
+    std::ostream & m_os;
+};
+
+// The snapshot is read from a single buffer where the values are directly copied (i.e. there
+// is no text parsing at all).
+class SnapshotReader
+{
+public:
+    SnapshotReader(const char * data, size_t size) : m_data(data), m_size(size) {}
+
+    uint32_t readUInt()
+    {
+        uint32_t value = 0;
+        std::memcpy(&value, read(sizeof(value)), sizeof(value));
+        return value;
+    }
+
+    void readDoubles(double * values, size_t numValues)
+    {
+        std::memcpy(values, read(numValues * sizeof(double)), numValues * sizeof(double));
+    }
+
+    std::string readString()
+    {
+        const uint32_t size = readUInt();
+        return std::string(read(size), size);
+    }
+
+    // The number of values must match the size of the vector.
+    template<typename T>
+    void readValues(std::vector<T> & values)
+    {
+        const uint32_t numValues = readUInt();
+        if (numValues != values.size())
+        {
+            throw Exception("The config snapshot holds an invalid LUT size.");
+        }
+        std::memcpy(values.data(), read(numValues * sizeof(T)), numValues * sizeof(T));
+    }
+
+    // Throw if the remaining data cannot hold the values of the dimensions (i.e. the number of
+    // values is their product), to check a size before allocating the values.
+    void checkValues(std::initializer_list<uint32_t> dims, size_t valueSize) const
+    {
+        // Divide instead of multiplying the dimensions to avoid any overflow.
+        size_t capacity = (m_size - m_pos) / valueSize;
+        for (const uint32_t dim : dims)
+        {
+            if (dim == 0)
+            {
+                return;
+            }
+            capacity /= dim;
+        }
+
+        if (capacity == 0)
+        {
+            throw Exception("The config snapshot is truncated or corrupted.");
+        }
+    }
+
+    SnapshotReader readSection()
+    {
+        const uint32_t size = readUInt();
+        return SnapshotReader(read(size), size);
+    }
+
+    const char * read(size_t size)
+    {
+        if (size > m_size - m_pos)
+        {
+            throw Exception("The config snapshot is truncated or corrupted.");
+        }
+        const char * data = m_data + m_pos;
+        m_pos += size;
+        return data;
+    }
+
+private:
+    const char * m_data;
+    size_t m_size;
+    size_t m_pos = 0;
+};
+
+void WriteMetadata(SnapshotWriter & writer, const FormatMetadataImpl & metadata)
+{
+    writer.writeString(metadata.getName());
+    writer.writeString(metadata.getValue());
+
+    const FormatMetadataImpl::Attributes & attributes = metadata.getAttributes();
+    writer.writeUInt(static_cast<uint32_t>(attributes.size()));
+    for (const auto & attribute : attributes)
+    {
+        writer.writeString(attribute.first);
+        writer.writeString(attribute.second);
+    }
+
+    const FormatMetadataImpl::Elements & elements = metadata.getChildrenElements();
+    writer.writeUInt(static_cast<uint32_t>(elements.size()));
+    for (const auto & element : elements)
+    {
+        WriteMetadata(writer, element);
+    }
+}
+
+void ReadMetadata(SnapshotReader & reader, FormatMetadataImpl & metadata)
+{
+    metadata.setName(reader.readString());
+    metadata.setValue(reader.readString());
+
+    const uint32_t numAttributes = reader.readUInt();
+    for (uint32_t idx = 0; idx < numAttributes; ++idx)
+    {
+        const std::string name = reader.readString();
+        const std::string value = reader.readString();
+        metadata.addAttribute(name.c_str(), value.c_str());
+    }
+
+    const uint32_t numElements = reader.readUInt();
+    for (uint32_t idx = 0; idx < numElements; ++idx)
+    {
+        FormatMetadataImpl element;
+        ReadMetadata(reader, element);
+        metadata.getChildrenElements().push_back(element);
+    }
+}
+
+// Only the ops produced by the LUT & CDL file formats are supported.
+bool IsSupported(const ConstOpDataRcPtr & data)
+{
+    switch (data->getType())
+    {
+        case OpData::CDLType:
+        case OpData::Lut1DType:
+        case OpData::Lut3DType:
+        case OpData::MatrixType:
+        case OpData::RangeType:
+            return true;
+        case OpData::ExponentType:
+        case OpData::ExposureContrastType:
+        case OpData::FixedFunctionType:
+        case OpData::GammaType:
+        case OpData::LogType:
+        case OpData::ReferenceType:
+        case OpData::NoOpType:
+            break;
+    }
+
+    return false;
+}
+
+void WriteOpData(SnapshotWriter & writer, const ConstOpDataRcPtr & data)
+{
+    writer.writeUInt(data->getType());
+    WriteMetadata(writer, data->getFormatMetadata());
+
+    switch (data->getType())
+    {
+        case OpData::CDLType:
+        {
+            auto cdl = DynamicPtrCast<const CDLOpData>(data);
+            writer.writeUInt(cdl->getStyle());
+            writer.writeDoubles(cdl->getSlopeParams().data(), 4);
+            writer.writeDoubles(cdl->getOffsetParams().data(), 4);
+            writer.writeDoubles(cdl->getPowerParams().data(), 4);
+            const double saturation = cdl->getSaturation();
+            writer.writeDoubles(&saturation, 1);
+            break;
+        }
+        case OpData::Lut1DType:
+        {
+            auto lut = DynamicPtrCast<const Lut1DOpData>(data);
+            writer.writeUInt(lut->getHalfFlags());
+            writer.writeUInt(lut->getArray().getLength());
+            writer.writeUInt(lut->getArray().getNumColorComponents());
+            writer.writeUInt(lut->getInterpolation());
+            writer.writeUInt(lut->getDirection());
+            writer.writeUInt(lut->getInversionQuality());
+            writer.writeUInt(lut->getHueAdjust());
+            writer.writeUInt(lut->getFileOutputBitDepth());
+            writer.writeValues(lut->getArray().getValues());
+            break;
+        }
+        case OpData::Lut3DType:
+        {
+            auto lut = DynamicPtrCast<const Lut3DOpData>(data);
+            writer.writeUInt(lut->getGridSize());
+            writer.writeUInt(lut->getInterpolation());
+            writer.writeUInt(lut->getDirection());
+            writer.writeUInt(lut->getInversionQuality());
+            writer.writeUInt(lut->getFileOutputBitDepth());
+            writer.writeValues(lut->getArray().getValues());
+            break;
+        }
+        case OpData::MatrixType:
+        {
+            auto matrix = DynamicPtrCast<const MatrixOpData>(data);
+            writer.writeValues(matrix->getArray().getValues());
+            writer.writeDoubles(matrix->getOffsets().getValues(), 4);
+            writer.writeUInt(matrix->getFileInputBitDepth());
+            writer.writeUInt(matrix->getFileOutputBitDepth());
+            break;
+        }
+        case OpData::RangeType:
+        {
+            auto range = DynamicPtrCast<const RangeOpData>(data);
+            const double values[4] = { range->getMinInValue(), range->getMaxInValue(),
+                                       range->getMinOutValue(), range->getMaxOutValue() };
+            writer.writeDoubles(values, 4);
+            writer.writeUInt(range->getFileInputBitDepth());
+            writer.writeUInt(range->getFileOutputBitDepth());
+            break;
+        }
+        case OpData::ExponentType:
+        case OpData::ExposureContrastType:
+        case OpData::FixedFunctionType:
+        case OpData::GammaType:
+        case OpData::LogType:
+        case OpData::ReferenceType:
+        case OpData::NoOpType:
+            throw Exception("Unsupported op type in a config snapshot.");
+    }
+}
+
+OpDataRcPtr ReadOpData(SnapshotReader & reader)
+{
+    const OpData::Type type = static_cast<OpData::Type>(reader.readUInt());
+
+    FormatMetadataImpl metadata;
+    ReadMetadata(reader, metadata);
+
+    OpDataRcPtr data;
+    switch (type)
+    {
+        case OpData::CDLType:
+        {
+            const CDLOpData::Style style = static_cast<CDLOpData::Style>(reader.readUInt());
+            double values[13];
+            reader.readDoubles(values, 13);
+            data = std::make_shared<CDLOpData>(
+                style,
+                CDLOpData::ChannelParams(values[0], values[1], values[2], values[3]),
+                CDLOpData::ChannelParams(values[4], values[5], values[6], values[7]),
+                CDLOpData::ChannelParams(values[8], values[9], values[10], values[11]),
+                values[12]);
+            break;
+        }
+        case OpData::Lut1DType:
+        {
+            const auto halfFlags = static_cast<Lut1DOpData::HalfFlags>(reader.readUInt());
+            const uint32_t length = reader.readUInt();
+            const uint32_t numColorComponents = reader.readUInt();
+            reader.checkValues({ length, numColorComponents }, sizeof(float));
+
+            auto lut = std::make_shared<Lut1DOpData>(halfFlags, length);
+            lut->setInterpolation(static_cast<Interpolation>(reader.readUInt()));
+            lut->setDirection(static_cast<TransformDirection>(reader.readUInt()));
+            lut->setInversionQuality(static_cast<LutInversionQuality>(reader.readUInt()));
+            lut->setHueAdjust(static_cast<Lut1DHueAdjust>(reader.readUInt()));
+            lut->setFileOutputBitDepth(static_cast<BitDepth>(reader.readUInt()));
+            lut->getArray().resize(length, numColorComponents);
+            reader.readValues(lut->getArray().getValues());
+            data = lut;
+            break;
+        }
+        case OpData::Lut3DType:
+        {
+            const uint32_t gridSize = reader.readUInt();
+            const Interpolation interpolation = static_cast<Interpolation>(reader.readUInt());
+            reader.checkValues({ gridSize, gridSize, gridSize, 3 }, sizeof(float));
+
+            auto lut = std::make_shared<Lut3DOpData>(interpolation, gridSize);
+            lut->setDirection(static_cast<TransformDirection>(reader.readUInt()));
+            lut->setInversionQuality(static_cast<LutInversionQuality>(reader.readUInt()));
+            lut->setFileOutputBitDepth(static_cast<BitDepth>(reader.readUInt()));
+            reader.readValues(lut->getArray().getValues());
+            data = lut;
+            break;
+        }
+        case OpData::MatrixType:
+        {
+            auto matrix = std::make_shared<MatrixOpData>();
+            reader.readValues(matrix->getArray().getValues());
+            reader.readDoubles(matrix->getOffsets().getValues(), 4);
+            matrix->setFileInputBitDepth(static_cast<BitDepth>(reader.readUInt()));
+            matrix->setFileOutputBitDepth(static_cast<BitDepth>(reader.readUInt()));
+            data = matrix;
+            break;
+        }
+        case OpData::RangeType:
+        {
+            double values[4];
+            reader.readDoubles(values, 4);
+            auto range = std::make_shared<RangeOpData>(values[0], values[1], values[2], values[3]);
+            range->setFileInputBitDepth(static_cast<BitDepth>(reader.readUInt()));
+            range->setFileOutputBitDepth(static_cast<BitDepth>(reader.readUInt()));
+            data = range;
+            break;
+        }
+        case OpData::ExponentType:
+        case OpData::ExposureContrastType:
+        case OpData::FixedFunctionType:
+        case OpData::GammaType:
+        case OpData::LogType:
+        case OpData::ReferenceType:
+        case OpData::NoOpType:
+            break;
+    }
+
+    // Note: Also covers the unknown types of a corrupted snapshot.
+    if (!data)
+    {
+        throw Exception("The config snapshot holds an unsupported op type.");
+    }
+
+    data->getFormatMetadata() = metadata;
+    return data;
+}
+
+struct SnapshotFileEntry
+{
+    std::string m_path;
+    // The fast hash of the file when the snapshot was written.
+    std::string m_hash;
+    // The ops in the forward direction of the file transform.
+    ConstOpDataVec m_ops;
+};
+
+typedef std::map<std::string, SnapshotFileEntry> SnapshotFileMap;
+
+Mutex g_snapshotFilesMutex;
+SnapshotFileMap g_snapshotFiles;
+
+void ReadFileEntry(SnapshotReader & reader, std::string & key, SnapshotFileEntry & entry)
+{
+    key = reader.readString();
+    entry.m_path = reader.readString();
+    entry.m_hash = reader.readString();
+
+    const uint32_t numOps = reader.readUInt();
+    for (uint32_t idx = 0; idx < numOps; ++idx)
+    {
+        entry.m_ops.push_back(ReadOpData(reader));
+    }
+}
+
+void CreateFileOps(OpRcPtrVec & ops, const SnapshotFileEntry & entry, TransformDirection dir)
+{
+    OpRcPtrVec fileOps;
+    for (const auto & data : entry.m_ops)
+    {
+        CreateOpVecFromOpData(fileOps, data, TRANSFORM_DIR_FORWARD);
+    }
+
+    if (dir == TRANSFORM_DIR_INVERSE)
+    {
+        fileOps = fileOps.invert();
+    }
+
+    ops += fileOps;
+}
+
+// The file ops (i.e. the ops following the FileNoOp) must be identical including the metadata.
+bool AreSameFileOps(const OpRcPtrVec & ops, const OpRcPtrVec & fileOps)
+{
+    if (fileOps.size() != ops.size() + 1)
+    {
+        return false;
+    }
+
+    for (size_t idx = 0; idx < ops.size(); ++idx)
+    {
+        ConstOpRcPtr op = ops[idx];
+        ConstOpRcPtr fileOp = fileOps[idx + 1];
+        if (!(*op->data() == *fileOp->data())
+            || !(op->data()->getFormatMetadata() == fileOp->data()->getFormatMetadata()))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+std::string CreateKey(const std::string & filepath,
+                      const ConstContextRcPtr & context,
+                      const FileTransform & fileTransform)
+{
+    std::ostringstream oss;
+    oss << filepath
+        << " interpolation=" << InterpolationToString(fileTransform.getInterpolation())
+        << " cccid=" << context->resolveStringVar(fileTransform.getCCCId())
+        << " cdl_style=" << CDLStyleToString(fileTransform.getCDLStyle());
+    return oss.str();
+}
+
+// Return false if the file ops could not be saved (e.g. unsupported op types).
+bool CreateFileEntry(std::string & entry,
+                     const Config & config,
+                     const ConstContextRcPtr & context,
+                     const FileTransform & fileTransform,
+                     const std::string & filepath,
+                     const std::string & hash)
+{
+    // The ops are saved in the forward direction of the file.
+    FileTransformRcPtr forwardTransform
+        = DynamicPtrCast<FileTransform>(fileTransform.createEditableCopy());
+    forwardTransform->setDirection(TRANSFORM_DIR_FORWARD);
+
+    OpRcPtrVec forwardOps;
+    OpRcPtrVec inverseOps;
+    try
+    {
+        BuildFileTransformOps(forwardOps, config, context, *forwardTransform,
+                              TRANSFORM_DIR_FORWARD);
+        BuildFileTransformOps(inverseOps, config, context, *forwardTransform,
+                              TRANSFORM_DIR_INVERSE);
+    }
+    catch (const Exception &)
+    {
+        return false;
+    }
+
+    // Only one FileNoOp is expected i.e. files referencing other files are not supported.
+    if (forwardOps.empty())
+    {
+        return false;
+    }
+
+    ConstOpRcPtr fileNoOp = forwardOps[0];
+    if (!DynamicPtrCast<const FileNoOpData>(fileNoOp->data()))
+    {
+        return false;
+    }
+
+    for (size_t idx = 1; idx < forwardOps.size(); ++idx)
+    {
+        ConstOpRcPtr op = forwardOps[idx];
+        if (op->isNoOpType() || !IsSupported(op->data()))
+        {
+            return false;
+        }
+    }
+
+    std::ostringstream oss;
+    SnapshotWriter writer(oss);
+    writer.writeString(CreateKey(filepath, context, fileTransform));
+    writer.writeString(filepath);
+    writer.writeString(hash);
+    writer.writeUInt(static_cast<uint32_t>(forwardOps.size() - 1));
+    for (size_t idx = 1; idx < forwardOps.size(); ++idx)
+    {
+        ConstOpRcPtr op = forwardOps[idx];
+        WriteOpData(writer, op->data());
+    }
+    entry = oss.str();
+
+    // The ops read back must be identical to the ones built from the file in both directions.
+
+    SnapshotReader reader(entry.data(), entry.size());
+    std::string key;
+    SnapshotFileEntry fileEntry;
+    ReadFileEntry(reader, key, fileEntry);
+
+    OpRcPtrVec ops;
+    CreateFileOps(ops, fileEntry, TRANSFORM_DIR_FORWARD);
+    if (!AreSameFileOps(ops, forwardOps))
+    {
+        return false;
+    }
+
+    ops.clear();
+    CreateFileOps(ops, fileEntry, TRANSFORM_DIR_INVERSE);
+    return AreSameFileOps(ops, inverseOps);
+}
+
+Mutex g_lutStoreMutex;
+// The file entries (i.e. key & file hash) not to be read from or written to the LUT store by
+// this process because they are being written, or could not be saved.
+std::set<std::string> g_lutStoreSkippedEntries;
+
+// You must manually acquire the g_lutStoreMutex.
+std::string & LutStoreDirectory()
+{
+    static std::string dirname = []()
+    {
+        std::string value;
+        Platform::Getenv(OCIO_LUT_STORE_DIR_ENVVAR, value);
+        return StringUtils::Trim(value);
+    }();
+    return dirname;
+}
+
+// The LUT store file name is the hash of the file entry key and of the file hash, so a
+// modified file gets a new LUT store file.
+std::string GetLutStoreFilepath(const std::string & dirname,
+                                const std::string & key,
+                                const std::string & hash)
+{
+    CacheIDHasher hasher;
+    hasher.append(key);
+    hasher.append(" hash=");
+    hasher.append(hash);
+
+    // Skip the leading '$' of the printable hash.
+    return pystring::os::path::join(dirname, hasher.getPrintableHash().substr(1) + ".ocioluts");
+}
+
+bool IsLutStoreEntrySkipped(const std::string & key, const std::string & hash)
+{
+    AutoMutex lock(g_lutStoreMutex);
+    return g_lutStoreSkippedEntries.find(key + " hash=" + hash) != g_lutStoreSkippedEntries.end();
+}
+
+// Read the file entry from the LUT store. Return false if it is not in the store (or not valid).
+bool ReadLutStoreFileEntry(const std::string & filepath,
+                           const std::string & key,
+                           SnapshotFileEntry & entry)
+{
+    const std::string dirname = GetLutStoreDirectory();
+    if (dirname.empty())
+    {
+        return false;
+    }
+
+    const std::string hash = GetFastFileHash(filepath);
+    if (hash.empty() || IsLutStoreEntrySkipped(key, hash))
+    {
+        return false;
+    }
+
+    // The file is mapped instead of read to avoid an intermediate buffer, the op values are
+    // then copied in the memory of the process.
+    const char * data = nullptr;
+    size_t size = 0;
+    if (!Platform::MapFile(GetLutStoreFilepath(dirname, key, hash), data, size))
+    {
+        return false;
+    }
+
+    bool valid = false;
+    try
+    {
+        SnapshotReader reader(data, size);
+        if (std::memcmp(reader.read(sizeof(LutStoreMagic)), LutStoreMagic,
+                        sizeof(LutStoreMagic)) == 0
+            && reader.readUInt() == SnapshotVersion
+            && reader.readUInt() == SnapshotByteOrder)
+        {
+            std::string entryKey;
+            ReadFileEntry(reader, entryKey, entry);
+            valid = (entryKey == key && entry.m_hash == hash);
+        }
+    }
+    catch (const Exception &)
+    {
+    }
+
+    Platform::UnmapFile(data, size);
+
+    if (!valid)
+    {
+        std::ostringstream oss;
+        oss << "Ignoring the invalid LUT store file of '" << filepath << "'.";
+        LogDebug(oss.str());
+    }
+
+    return valid;
+}
+
+void GetFileTransforms(std::vector<ConstFileTransformRcPtr> & fileTransforms,
+                       const ConstTransformRcPtr & transform)
+{
+    if (ConstGroupTransformRcPtr group = DynamicPtrCast<const GroupTransform>(transform))
+    {
+        for (int idx = 0; idx < group->getNumTransforms(); ++idx)
+        {
+            GetFileTransforms(fileTransforms, group->getTransform(idx));
+        }
+    }
+    else if (ConstFileTransformRcPtr file = DynamicPtrCast<const FileTransform>(transform))
+    {
+        fileTransforms.push_back(file);
+    }
+}
+
+} // anon.
+
+void WriteConfigSnapshot(std::ostream & os,
+                         const Config & config,
+                         const ConstTransformVec & allTransforms,
+                         SnapshotFlags flags)
+{
+    std::ostringstream yaml;
+    config.serialize(yaml);
+
+    ConstContextRcPtr context = config.getCurrentContext();
+
+    std::vector<ConstFileTransformRcPtr> fileTransforms;
+    for (const auto & transform : allTransforms)
+    {
+        GetFileTransforms(fileTransforms, transform);
+    }
+
+    std::map<std::string, std::string> fileHashes;
+    std::set<std::string> keys;
+    std::vector<std::string> fileEntries;
+
+    for (const auto & fileTransform : fileTransforms)
+    {
+        std::string filepath;
+        try
+        {
+            filepath = context->resolveFileLocation(fileTransform->getSrc());
+        }
+        catch (const Exception &)
+        {
+            continue;
+        }
+
+        const std::string hash = GetFastFileHash(filepath);
+        if (hash.empty())
+        {
+            continue;
+        }
+        fileHashes[filepath] = hash;
+
+        if ((flags & SNAPSHOT_FILE_OPS)
+            && keys.insert(CreateKey(filepath, context, *fileTransform)).second)
+        {
+            std::string entry;
+            if (CreateFileEntry(entry, config, context, *fileTransform, filepath, hash))
+            {
+                fileEntries.push_back(entry);
+            }
+        }
+    }
+
+    if (!(flags & SNAPSHOT_FILE_HASHES))
+    {
+        fileHashes.clear();
+    }
+
+    SnapshotWriter writer(os);
+    writer.write(SnapshotMagic, sizeof(SnapshotMagic));
+    writer.writeUInt(SnapshotVersion);
+    writer.writeUInt(SnapshotByteOrder);
+    writer.writeUInt(static_cast<uint32_t>(flags));
+
+    writer.writeString(yaml.str());
+    writer.writeString(config.getWorkingDir());
+
+    writer.writeUInt(static_cast<uint32_t>(fileHashes.size()));
+    for (const auto & fileHash : fileHashes)
+    {
+        writer.writeString(fileHash.first);
+        writer.writeString(fileHash.second);
+    }
+
+    writer.writeUInt(static_cast<uint32_t>(fileEntries.size()));
+    for (const auto & entry : fileEntries)
+    {
+        writer.writeString(entry);
+    }
+}
+
+void ReadConfigSnapshot(std::istream & is, ConfigSnapshot & snapshot)
+{
+    const std::string buffer((std::istreambuf_iterator<char>(is)),
+                             std::istreambuf_iterator<char>());
+
+    SnapshotReader reader(buffer.data(), buffer.size());
+
+    if (buffer.size() < sizeof(SnapshotMagic)
+        || std::memcmp(reader.read(sizeof(SnapshotMagic)), SnapshotMagic,
+                       sizeof(SnapshotMagic)) != 0)
+    {
+        throw Exception("The stream is not a config snapshot.");
+    }
+
+    const uint32_t version = reader.readUInt();
+    if (version != SnapshotVersion)
+    {
+        std::ostringstream oss;
+        oss << "Unsupported config snapshot version: " << version << ".";
+        throw Exception(oss.str().c_str());
+    }
+
+    if (reader.readUInt() != SnapshotByteOrder)
+    {
+        throw Exception("The config snapshot was written on a platform with a different "
+                        "byte order.");
+    }
+
+    // The flags are informative only.
+    reader.readUInt();
+
+    snapshot.m_config     = reader.readString();
+    snapshot.m_workingDir = reader.readString();
+
+    std::map<std::string, std::string> fileHashes;
+    const uint32_t numFileHashes = reader.readUInt();
+    for (uint32_t idx = 0; idx < numFileHashes; ++idx)
+    {
+        const std::string filepath = reader.readString();
+        fileHashes[filepath] = reader.readString();
+    }
+
+    SnapshotFileMap files;
+    const uint32_t numFileEntries = reader.readUInt();
+    for (uint32_t idx = 0; idx < numFileEntries; ++idx)
+    {
+        SnapshotReader entryReader = reader.readSection();
+
+        std::string key;
+        SnapshotFileEntry entry;
+        ReadFileEntry(entryReader, key, entry);
+        files[key] = entry;
+    }
+
+    // Only register a fully read snapshot.
+
+    for (const auto & fileHash : fileHashes)
+    {
+        SetFastFileHash(fileHash.first, fileHash.second);
+    }
+
+    AutoMutex lock(g_snapshotFilesMutex);
+    for (const auto & file : files)
+    {
+        g_snapshotFiles[file.first] = file.second;
+    }
+}
+
+bool BuildConfigSnapshotFileOps(OpRcPtrVec & ops,
+                                const std::string & filepath,
+                                const ConstContextRcPtr & context,
+                                const FileTransform & fileTransform,
+                                TransformDirection dir)
+{
+    const TransformDirection fileDir = CombineTransformDirections(dir,
+                                                                  fileTransform.getDirection());
+    if (fileDir == TRANSFORM_DIR_UNKNOWN)
+    {
+        return false;
+    }
+
+    const bool useLutStore = !GetLutStoreDirectory().empty();
+    {
+        AutoMutex lock(g_snapshotFilesMutex);
+        if (g_snapshotFiles.empty() && !useLutStore)
+        {
+            return false;
+        }
+    }
+
+    const std::string key = CreateKey(filepath, context, fileTransform);
+
+    SnapshotFileEntry entry;
+    bool found = false;
+    {
+        AutoMutex lock(g_snapshotFilesMutex);
+
+        auto iter = g_snapshotFiles.find(key);
+        if (iter != g_snapshotFiles.end())
+        {
+            // Only the op data pointers are copied.
+            entry = iter->second;
+            found = true;
+        }
+    }
+
+    // Note: The LUT store entries are not kept in memory (i.e. the file cache limit applies),
+    // they are read again from the mapped file instead.
+    if (!found && (!useLutStore || !ReadLutStoreFileEntry(filepath, key, entry)))
+    {
+        return false;
+    }
+
+    // Ignore the snapshot if the file changed since.
+    if (entry.m_hash != GetFastFileHash(entry.m_path))
+    {
+        return false;
+    }
+
+    CreateFileOps(ops, entry, fileDir);
+    return true;
+}
+
+void SaveLutStoreFileOps(const Config & config,
+                         const ConstContextRcPtr & context,
+                         const FileTransform & fileTransform,
+                         const std::string & filepath)
+{
+    const std::string dirname = GetLutStoreDirectory();
+    if (dirname.empty())
+    {
+        return;
+    }
+
+    const std::string hash = GetFastFileHash(filepath);
+    if (hash.empty())
+    {
+        return;
+    }
+
+    const std::string key = CreateKey(filepath, context, fileTransform);
+
+    // Note: Creating the file entry builds the file ops again so the entry must already be
+    // skipped to avoid a recursion.
+    {
+        AutoMutex lock(g_lutStoreMutex);
+        if (!g_lutStoreSkippedEntries.insert(key + " hash=" + hash).second)
+        {
+            return;
+        }
+    }
+
+    std::string entry;
+    if (!CreateFileEntry(entry, config, context, fileTransform, filepath, hash))
+    {
+        return;
+    }
+
+    // Another process could write the same file so a temporary file is renamed once complete.
+    const std::string storeFilepath = GetLutStoreFilepath(dirname, key, hash);
+    std::ostringstream tmpFilepath;
+    tmpFilepath << storeFilepath << "." << std::random_device{}() << ".tmp";
+
+    bool saved = false;
+    {
+        std::ofstream os(tmpFilepath.str().c_str(), std::ios_base::out | std::ios_base::binary);
+        if (os.good())
+        {
+            SnapshotWriter writer(os);
+            writer.write(LutStoreMagic, sizeof(LutStoreMagic));
+            writer.writeUInt(SnapshotVersion);
+            writer.writeUInt(SnapshotByteOrder);
+            writer.write(entry.data(), entry.size());
+            os.close();
+            saved = !os.fail();
+        }
+    }
+
+    if (!saved || std::rename(tmpFilepath.str().c_str(), storeFilepath.c_str()) != 0)
+    {
+        std::remove(tmpFilepath.str().c_str());
+
+        std::ostringstream oss;
+        oss << "The LUT store file '" << storeFilepath << "' of '" << filepath
+            << "' could not be written.";
+        LogDebug(oss.str());
+    }
+}
+
+void SetLutStoreDirectory(const char * dirname)
+{
+    AutoMutex lock(g_lutStoreMutex);
+    LutStoreDirectory() = StringUtils::Trim(dirname ? dirname : "");
+    g_lutStoreSkippedEntries.clear();
+}
+
+std::string GetLutStoreDirectory()
+{
+    AutoMutex lock(g_lutStoreMutex);
+    return LutStoreDirectory();
+}
+
+void ClearConfigSnapshotCache()
+{
+    {
+        AutoMutex lock(g_snapshotFilesMutex);
+        g_snapshotFiles.clear();
+    }
+
+    AutoMutex lock(g_lutStoreMutex);
+    g_lutStoreSkippedEntries.clear();
+}
+
+size_t GetConfigSnapshotCacheSize()
+{
+    AutoMutex lock(g_snapshotFilesMutex);
+    return g_snapshotFiles.size();
+}
+
+} // namespace OCIO_NAMESPACE
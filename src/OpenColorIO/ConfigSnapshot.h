@@ -0,0 +1,69 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+
+#ifndef INCLUDED_OCIO_CONFIGSNAPSHOT_H
+#define INCLUDED_OCIO_CONFIGSNAPSHOT_H
+
+#include <string>
+
+#include <OpenColorIO/OpenColorIO.h>
+
+#include "Op.h"
+#include "PrivateTypes.h"
+
+
+namespace OCIO_NAMESPACE
+{
+
+// A config snapshot is a binary file holding the serialized config and, optionally, the
+// already built ops of the files referenced by its FileTransforms and the fast hashes of
+// these files.  Loading a snapshot registers the file ops & hashes in process-wide caches
+// so that the LUT files are neither parsed nor queried again (until the caches are cleared).
+
+struct ConfigSnapshot
+{
+    // The config in its YAML text form.
+    std::string m_config;
+    std::string m_workingDir;
+};
+
+// Write the snapshot of the config where allTransforms are all the transforms of the config.
+void WriteConfigSnapshot(std::ostream & os,
+                         const Config & config,
+                         const ConstTransformVec & allTransforms,
+                         SnapshotFlags flags);
+
+// Read a snapshot, register its file ops & hashes and return the config part.
+// Note: Throws if the snapshot is not valid.
+void ReadConfigSnapshot(std::istream & is, ConfigSnapshot & snapshot);
+
+// If a loaded snapshot or the LUT store holds the ops of the file (for the same file transform
+// settings) and the file did not change since, append the ops in the requested direction and
+// return true.
+bool BuildConfigSnapshotFileOps(OpRcPtrVec & ops,
+                                const std::string & filepath,
+                                const ConstContextRcPtr & context,
+                                const FileTransform & fileTransform,
+                                TransformDirection dir);
+
+// The LUT store is an optional on-disk cache of the parsed LUT files (refer to
+// SetLutStoreDirectory) holding the file entries of the LUT files already loaded by one of the
+// processes using the directory. The entries are copied out when read (i.e. the memory is not
+// shared). Save the file entry of the file in the LUT store unless already there.
+void SaveLutStoreFileOps(const Config & config,
+                         const ConstContextRcPtr & context,
+                         const FileTransform & fileTransform,
+                         const std::string & filepath);
+
+// Empty if the LUT store is disabled.
+std::string GetLutStoreDirectory();
+
+void ClearConfigSnapshotCache();
+
+// Number of file entries of the loaded snapshots.
+size_t GetConfigSnapshotCacheSize();
+
+} // namespace OCIO_NAMESPACE
+
+#endif
@@ -1,17 +1,21 @@
 // SPDX-License-Identifier: BSD-3-Clause
 // Copyright Contributors to the OpenColorIO Project.
 
+#include <chrono>
 #include <cstring>
 #include <iostream>
 #include <map>
+#include <set>
 #include <sstream>
 #include <string>
 
 #include <OpenColorIO/OpenColorIO.h>
 
+#include "Caching.h"
 #include "HashUtils.h"
 #include "Mutex.h"
 #include "PathUtils.h"
+#include "Platform.h"
 #include "PrivateTypes.h"
 #include "pystring/pystring.h"
 #include "utils/StringUtils.h"
@@ -26,11 +30,52 @@ void GetAbsoluteSearchPaths(StringUtils::StringVec & searchpaths,
                             const StringUtils::StringVec & pathStrings,
                             const std::string & configRootDir,
                             const EnvMap & map);
+
+constexpr static const char * OCIO_SEARCH_PATH_LISTING_ENVVAR = "OCIO_SEARCH_PATH_LISTING";
+
+typedef std::chrono::steady_clock Clock;
+
+// Directory entry name as compared by the file system.
+std::string DirectoryEntryName(const std::string & name)
+{
+#ifdef _WIN32
+    return StringUtils::Lower(name);
+#else
+    return name;
+#endif
+}
+
 }
 
 class Context::Impl
 {
 public:
+    // When and for which file lookups generation (see ClearAllCaches) a cache entry was
+    // computed.
+    struct CacheEntryStamp
+    {
+        Clock::time_point m_time;
+        unsigned m_cachesGeneration = 0;
+    };
+
+    // The result of a file lookup, including the files not found.
+    struct FileLocation : public CacheEntryStamp
+    {
+        // Points to an element of the resolved paths so that the returned string stays valid
+        // when the entry expires.
+        const std::string * m_path = nullptr;
+        std::string m_error;
+        // The error is a missing file in the search paths.
+        bool m_missingFile = false;
+    };
+
+    struct DirectoryListing : public CacheEntryStamp
+    {
+        // False when the directory cannot be listed.
+        bool m_listed = false;
+        std::set<std::string> m_names;
+    };
+
     // New platform-agnostic search paths vector.
     StringUtils::StringVec m_searchPaths;
     // Original concatenated string search paths (keeping it for now to
@@ -44,9 +89,24 @@ public:
     mutable StringMap m_resultsCache;
     mutable Mutex m_resultsCacheMutex;
 
+    // The file lookups and the search path directory listings. Expired entries are computed
+    // again, the timeout (in seconds) being disabled when zero.
+    mutable std::map<std::string, FileLocation> m_fileLocations;
+    mutable std::set<std::string> m_resolvedPaths;
+    mutable std::map<std::string, DirectoryListing> m_directoryListings;
+    double m_fileLocationTimeout = 0.;
+    bool m_searchPathListing = false;
+
+    // The search paths made absolute.
+    mutable StringUtils::StringVec m_absSearchPaths;
+    mutable bool m_absSearchPathsValid = false;
+
     Impl() :
         m_envmode(ENV_ENVIRONMENT_LOAD_PREDEFINED)
     {
+        std::string listing;
+        Platform::Getenv(OCIO_SEARCH_PATH_LISTING_ENVVAR, listing);
+        m_searchPathListing = !listing.empty() && listing != "0";
     }
 
     ~Impl()
@@ -68,9 +128,95 @@ public:
 
             m_resultsCache = rhs.m_resultsCache;
             m_cacheID = rhs.m_cacheID;
+
+            m_resolvedPaths = rhs.m_resolvedPaths;
+            m_fileLocations = rhs.m_fileLocations;
+            for (auto & location : m_fileLocations)
+            {
+                if (location.second.m_path)
+                {
+                    location.second.m_path = &*m_resolvedPaths.find(*location.second.m_path);
+                }
+            }
+            m_directoryListings = rhs.m_directoryListings;
+            m_fileLocationTimeout = rhs.m_fileLocationTimeout;
+            m_searchPathListing = rhs.m_searchPathListing;
+
+            m_absSearchPaths = rhs.m_absSearchPaths;
+            m_absSearchPathsValid = rhs.m_absSearchPathsValid;
         }
         return *this;
     }
+
+    // Any time you modify the context, you must call this to reset the caches.  You must
+    // manually acquire the m_resultsCacheMutex.
+    void resetCaches()
+    {
+        m_resultsCache.clear();
+        m_cacheID = "";
+        m_fileLocations.clear();
+        m_resolvedPaths.clear();
+        m_directoryListings.clear();
+        m_absSearchPathsValid = false;
+    }
+
+    bool isExpired(const CacheEntryStamp & entry, const Clock::time_point & now) const
+    {
+        return entry.m_cachesGeneration != GetFileLookupsGeneration()
+               || (m_fileLocationTimeout > 0.
+                   && std::chrono::duration<double>(now - entry.m_time).count()
+                          > m_fileLocationTimeout);
+    }
+
+    const StringUtils::StringVec & getAbsoluteSearchPaths() const
+    {
+        if (!m_absSearchPathsValid)
+        {
+            m_absSearchPaths.clear();
+            GetAbsoluteSearchPaths(m_absSearchPaths, m_searchPaths, m_workingDir, m_envMap);
+            m_absSearchPathsValid = true;
+        }
+        return m_absSearchPaths;
+    }
+
+    // Check if the file exists, using the listing of its directory in the listing mode.
+    bool fileExists(const std::string & filepath, const Clock::time_point & now) const
+    {
+        if (!m_searchPathListing)
+        {
+            return FileExists(filepath);
+        }
+
+        const std::string dirname = pystring::os::path::dirname(filepath);
+
+        DirectoryListing & listing = m_directoryListings[dirname];
+        if (listing.m_time == Clock::time_point() || isExpired(listing, now))
+        {
+            listing.m_time = now;
+            listing.m_cachesGeneration = GetFileLookupsGeneration();
+            listing.m_names.clear();
+
+            StringUtils::StringVec names;
+            listing.m_listed = Platform::ListDirectory(dirname, names);
+            for (const auto & name : names)
+            {
+                listing.m_names.insert(DirectoryEntryName(name));
+            }
+        }
+
+        if (!listing.m_listed)
+        {
+            // The directory could still give access to its files.
+            return FileExists(filepath);
+        }
+
+        const std::string basename = pystring::os::path::basename(filepath);
+        return listing.m_names.find(DirectoryEntryName(basename)) != listing.m_names.end();
+    }
+
+    void resolveFileLocation(const char * filename,
+                             FileLocation & location,
+                             const Clock::time_point & now) const;
 };
 
 ///////////////////////////////////////////////////////////////////////////
@@ -143,8 +289,7 @@ void Context::setSearchPath(const char * path)
 
     getImpl()->m_searchPaths = StringUtils::Split(path, ':');
     getImpl()->m_searchPath  = path;
-    getImpl()->m_resultsCache.clear();
-    getImpl()->m_cacheID = "";
+    getImpl()->resetCaches();
 }
 
 const char * Context::getSearchPath() const
@@ -169,8 +314,7 @@ void Context::clearSearchPaths()
 
     getImpl()->m_searchPath = "";
     getImpl()->m_searchPaths.clear();
-    getImpl()->m_resultsCache.clear();
-    getImpl()->m_cacheID = "";
+    getImpl()->resetCaches();
 }
 
 void Context::addSearchPath(const char * path)
@@ -180,8 +324,7 @@ void Context::addSearchPath(const char * path)
     if (strlen(path) != 0)
     {
         getImpl()->m_searchPaths.emplace_back(path);
-        getImpl()->m_resultsCache.clear();
-        getImpl()->m_cacheID = "";
+        getImpl()->resetCaches();
 
         if (getImpl()->m_searchPath.size() != 0)
         {
@@ -196,8 +339,7 @@ void Context::setWorkingDir(const char * dirname)
     AutoMutex lock(getImpl()->m_resultsCacheMutex);
 
     getImpl()->m_workingDir = dirname;
-    getImpl()->m_resultsCache.clear();
-    getImpl()->m_cacheID = "";
+    getImpl()->resetCaches();
 }
 
 const char * Context::getWorkingDir() const
@@ -210,9 +352,7 @@ void Context::setEnvironmentMode(EnvironmentMode mode)
     AutoMutex lock(getImpl()->m_resultsCacheMutex);
 
     getImpl()->m_envmode = mode;
-
-    getImpl()->m_resultsCache.clear();
-    getImpl()->m_cacheID = "";
+    getImpl()->resetCaches();
 }
 
 EnvironmentMode Context::getEnvironmentMode() const
@@ -226,8 +366,7 @@ void Context::loadEnvironment()
     LoadEnvironment(getImpl()->m_envMap, update);
 
     AutoMutex lock(getImpl()->m_resultsCacheMutex);
-    getImpl()->m_resultsCache.clear();
-    getImpl()->m_cacheID = "";
+    getImpl()->resetCaches();
 }
 
 void Context::setStringVar(const char * name, const char * value)
@@ -251,8 +390,7 @@ void Context::setStringVar(const char * name, const char * value)
         }
     }
 
-    getImpl()->m_resultsCache.clear();
-    getImpl()->m_cacheID = "";
+    getImpl()->resetCaches();
 }
 
 const char * Context::getStringVar(const char * name) const
@@ -319,37 +457,55 @@ const char * Context::resolveFileLocation(const char * filename) const
         return "";
     }
 
-    StringMap::const_iterator iter = getImpl()->m_resultsCache.find(filename);
-    if(iter != getImpl()->m_resultsCache.end())
+    const Clock::time_point now = Clock::now();
+
+    Impl::FileLocation & location = getImpl()->m_fileLocations[filename];
+    if (location.m_time == Clock::time_point() || getImpl()->isExpired(location, now))
     {
-        return iter->second.c_str();
+        location = Impl::FileLocation();
+        location.m_time = now;
+        location.m_cachesGeneration = GetFileLookupsGeneration();
+
+        getImpl()->resolveFileLocation(filename, location, now);
+    }
+
+    if (location.m_path)
+    {
+        return location.m_path->c_str();
     }
+    else if (location.m_missingFile)
+    {
+        throw ExceptionMissingFile(location.m_error.c_str());
+    }
+
+    throw Exception(location.m_error.c_str());
+}
 
+void Context::Impl::resolveFileLocation(const char * filename,
+                                        FileLocation & location,
+                                        const Clock::time_point & now) const
+{
     // Attempt to load an absolute file reference
     {
-    std::string expandedfullpath = EnvExpand(filename, getImpl()->m_envMap);
+    std::string expandedfullpath = EnvExpand(filename, m_envMap);
     if(pystring::os::path::isabs(expandedfullpath))
     {
         if(FileExists(expandedfullpath))
         {
-            getImpl()->m_resultsCache[filename] = pystring::os::path::normpath(expandedfullpath);
-            return getImpl()->m_resultsCache[filename].c_str();
+            location.m_path
+                = &*m_resolvedPaths.insert(pystring::os::path::normpath(expandedfullpath)).first;
+            return;
         }
         std::ostringstream errortext;
         errortext << "The specified absolute file reference ";
         errortext << "'" << expandedfullpath << "' could not be located. ";
-        throw Exception(errortext.str().c_str());
+        location.m_error = errortext.str();
+        return;
     }
     }
 
     // Load a relative file reference
-    // Prep the search path vector
-    // TODO: Cache this prepped vector?
-    StringUtils::StringVec searchpaths;
-    GetAbsoluteSearchPaths(searchpaths,
-                           getImpl()->m_searchPaths,
-                           getImpl()->m_workingDir,
-                           getImpl()->m_envMap);
+    const StringUtils::StringVec & searchpaths = getAbsoluteSearchPaths();
 
     // Loop over each path, and try to find the file
     std::ostringstream errortext;
@@ -361,17 +517,52 @@ const char * Context::resolveFileLocation(const char * filename) const
     {
         // Make an attempt to find the LUT in one of the search paths
         std::string fullpath = pystring::os::path::join(searchpaths[i], filename);
-        std::string expandedfullpath = EnvExpand(fullpath, getImpl()->m_envMap);
-        if(FileExists(expandedfullpath))
+        std::string expandedfullpath = EnvExpand(fullpath, m_envMap);
+        if(fileExists(expandedfullpath, now))
         {
-            getImpl()->m_resultsCache[filename] = pystring::os::path::normpath(expandedfullpath);
-            return getImpl()->m_resultsCache[filename].c_str();
+            location.m_path
+                = &*m_resolvedPaths.insert(pystring::os::path::normpath(expandedfullpath)).first;
+            return;
         }
         if(i!=0) errortext << " : ";
         errortext << expandedfullpath;
     }
 
-    throw ExceptionMissingFile(errortext.str().c_str());
+    location.m_error = errortext.str();
+    location.m_missingFile = true;
+}
+
+void Context::clearFileLocationCache() const
+{
+    AutoMutex lock(getImpl()->m_resultsCacheMutex);
+
+    getImpl()->m_fileLocations.clear();
+    getImpl()->m_directoryListings.clear();
+}
+
+void Context::setFileLocationCacheTimeout(double seconds)
+{
+    AutoMutex lock(getImpl()->m_resultsCacheMutex);
+
+    getImpl()->m_fileLocationTimeout = seconds;
+}
+
+double Context::getFileLocationCacheTimeout() const
+{
+    return getImpl()->m_fileLocationTimeout;
+}
+
+void Context::setSearchPathListing(bool enabled)
+{
+    AutoMutex lock(getImpl()->m_resultsCacheMutex);
+
+    getImpl()->m_searchPathListing = enabled;
+    getImpl()->m_fileLocations.clear();
+}
+
+bool Context::isSearchPathListingEnabled() const
+{
+    return getImpl()->m_searchPathListing;
 }
 
 std::ostream& operator<< (std::ostream& os, const Context& context)
@@ -11,38 +11,9 @@
 namespace OCIO_NAMESPACE
 {
 
-DisplayMap::iterator find_display(DisplayMap & displays, const std::string & display)
-{
-    for(DisplayMap::iterator iter = displays.begin();
-        iter != displays.end();
-        ++iter)
-    {
-        if(StrEqualsCaseIgnore(display, iter->first)) return iter;
-    }
-    return displays.end();
-}
-
-DisplayMap::const_iterator find_display_const(const DisplayMap & displays, const std::string & display)
-{
-    for(DisplayMap::const_iterator iter = displays.begin();
-        iter != displays.end();
-        ++iter)
-    {
-        if(StrEqualsCaseIgnore(display, iter->first)) return iter;
-    }
-    return displays.end();
-}
-
-int find_view(const ViewVec & vec, const std::string & name)
-{
-    for(unsigned int i=0; i<vec.size(); ++i)
-    {
-        if(StrEqualsCaseIgnore(name, vec[i].m_name)) return i;
-    }
-    return -1;
-}
-
 void AddDisplay(DisplayMap & displays,
+                NameIndexMap & displayIndex,
+                std::vector<NameIndexMap> & viewIndexes,
                 const char * display,
                 const char * view,
                 const char * viewTransform,
@@ -62,26 +33,37 @@ void AddDisplay(DisplayMap & displays,
         throw Exception("Can't add a (display, view) pair with empty color space name.");
     }
 
-    DisplayMap::iterator iter = find_display(displays, display);
-    if(iter == displays.end())
+    const std::string displayKey = StringUtils::Lower(display);
+    const std::string viewKey    = StringUtils::Lower(view);
+
+    const auto iter = displayIndex.find(displayKey);
+    if(iter == displayIndex.end())
     {
         ViewVec views;
         views.push_back( View(view, viewTransform, displayColorSpace, looks) );
         displays.push_back(std::make_pair(display, views));
+
+        displayIndex[displayKey] = displays.size() - 1;
+        viewIndexes.resize(displays.size());
+        viewIndexes.back()[viewKey] = 0;
     }
     else
     {
-        ViewVec & views = iter->second;
-        int index = find_view(views, view);
-        if (index < 0)
+        ViewVec & views = displays[iter->second].second;
+        NameIndexMap & viewIndex = viewIndexes[iter->second];
+
+        const auto viewIter = viewIndex.find(viewKey);
+        if (viewIter == viewIndex.end())
         {
             views.push_back( View(view, viewTransform, displayColorSpace, looks) );
+            viewIndex[viewKey] = views.size() - 1;
         }
         else
         {
-            views[index].m_viewTransform = viewTransform ? viewTransform : "";
-            views[index].m_colorspace    = displayColorSpace;
-            views[index].m_looks         = looks ? looks : "";
+            View & v = views[viewIter->second];
+            v.m_viewTransform = viewTransform ? viewTransform : "";
+            v.m_colorspace    = displayColorSpace;
+            v.m_looks         = looks ? looks : "";
         }
     }
 }
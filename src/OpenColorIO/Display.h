@@ -46,13 +46,12 @@ typedef std::vector<View> ViewVec;
 // can remain in config order but we left the "Map" in the name since it refers to a Yaml::Map.
 typedef std::vector<std::pair<std::string, ViewVec>> DisplayMap;  // Pair is (display name : ViewVec)
 
-DisplayMap::iterator find_display(DisplayMap & displays, const std::string & display);
-DisplayMap::const_iterator find_display_const(const DisplayMap & displays, const std::string & display);
-
-int find_view(const ViewVec & vec, const std::string & name);
-
 // Note: displayColorSpace has to be a display-referred color space if viewTransform is not empty.
+// The displays are looked up through the case-insensitive display and view indexes (i.e. one
+// view index per display) which are updated with the added entries.
 void AddDisplay(DisplayMap & displays,
+                NameIndexMap & displayIndex,
+                std::vector<NameIndexMap> & viewIndexes,
                 const char * display,
                 const char * view,
                 const char * viewTransform,
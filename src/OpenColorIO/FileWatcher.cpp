@@ -0,0 +1,434 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <map>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <vector>
+
+#include <OpenColorIO/OpenColorIO.h>
+
+#include "FileWatcher.h"
+#include "Logging.h"
+#include "Mutex.h"
+#include "PathUtils.h"
+#include "Platform.h"
+#include "pystring/pystring.h"
+#include "utils/StringUtils.h"
+
+#ifdef __linux__
+#include <sys/inotify.h>
+#include <unistd.h>
+#endif
+
+
+namespace OCIO_NAMESPACE
+{
+namespace
+{
+
+constexpr static const char * OCIO_FILE_WATCH_ENVVAR = "OCIO_FILE_WATCH";
+
+// Delay between two checks of the watched files by the watch thread.
+constexpr std::chrono::milliseconds FileWatchInterval{ 500 };
+
+struct WatchedFile
+{
+    // The last known fast hash of the file.
+    std::string m_hash;
+    // The directory of the file is watched using the file system notifications, otherwise
+    // the file is polled.
+    bool m_notified = false;
+};
+
+class FileWatcher
+{
+public:
+    FileWatcher()
+    {
+        std::string value;
+        Platform::Getenv(OCIO_FILE_WATCH_ENVVAR, value);
+        value = StringUtils::Lower(StringUtils::Trim(value));
+
+        if (value == "poll")
+        {
+            setMode(FILE_WATCH_POLL);
+        }
+        else if (!value.empty() && value != "0")
+        {
+            setMode(FILE_WATCH_NOTIFY);
+        }
+    }
+
+    FileWatcher(const FileWatcher &) = delete;
+    FileWatcher & operator=(const FileWatcher &) = delete;
+
+    ~FileWatcher()
+    {
+        setMode(FILE_WATCH_NONE);
+    }
+
+    FileWatchMode getMode() const { return m_mode; }
+
+    void setMode(FileWatchMode mode)
+    {
+        std::lock_guard<std::mutex> modeLock(m_modeMutex);
+
+        stopThread();
+
+        {
+            AutoMutex lock(m_mutex);
+
+            clearFiles();
+
+#ifdef __linux__
+            if (m_fd >= 0)
+            {
+                close(m_fd);
+                m_fd = -1;
+            }
+
+            if (mode == FILE_WATCH_NOTIFY)
+            {
+                m_fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+                if (m_fd < 0)
+                {
+                    LogWarning("The file system notifications are not available, "
+                               "the watched files are polled.");
+                }
+            }
+#endif
+
+            m_mode = mode;
+        }
+
+        if (mode != FILE_WATCH_NONE)
+        {
+            startThread();
+        }
+    }
+
+    void watchFile(const std::string & filepath, const std::string & hash)
+    {
+        if (m_mode == FILE_WATCH_NONE)
+        {
+            return;
+        }
+
+        AutoMutex lock(m_mutex);
+
+        if (m_mode == FILE_WATCH_NONE)
+        {
+            return;
+        }
+
+        WatchedFile & file = m_files[filepath];
+        file.m_hash = hash;
+
+#ifdef __linux__
+        if (m_fd >= 0 && !file.m_notified)
+        {
+            file.m_notified = watchDirectory(pystring::os::path::dirname(filepath));
+        }
+#endif
+    }
+
+    size_t processChanges()
+    {
+        std::set<std::string> changedFiles;
+        std::vector<std::pair<std::string, std::string>> polledFiles;
+
+        {
+            AutoMutex lock(m_mutex);
+
+#ifdef __linux__
+            readNotifications(changedFiles);
+#endif
+
+            for (const auto & file : m_files)
+            {
+                if (!file.second.m_notified)
+                {
+                    polledFiles.emplace_back(file.first, file.second.m_hash);
+                }
+            }
+        }
+
+        // The file system is queried outside of the lock as it could be slow.
+        for (auto & file : polledFiles)
+        {
+            const std::string hash = ComputeFastFileHash(file.first);
+            if (hash != file.second)
+            {
+                file.second = hash;
+                changedFiles.insert(file.first);
+            }
+        }
+
+        {
+            AutoMutex lock(m_mutex);
+
+            for (const auto & file : polledFiles)
+            {
+                auto iter = m_files.find(file.first);
+                if (iter != m_files.end() && !iter->second.m_notified)
+                {
+                    iter->second.m_hash = file.second;
+                }
+            }
+        }
+
+        for (const auto & filepath : changedFiles)
+        {
+            ClearCachesForFile(filepath.c_str());
+        }
+
+        return changedFiles.size();
+    }
+
+    void clear()
+    {
+        AutoMutex lock(m_mutex);
+        clearFiles();
+    }
+
+    size_t getNumFiles() const
+    {
+        AutoMutex lock(m_mutex);
+        return m_files.size();
+    }
+
+private:
+    // You must manually acquire the m_mutex.
+    void clearFiles()
+    {
+        m_files.clear();
+
+#ifdef __linux__
+        for (const auto & dir : m_dirWatches)
+        {
+            inotify_rm_watch(m_fd, dir.second);
+        }
+        m_dirWatches.clear();
+        m_watchDirs.clear();
+#endif
+    }
+
+#ifdef __linux__
+    // Return false if the directory cannot be watched (e.g. it does not exist).
+    // You must manually acquire the m_mutex.
+    bool watchDirectory(const std::string & dirname)
+    {
+        if (m_dirWatches.find(dirname) != m_dirWatches.end())
+        {
+            return true;
+        }
+
+        const int wd = inotify_add_watch(m_fd, dirname.empty() ? "." : dirname.c_str(),
+                                         IN_ATTRIB | IN_CLOSE_WRITE | IN_CREATE | IN_DELETE
+                                         | IN_MOVED_FROM | IN_MOVED_TO);
+        if (wd < 0)
+        {
+            return false;
+        }
+
+        m_dirWatches[dirname] = wd;
+        // The same directory could be reached from several paths.
+        m_watchDirs[wd].insert(dirname);
+        return true;
+    }
+
+    // Append the watched files changed according to the pending notifications.
+    // You must manually acquire the m_mutex.
+    void readNotifications(std::set<std::string> & changedFiles)
+    {
+        if (m_fd < 0)
+        {
+            return;
+        }
+
+        alignas(struct inotify_event) char buffer[4096];
+
+        ssize_t length = 0;
+        while ((length = read(m_fd, buffer, sizeof(buffer))) > 0)
+        {
+            ssize_t pos = 0;
+            while (pos < length)
+            {
+                const struct inotify_event * event
+                    = reinterpret_cast<const struct inotify_event *>(buffer + pos);
+                pos += sizeof(struct inotify_event) + event->len;
+
+                if (event->mask & IN_Q_OVERFLOW)
+                {
+                    // Some notifications are lost.
+                    for (const auto & file : m_files)
+                    {
+                        if (file.second.m_notified)
+                        {
+                            changedFiles.insert(file.first);
+                        }
+                    }
+                    continue;
+                }
+
+                auto dirs = m_watchDirs.find(event->wd);
+                if (dirs == m_watchDirs.end())
+                {
+                    continue;
+                }
+
+                if (event->mask & IN_IGNORED)
+                {
+                    // The directory was removed so its files are now polled.
+                    for (auto & file : m_files)
+                    {
+                        const std::string dirname = pystring::os::path::dirname(file.first);
+                        if (file.second.m_notified
+                            && dirs->second.find(dirname) != dirs->second.end())
+                        {
+                            file.second.m_notified = false;
+                            file.second.m_hash = ComputeFastFileHash(file.first);
+                            changedFiles.insert(file.first);
+                        }
+                    }
+                    for (const auto & dirname : dirs->second)
+                    {
+                        m_dirWatches.erase(dirname);
+                    }
+                    m_watchDirs.erase(dirs);
+                    continue;
+                }
+
+                if (event->len == 0)
+                {
+                    continue;
+                }
+
+                for (const auto & dirname : dirs->second)
+                {
+                    const std::string filepath = pystring::os::path::join(dirname, event->name);
+                    if (m_files.find(filepath) != m_files.end())
+                    {
+                        changedFiles.insert(filepath);
+                    }
+                }
+            }
+        }
+    }
+#endif
+
+    void startThread()
+    {
+        m_stop = false;
+        m_thread = std::thread([this]()
+        {
+            std::unique_lock<std::mutex> lock(m_threadMutex);
+            while (!m_cond.wait_for(lock, FileWatchInterval, [this]() { return m_stop; }))
+            {
+                lock.unlock();
+                try
+                {
+                    processChanges();
+                }
+                catch (const std::exception & e)
+                {
+                    LogWarning(std::string("The file watch failed: ") + e.what());
+                }
+                lock.lock();
+            }
+        });
+    }
+
+    void stopThread()
+    {
+        if (m_thread.joinable())
+        {
+            {
+                std::lock_guard<std::mutex> lock(m_threadMutex);
+                m_stop = true;
+            }
+            m_cond.notify_all();
+            m_thread.join();
+        }
+    }
+
+    // Serialize the mode changes.
+    std::mutex m_modeMutex;
+    std::atomic<FileWatchMode> m_mode{ FILE_WATCH_NONE };
+
+    mutable Mutex m_mutex;
+    std::map<std::string, WatchedFile> m_files;
+
+#ifdef __linux__
+    // The inotify instance.
+    int m_fd = -1;
+    // The watch descriptor of each watched directory, and the reverse map.
+    std::map<std::string, int> m_dirWatches;
+    std::map<int, std::set<std::string>> m_watchDirs;
+#endif
+
+    std::thread m_thread;
+    std::mutex m_threadMutex;
+    std::condition_variable m_cond;
+    bool m_stop = false;
+};
+
+// Note: Created on first use so that it is destroyed (i.e. its thread is stopped) before the
+// caches it clears.
+FileWatcher & GetFileWatcher()
+{
+    static FileWatcher watcher;
+    return watcher;
+}
+
+} // anon.
+
+void SetFileWatchMode(FileWatchMode mode)
+{
+    GetFileWatcher().setMode(mode);
+}
+
+FileWatchMode GetFileWatchMode()
+{
+    return GetFileWatcher().getMode();
+}
+
+void WatchFile(const std::string & filepath, const std::string & hash)
+{
+    GetFileWatcher().watchFile(filepath, hash);
+}
+
+size_t ProcessFileChanges()
+{
+    return GetFileWatcher().processChanges();
+}
+
+void ClearWatchedFiles()
+{
+    GetFileWatcher().clear();
+}
+
+size_t GetNumWatchedFiles()
+{
+    return GetFileWatcher().getNumFiles();
+}
+
+void SetFileWatchEnabled(bool enabled)
+{
+    if (enabled != IsFileWatchEnabled())
+    {
+        SetFileWatchMode(enabled ? FILE_WATCH_NOTIFY : FILE_WATCH_NONE);
+    }
+}
+
+bool IsFileWatchEnabled()
+{
+    return GetFileWatchMode() != FILE_WATCH_NONE;
+}
+
+} // namespace OCIO_NAMESPACE
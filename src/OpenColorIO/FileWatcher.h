@@ -0,0 +1,45 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+
+#ifndef INCLUDED_OCIO_FILEWATCHER_H
+#define INCLUDED_OCIO_FILEWATCHER_H
+
+#include <string>
+
+#include <OpenColorIO/OpenColorIO.h>
+
+
+namespace OCIO_NAMESPACE
+{
+
+// The file watch removes a file from the caches (refer to ClearCachesForFile) as soon as it
+// changes so that long-running sessions get the file updates without clearing all the caches.
+// A background thread checks the watched files, which are all the files having a fast hash
+// (refer to GetFastFileHash).
+
+enum FileWatchMode
+{
+    FILE_WATCH_NONE = 0, // The file watch is disabled.
+    FILE_WATCH_NOTIFY,   // Use the file system notifications, when available (i.e. inotify).
+    FILE_WATCH_POLL      // Compare the fast hash of each file at regular intervals.
+};
+
+// Note: Changing the mode removes all the watched files.
+void SetFileWatchMode(FileWatchMode mode);
+FileWatchMode GetFileWatchMode();
+
+// Watch the file if the file watch is enabled, where hash is its current fast hash.
+void WatchFile(const std::string & filepath, const std::string & hash);
+
+// Clear the caches for the files that changed since the last call and return their number.
+// The watch thread calls it at regular intervals.
+size_t ProcessFileChanges();
+
+void ClearWatchedFiles();
+
+size_t GetNumWatchedFiles();
+
+} // namespace OCIO_NAMESPACE
+
+#endif
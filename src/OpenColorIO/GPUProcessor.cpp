@@ -16,6 +16,7 @@
 #include "ops/allocation/AllocationOp.h"
 #include "ops/lut3d/Lut3DOp.h"
 #include "ops/noop/NoOps.h"
+#include "OpVecCache.h"
 
 
 namespace OCIO_NAMESPACE
@@ -107,11 +108,16 @@ void GPUProcessor::Impl::finalize(const OpRcPtrVec & rawOps,
 
     // Prepare the list of ops.
 
-    m_ops = rawOps;
+    std::ostringstream oss;
+    oss << "GPU oFlags " << oFlags;
 
-    OptimizeOpVec(m_ops, BIT_DEPTH_F32, BIT_DEPTH_F32, oFlags);
-    m_ops.finalize(oFlags);
-    m_ops.unifyDynamicProperties();
+    FinalizeOpVecCached(m_ops, rawOps, oss.str(),
+                        [oFlags](OpRcPtrVec & ops)
+                        {
+                            OptimizeOpVec(ops, BIT_DEPTH_F32, BIT_DEPTH_F32, oFlags);
+                            ops.finalize(oFlags);
+                            ops.unifyDynamicProperties();
+                        });
 
     // Is NoOp ?
     m_isNoOp  = m_ops.isNoOp();
@@ -165,14 +171,18 @@ void GPUProcessor::Impl::extractGpuShaderInfo(GpuShaderCreatorRcPtr & shaderCrea
                         gpuOpsHwPostProcess,
                         gpuOps);
 
+        // The ops are shared with the processor (and its cached op vectors) so they are cloned
+        // before being finalized again.
+
         LogDebug("GPU Ops: 3DLUT");
+        gpuOpsCpuLatticeProcess = gpuOpsCpuLatticeProcess.clone();
         gpuOpsCpuLatticeProcess.finalize(OPTIMIZATION_LUT_INV_FAST);
         OpRcPtrVec gpuLut = Create3DLut(gpuOpsCpuLatticeProcess, legacy->getEdgelen());
 
         gpuOps.clear();
-        gpuOps += gpuOpsHwPreProcess;
+        gpuOps += gpuOpsHwPreProcess.clone();
         gpuOps += gpuLut;
-        gpuOps += gpuOpsHwPostProcess;
+        gpuOps += gpuOpsHwPostProcess.clone();
 
         OptimizeOpVec(gpuOps, BIT_DEPTH_F32, BIT_DEPTH_F32, OPTIMIZATION_DEFAULT);
         gpuOps.finalize(OPTIMIZATION_LUT_INV_FAST);
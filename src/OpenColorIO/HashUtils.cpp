@@ -4,26 +4,21 @@
 #include <OpenColorIO/OpenColorIO.h>
 
 #include "HashUtils.h"
-#include "md5/md5.h"
+#include "murmur3/murmur3.h"
 
 #include <sstream>
 #include <iostream>
 
 namespace OCIO_NAMESPACE
 {
-std::string CacheIDHash(const char * array, int size)
+std::string CacheIDHash(const char * array, size_t size)
 {
-    md5_state_t state;
-    md5_byte_t digest[16];
-
-    md5_init(&state);
-    md5_append(&state, (const md5_byte_t *)array, size);
-    md5_finish(&state, digest);
-
-    return GetPrintableHash(digest);
+    CacheIDHasher hasher;
+    hasher.append(array, size);
+    return hasher.getPrintableHash();
 }
 
-std::string GetPrintableHash(const md5_byte_t * digest)
+std::string GetPrintableHash(const unsigned char * digest)
 {
     static char charmap[] = "0123456789abcdef";
 
@@ -43,4 +38,23 @@ std::string GetPrintableHash(const md5_byte_t * digest)
     return std::string(printableResult);
 }
 
+CacheIDHasher::CacheIDHasher()
+{
+    // A non-zero seed avoids an all zero hash for empty data.
+    murmur3_init(&m_state, 0x4f43494f);
+}
+
+void CacheIDHasher::append(const void * data, size_t size)
+{
+    murmur3_append(&m_state, (const murmur3_byte_t *)data, size);
+}
+
+std::string CacheIDHasher::getPrintableHash() const
+{
+    murmur3_byte_t digest[16];
+    murmur3_finish(&m_state, digest);
+
+    return GetPrintableHash(digest);
+}
+
 } // namespace OCIO_NAMESPACE
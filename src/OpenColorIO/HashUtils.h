@@ -7,15 +7,47 @@
 
 #include <OpenColorIO/OpenColorIO.h>
 
-#include "md5/md5.h"
+#include "murmur3/murmur3.h"
 #include <string>
+#include <vector>
 
 namespace OCIO_NAMESPACE
 {
-std::string CacheIDHash(const char * array, int size);
+// The cache identifiers rely on a fast 128-bit non-cryptographic hash (i.e. MurmurHash3).
+std::string CacheIDHash(const char * array, size_t size);
 
-// TODO: get rid of md5.h include, make this a generic byte array
-std::string GetPrintableHash(const md5_byte_t * digest);
+// Build a printable string from a 16 bytes digest.
+std::string GetPrintableHash(const unsigned char * digest);
+
+// Incrementally hash several buffers (e.g. a LUT array and its settings, or the cache
+// identifiers of a list of ops) without first concatenating them.
+class CacheIDHasher
+{
+public:
+    CacheIDHasher();
+
+    void append(const void * data, size_t size);
+
+    void append(const std::string & str)
+    {
+        append(str.c_str(), str.size());
+    }
+
+    template<typename T>
+    void append(const std::vector<T> & values)
+    {
+        if (!values.empty())
+        {
+            append(values.data(), values.size() * sizeof(T));
+        }
+    }
+
+    // Note that more data could still be appended afterwards.
+    std::string getPrintableHash() const;
+
+private:
+    murmur3_state_t m_state;
+};
 
 } // namespace OCIO_NAMESPACE
 
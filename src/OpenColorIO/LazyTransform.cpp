@@ -0,0 +1,78 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+#include <OpenColorIO/OpenColorIO.h>
+
+#include "LazyTransform.h"
+
+
+namespace OCIO_NAMESPACE
+{
+
+LazyTransform & LazyTransform::operator=(const LazyTransform & rhs)
+{
+    if (this != &rhs)
+    {
+        AutoMutex lock(rhs.m_mutex);
+
+        if (rhs.m_pending)
+        {
+            m_transform.reset();
+            m_loader = rhs.m_loader;
+            m_pending = true;
+        }
+        else
+        {
+            m_transform = rhs.m_transform ? rhs.m_transform->createEditableCopy()
+                                          : rhs.m_transform;
+            m_loader = nullptr;
+            m_pending = false;
+        }
+    }
+    return *this;
+}
+
+void LazyTransform::set(const TransformRcPtr & transform)
+{
+    ConstLoaderTransformRcPtr loaderTransform = DynamicPtrCast<const LoaderTransform>(transform);
+    if (loaderTransform)
+    {
+        setLoader(loaderTransform->getLoader());
+        return;
+    }
+
+    AutoMutex lock(m_mutex);
+
+    m_transform = transform;
+    m_loader = nullptr;
+    m_pending = false;
+}
+
+void LazyTransform::setLoader(const TransformLoader & loader)
+{
+    AutoMutex lock(m_mutex);
+
+    m_transform.reset();
+    m_loader = loader;
+    m_pending = static_cast<bool>(loader);
+}
+
+TransformRcPtr LazyTransform::get() const
+{
+    if (m_pending)
+    {
+        AutoMutex lock(m_mutex);
+
+        // Another thread may have already built it.
+        if (m_pending)
+        {
+            m_transform = m_loader();
+            m_loader = nullptr;
+            m_pending = false;
+        }
+    }
+
+    return m_transform;
+}
+
+} // namespace OCIO_NAMESPACE
@@ -0,0 +1,83 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+
+#ifndef INCLUDED_OCIO_LAZYTRANSFORM_H
+#define INCLUDED_OCIO_LAZYTRANSFORM_H
+
+#include <atomic>
+#include <functional>
+
+#include <OpenColorIO/OpenColorIO.h>
+
+#include "Mutex.h"
+
+
+namespace OCIO_NAMESPACE
+{
+
+// Builds a transform from the config file content (see OCIO_LAZY_LOADING_ENVVAR).
+typedef std::function<TransformRcPtr()> TransformLoader;
+
+// Holds the transform of a color space, look or view transform. When the config is lazily
+// loaded, the transform is only built on first access.
+class LazyTransform
+{
+public:
+    LazyTransform() = default;
+    LazyTransform(const LazyTransform &) = delete;
+
+    // Deep copy i.e. the transform is copied or, when not yet built, the loader is shared.
+    LazyTransform & operator=(const LazyTransform & rhs);
+
+    void set(const TransformRcPtr & transform);
+    void setLoader(const TransformLoader & loader);
+
+    // Build the transform if needed. Note that the loader exceptions are rethrown and the
+    // next call tries again.
+    TransformRcPtr get() const;
+
+private:
+    mutable Mutex m_mutex;
+    mutable std::atomic<bool> m_pending{ false };
+    mutable TransformRcPtr m_transform;
+    mutable TransformLoader m_loader;
+};
+
+// Only carries the loader of a transform to the LazyTransform of a config element through
+// its public setTransform methods (refer to SetTransformLoader), and is never stored.
+class LoaderTransform : public Transform
+{
+public:
+    explicit LoaderTransform(const TransformLoader & loader) : m_loader(loader) { }
+
+    TransformRcPtr createEditableCopy() const override
+    {
+        return std::make_shared<LoaderTransform>(m_loader);
+    }
+
+    TransformDirection getDirection() const noexcept override { return TRANSFORM_DIR_FORWARD; }
+    void setDirection(TransformDirection) noexcept override { }
+
+    const TransformLoader & getLoader() const { return m_loader; }
+
+private:
+    TransformLoader m_loader;
+};
+
+typedef OCIO_SHARED_PTR<const LoaderTransform> ConstLoaderTransformRcPtr;
+
+// Set the transforms of the config elements to be built on first access.
+
+void SetTransformLoader(ColorSpace & cs, ColorSpaceDirection dir, const TransformLoader & loader);
+
+// The inverse direction sets the inverse transform of the look.
+void SetTransformLoader(Look & look, TransformDirection dir, const TransformLoader & loader);
+
+void SetTransformLoader(ViewTransform & vt,
+                        ViewTransformDirection dir,
+                        const TransformLoader & loader);
+
+} // namespace OCIO_NAMESPACE
+
+#endif
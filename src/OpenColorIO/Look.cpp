@@ -7,6 +7,8 @@
 
 #include <OpenColorIO/OpenColorIO.h>
 
+#include "LazyTransform.h"
+
 namespace OCIO_NAMESPACE
 {
 LookRcPtr Look::Create()
@@ -25,8 +27,8 @@ public:
     std::string m_name;
     std::string m_processSpace;
     std::string m_description;
-    TransformRcPtr m_transform;
-    TransformRcPtr m_inverseTransform;
+    LazyTransform m_transform;
+    LazyTransform m_inverseTransform;
 
     Impl()
     { }
@@ -44,12 +46,8 @@ public:
             m_processSpace = rhs.m_processSpace;
             m_description = rhs.m_description;
 
-            m_transform = rhs.m_transform?
-                rhs.m_transform->createEditableCopy() : rhs.m_transform;
-
-            m_inverseTransform = rhs.m_inverseTransform?
-                rhs.m_inverseTransform->createEditableCopy()
-                : rhs.m_inverseTransform;
+            m_transform = rhs.m_transform;
+            m_inverseTransform = rhs.m_inverseTransform;
         }
         return *this;
     }
@@ -97,22 +95,38 @@ void Look::setProcessSpace(const char * processSpace)
 
 ConstTransformRcPtr Look::getTransform() const
 {
-    return getImpl()->m_transform;
+    return getImpl()->m_transform.get();
 }
 
 void Look::setTransform(const ConstTransformRcPtr & transform)
 {
-    getImpl()->m_transform = transform->createEditableCopy();
+    getImpl()->m_transform.set(transform->createEditableCopy());
 }
 
 ConstTransformRcPtr Look::getInverseTransform() const
 {
-    return getImpl()->m_inverseTransform;
+    return getImpl()->m_inverseTransform.get();
 }
 
 void Look::setInverseTransform(const ConstTransformRcPtr & transform)
 {
-    getImpl()->m_inverseTransform = transform->createEditableCopy();
+    getImpl()->m_inverseTransform.set(transform->createEditableCopy());
+}
+
+void SetTransformLoader(Look & look, TransformDirection dir, const TransformLoader & loader)
+{
+    if (dir == TRANSFORM_DIR_FORWARD)
+    {
+        look.setTransform(std::make_shared<LoaderTransform>(loader));
+    }
+    else if (dir == TRANSFORM_DIR_INVERSE)
+    {
+        look.setInverseTransform(std::make_shared<LoaderTransform>(loader));
+    }
+    else
+    {
+        throw Exception("Look: Unspecified TransformDirection.");
+    }
 }
 
 const char * Look::getDescription() const
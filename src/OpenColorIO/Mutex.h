@@ -6,6 +6,8 @@
 #define INCLUDED_OCIO_MUTEX_H
 
 
+#include <atomic>
+#include <condition_variable>
 #include <mutex> 
 #include <assert.h>
 
@@ -46,6 +48,102 @@ typedef std::mutex Mutex;
 
 typedef std::lock_guard<Mutex> AutoMutex;
 
+
+// Reader-writer mutex for the read-mostly caches (std::shared_mutex is C++17).  A reader only
+// does one atomic compare-and-swap when there is no writer, so concurrent readers do not
+// serialize.  A pending writer blocks the new readers to avoid its starvation.
+// Note: The mutex is not recursive in either mode.
+class SharedMutex
+{
+public:
+    SharedMutex() = default;
+    SharedMutex(const SharedMutex &) = delete;
+    SharedMutex& operator=(const SharedMutex &) = delete;
+    ~SharedMutex() { assert(m_state == 0); }
+
+    void lock()
+    {
+        // Only one writer at a time.
+        m_writerMutex.lock();
+
+        // Block the new readers and wait for the current ones.
+        m_state.fetch_or(WRITER);
+        if ((m_state.load() & READERS) != 0)
+        {
+            std::unique_lock<std::mutex> lock(m_waitMutex);
+            m_cond.wait(lock, [this]() { return (m_state.load() & READERS) == 0; });
+        }
+    }
+
+    void unlock()
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_waitMutex);
+            m_state.fetch_and(~WRITER);
+        }
+        m_cond.notify_all();
+        m_writerMutex.unlock();
+    }
+
+    void lock_shared()
+    {
+        if (tryLockShared()) return;
+
+        std::unique_lock<std::mutex> lock(m_waitMutex);
+        m_cond.wait(lock, [this]() { return tryLockShared(); });
+    }
+
+    void unlock_shared()
+    {
+        const unsigned state = m_state.fetch_sub(1);
+        assert((state & READERS) != 0);
+
+        // Wake up the writer waiting for the last reader.
+        if ((state & WRITER) && (state & READERS) == 1)
+        {
+            std::lock_guard<std::mutex> lock(m_waitMutex);
+            m_cond.notify_all();
+        }
+    }
+
+private:
+    static constexpr unsigned WRITER  = 1u << 31;
+    static constexpr unsigned READERS = WRITER - 1;
+
+    bool tryLockShared()
+    {
+        unsigned state = m_state.load();
+        while ((state & WRITER) == 0)
+        {
+            if (m_state.compare_exchange_weak(state, state + 1)) return true;
+        }
+        return false;
+    }
+
+    // The writer bit and the number of readers.
+    std::atomic<unsigned> m_state{ 0 };
+
+    std::mutex m_writerMutex;
+    std::mutex m_waitMutex;
+    std::condition_variable m_cond;
+};
+
+// Exclusive (i.e. writer) lock of a SharedMutex.
+typedef std::lock_guard<SharedMutex> AutoExclusiveMutex;
+
+// Shared (i.e. reader) lock of a SharedMutex.
+class AutoSharedMutex
+{
+public:
+    explicit AutoSharedMutex(SharedMutex & mutex) : m_mutex(mutex) { m_mutex.lock_shared(); }
+    AutoSharedMutex(const AutoSharedMutex &) = delete;
+    AutoSharedMutex& operator=(const AutoSharedMutex &) = delete;
+    ~AutoSharedMutex() { m_mutex.unlock_shared(); }
+
+private:
+    SharedMutex & m_mutex;
+};
+
 } // namespace OCIO_NAMESPACE
 
 #endif
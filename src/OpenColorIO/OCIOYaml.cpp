@@ -8,8 +8,10 @@
 
 #include "Display.h"
 #include "FileRules.h"
+#include "LazyTransform.h"
 #include "Logging.h"
 #include "MathUtils.h"
+#include "Mutex.h"
 #include "OCIOYaml.h"
 #include "ops/log/LogUtils.h"
 #include "ParseUtils.h"
@@ -2047,7 +2049,68 @@ void save(YAML::Emitter& out, ConstTransformRcPtr t)
 
 // ColorSpace
 
-inline void load(const YAML::Node& node, ColorSpaceRcPtr& cs)
+// Lazy loading (see OCIO_LAZY_LOADING_ENVVAR) keeps the YAML nodes of the transforms to only
+// build the transforms on first access.
+
+struct LazyLoading
+{
+    std::string m_filename;
+};
+
+bool IsLazyLoadingEnabled()
+{
+    std::string value;
+    Platform::Getenv(OCIO_LAZY_LOADING_ENVVAR, value);
+    value = StringUtils::Trim(value);
+    return !value.empty() && value != "0";
+}
+
+// The YAML nodes are not thread-safe, even for reading.
+Mutex g_lazyLoadingMutex;
+
+TransformLoader CreateTransformLoader(const YAML::Node & node, const LazyLoading & lazy)
+{
+    const std::string filename = lazy.m_filename;
+    return [node, filename]()
+    {
+        AutoMutex lock(g_lazyLoadingMutex);
+
+        try
+        {
+            TransformRcPtr val;
+            load(node, val);
+            return val;
+        }
+        catch(const std::exception & e)
+        {
+            // Same error as for a regular loading.
+            std::ostringstream os;
+            os << "Error: Loading the OCIO profile ";
+            if(!filename.empty()) os << "'" << filename << "' ";
+            os << "failed. " << e.what();
+            throw Exception(os.str().c_str());
+        }
+    };
+}
+
+// Load the transform now or, when lazy loading, on first access.
+template<typename Element, typename Direction>
+void loadTransform(const YAML::Node & node, const LazyLoading * lazy,
+                   Element & element, Direction dir)
+{
+    if (lazy)
+    {
+        SetTransformLoader(element, dir, CreateTransformLoader(node, *lazy));
+    }
+    else
+    {
+        TransformRcPtr val;
+        load(node, val);
+        element.setTransform(val, dir);
+    }
+}
+
+inline void load(const YAML::Node& node, ColorSpaceRcPtr& cs, const LazyLoading * lazy = nullptr)
 {
     if(node.Tag() != "ColorSpace")
         return; // not a !<ColorSpace> tag
@@ -2132,9 +2195,7 @@ inline void load(const YAML::Node& node, ColorSpaceRcPtr& cs)
             {
                 throwError(node, "'to_reference' cannot be used for a display color space.");
             }
-            TransformRcPtr val;
-            load(second, val);
-            cs->setTransform(val, COLORSPACE_DIR_TO_REFERENCE);
+            loadTransform(second, lazy, *cs, COLORSPACE_DIR_TO_REFERENCE);
         }
         else if (key == "to_display_reference")
         {
@@ -2143,9 +2204,7 @@ inline void load(const YAML::Node& node, ColorSpaceRcPtr& cs)
                 throwError(node, "'to_display_reference' cannot be used for a "
                                  "non-display color space.");
             }
-            TransformRcPtr val;
-            load(second, val);
-            cs->setTransform(val, COLORSPACE_DIR_TO_REFERENCE);
+            loadTransform(second, lazy, *cs, COLORSPACE_DIR_TO_REFERENCE);
         }
         else if(key == "from_reference")
         {
@@ -2153,9 +2212,7 @@ inline void load(const YAML::Node& node, ColorSpaceRcPtr& cs)
             {
                 throwError(node, "'from_reference' cannot be used for a display color space.");
             }
-            TransformRcPtr val;
-            load(second, val);
-            cs->setTransform(val, COLORSPACE_DIR_FROM_REFERENCE);
+            loadTransform(second, lazy, *cs, COLORSPACE_DIR_FROM_REFERENCE);
         }
         else if (key == "from_display_reference")
         {
@@ -2164,9 +2221,7 @@ inline void load(const YAML::Node& node, ColorSpaceRcPtr& cs)
                 throwError(node, "'from_display_reference' cannot be used for a "
                                  "non-display color space.");
             }
-            TransformRcPtr val;
-            load(second, val);
-            cs->setTransform(val, COLORSPACE_DIR_FROM_REFERENCE);
+            loadTransform(second, lazy, *cs, COLORSPACE_DIR_FROM_REFERENCE);
         }
         else
         {
@@ -2234,7 +2289,7 @@ inline void save(YAML::Emitter& out, ConstColorSpaceRcPtr cs)
 
 // Look
 
-inline void load(const YAML::Node& node, LookRcPtr& look)
+inline void load(const YAML::Node& node, LookRcPtr& look, const LazyLoading * lazy = nullptr)
 {
     if(node.Tag() != "Look")
         return;
@@ -2262,15 +2317,31 @@ inline void load(const YAML::Node& node, LookRcPtr& look)
         }
         else if(key == "transform")
         {
-            TransformRcPtr val;
-            load(second, val);
-            look->setTransform(val);
+            if (lazy)
+            {
+                SetTransformLoader(*look, TRANSFORM_DIR_FORWARD,
+                                   CreateTransformLoader(second, *lazy));
+            }
+            else
+            {
+                TransformRcPtr val;
+                load(second, val);
+                look->setTransform(val);
+            }
         }
         else if(key == "inverse_transform")
         {
-            TransformRcPtr val;
-            load(second, val);
-            look->setInverseTransform(val);
+            if (lazy)
+            {
+                SetTransformLoader(*look, TRANSFORM_DIR_INVERSE,
+                                   CreateTransformLoader(second, *lazy));
+            }
+            else
+            {
+                TransformRcPtr val;
+                load(second, val);
+                look->setInverseTransform(val);
+            }
         }
         else if(key == "description")
         {
@@ -2369,7 +2440,8 @@ inline ReferenceSpaceType peekViewTransformReferenceSpace(const YAML::Node & nod
     return isDisplay ? REFERENCE_SPACE_DISPLAY : REFERENCE_SPACE_SCENE;
 }
 
-inline void load(const YAML::Node & node, ViewTransformRcPtr & vt)
+inline void load(const YAML::Node & node, ViewTransformRcPtr & vt,
+                 const LazyLoading * lazy = nullptr)
 {
     if (node.Tag() != "ViewTransform")
     {
@@ -2420,27 +2492,19 @@ inline void load(const YAML::Node & node, ViewTransformRcPtr & vt)
         }
         else if (key == "to_reference")
         {
-            TransformRcPtr val;
-            load(second, val);
-            vt->setTransform(val, VIEWTRANSFORM_DIR_TO_REFERENCE);
+            loadTransform(second, lazy, *vt, VIEWTRANSFORM_DIR_TO_REFERENCE);
         }
         else if (key == "to_display_reference")
         {
-            TransformRcPtr val;
-            load(second, val);
-            vt->setTransform(val, VIEWTRANSFORM_DIR_TO_REFERENCE);
+            loadTransform(second, lazy, *vt, VIEWTRANSFORM_DIR_TO_REFERENCE);
         }
         else if (key == "from_reference")
         {
-            TransformRcPtr val;
-            load(second, val);
-            vt->setTransform(val, VIEWTRANSFORM_DIR_FROM_REFERENCE);
+            loadTransform(second, lazy, *vt, VIEWTRANSFORM_DIR_FROM_REFERENCE);
         }
         else if (key == "from_display_reference")
         {
-            TransformRcPtr val;
-            load(second, val);
-            vt->setTransform(val, VIEWTRANSFORM_DIR_FROM_REFERENCE);
+            loadTransform(second, lazy, *vt, VIEWTRANSFORM_DIR_FROM_REFERENCE);
         }
         else
         {
@@ -2669,7 +2733,7 @@ inline void save(YAML::Emitter & out, ConstFileRulesRcPtr & fr, size_t position)
 
 // Config
 
-inline void load(const YAML::Node& node, ConfigRcPtr& c, const char* filename)
+inline void load(const YAML::Node& node, ConfigRcPtr& c, const char* filename, bool forceLazyLoading)
 {
 
     // check profile version
@@ -2751,6 +2815,10 @@ inline void load(const YAML::Node& node, ConfigRcPtr& c, const char* filename)
     bool boolval = false;
     EnvironmentMode mode = ENV_ENVIRONMENT_LOAD_ALL;
 
+    const LazyLoading lazyLoading{ filename ? filename : "" };
+    const LazyLoading * lazy
+        = (forceLazyLoading || IsLazyLoadingEnabled()) ? &lazyLoading : nullptr;
+
     for (const auto & iter : node)
     {
         const YAML::Node& first = iter.first;
@@ -2944,7 +3012,7 @@ inline void load(const YAML::Node& node, ConfigRcPtr& c, const char* filename)
                 if(val.Tag() == "ColorSpace")
                 {
                     ColorSpaceRcPtr cs = ColorSpace::Create(REFERENCE_SPACE_SCENE);
-                    load(val, cs);
+                    load(val, cs, lazy);
                     for(int ii = 0; ii < c->getNumColorSpaces(); ++ii)
                     {
                         if(strcmp(c->getColorSpaceNameByIndex(ii), cs->getName()) == 0)
@@ -2977,7 +3045,7 @@ inline void load(const YAML::Node& node, ConfigRcPtr& c, const char* filename)
                 if (val.Tag() == "ColorSpace")
                 {
                     ColorSpaceRcPtr cs = ColorSpace::Create(REFERENCE_SPACE_DISPLAY);
-                    load(val, cs);
+                    load(val, cs, lazy);
                     for (int ii = 0; ii < c->getNumColorSpaces(); ++ii)
                     {
                         if (strcmp(c->getColorSpaceNameByIndex(ii), cs->getName()) == 0)
@@ -3011,7 +3079,7 @@ inline void load(const YAML::Node& node, ConfigRcPtr& c, const char* filename)
                 if(val.Tag() == "Look")
                 {
                     LookRcPtr look = Look::Create();
-                    load(val, look);
+                    load(val, look, lazy);
                     c->addLook(look);
                 }
                 else
@@ -3037,7 +3105,7 @@ inline void load(const YAML::Node& node, ConfigRcPtr& c, const char* filename)
                 {
                     ReferenceSpaceType rst = peekViewTransformReferenceSpace(val);
                     ViewTransformRcPtr vt = ViewTransform::Create(rst);
-                    load(val, vt);
+                    load(val, vt, lazy);
                     c->addViewTransform(vt);
                 }
                 else
@@ -3115,7 +3183,8 @@ inline void load(const YAML::Node& node, ConfigRcPtr& c, const char* filename)
 
 }
 
-inline void save(YAML::Emitter& out, const Config* c)
+// The looks, the view transforms and the color spaces are only saved when withElements is true.
+inline void save(YAML::Emitter& out, const Config* c, bool withElements)
 {
     std::stringstream ss;
     const unsigned configMajorVersion = c->getMajorVersion();
@@ -3282,6 +3351,12 @@ inline void save(YAML::Emitter& out, const Config* c)
 
     out << YAML::Newline;
 
+    if (!withElements)
+    {
+        out << YAML::EndMap;
+        return;
+    }
+
     // Looks
     if(c->getNumLooks() > 0)
     {
@@ -3362,12 +3437,13 @@ inline void save(YAML::Emitter& out, const Config* c)
 
 ///////////////////////////////////////////////////////////////////////////
 
-void OCIOYaml::Read(std::istream & istream, ConfigRcPtr & c, const char * filename)
+void OCIOYaml::Read(std::istream & istream, ConfigRcPtr & c, const char * filename,
+                    bool lazyLoading)
 {
     try
     {
         YAML::Node node = YAML::Load(istream);
-        load(node, c, filename);
+        load(node, c, filename, lazyLoading);
     }
     catch(const std::exception & e)
     {
@@ -3383,7 +3459,40 @@ void OCIOYaml::Write(std::ostream & ostream, const Config * c)
 {
     YAML::Emitter out;
     out.SetDoublePrecision(std::numeric_limits<double>::digits10);
-    save(out, c);
+    save(out, c, true);
+    ostream << out.c_str();
+}
+
+void OCIOYaml::WriteHeader(std::ostream & ostream, const Config * c)
+{
+    YAML::Emitter out;
+    out.SetDoublePrecision(std::numeric_limits<double>::digits10);
+    save(out, c, false);
+    ostream << out.c_str();
+}
+
+void OCIOYaml::Write(std::ostream & ostream, const ConstColorSpaceRcPtr & cs)
+{
+    YAML::Emitter out;
+    out.SetDoublePrecision(std::numeric_limits<double>::digits10);
+    save(out, cs);
+    ostream << out.c_str();
+}
+
+void OCIOYaml::Write(std::ostream & ostream, const ConstLookRcPtr & look)
+{
+    YAML::Emitter out;
+    out.SetDoublePrecision(std::numeric_limits<double>::digits10);
+    save(out, look);
+    ostream << out.c_str();
+}
+
+void OCIOYaml::Write(std::ostream & ostream, const ConstViewTransformRcPtr & vt)
+{
+    YAML::Emitter out;
+    out.SetDoublePrecision(std::numeric_limits<double>::digits10);
+    ConstViewTransformRcPtr viewTransform = vt;
+    save(out, viewTransform);
     ostream << out.c_str();
 }
 
@@ -12,9 +12,20 @@ namespace OCIO_NAMESPACE
 namespace OCIOYaml
 {
 
-void Read(std::istream & istream, ConfigRcPtr & c, const char * filename);
+// The transforms are lazily loaded if lazyLoading is true or if the OCIO_LAZY_LOADING env.
+// variable is set.
+void Read(std::istream & istream, ConfigRcPtr & c, const char * filename,
+          bool lazyLoading = false);
 void Write(std::ostream & ostream, const Config * c);
 
+// Write the config without its looks, view transforms and color spaces.
+void WriteHeader(std::ostream & ostream, const Config * c);
+
+// Write a single config element.
+void Write(std::ostream & ostream, const ConstColorSpaceRcPtr & cs);
+void Write(std::ostream & ostream, const ConstLookRcPtr & look);
+void Write(std::ostream & ostream, const ConstViewTransformRcPtr & vt);
+
 } // namespace OCIOYaml
 
 } // namespace OCIO_NAMESPACE
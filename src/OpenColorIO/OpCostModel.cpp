@@ -0,0 +1,277 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+#include <atomic>
+#include <fstream>
+#include <mutex>
+#include <sstream>
+
+#include <OpenColorIO/OpenColorIO.h>
+
+#include "Logging.h"
+#include "Mutex.h"
+#include "OpCostModel.h"
+#include "OpVecCache.h"
+#include "ops/lut1d/Lut1DOpData.h"
+#include "ops/lut3d/Lut3DOpData.h"
+#include "ParseUtils.h"
+#include "Platform.h"
+#include "utils/StringUtils.h"
+
+
+namespace OCIO_NAMESPACE
+{
+namespace
+{
+constexpr static const char * OCIO_OPTIMIZER_COSTS_ENVVAR = "OCIO_OPTIMIZER_COSTS";
+
+// The default costs were measured using 'ocioperf --calibrate' on a x86-64 computer with SSE.
+// Note: The inverse LUTs use the default inversion quality.
+// Note: The look-up cost also includes the conversion of the input to the LUT domain.
+constexpr float g_defaultCosts[OP_COST_NUM_ENTRIES] = {
+    8.5f,     // OP_COST_CDL
+    17.0f,    // OP_COST_EXPONENT
+    6.0f,     // OP_COST_EXPOSURE_CONTRAST
+    16.0f,    // OP_COST_FIXED_FUNCTION
+    5.5f,     // OP_COST_GAMMA
+    3.5f,     // OP_COST_LOG
+    5.0f,     // OP_COST_LUT1D
+    25.0f,    // OP_COST_LUT1D_INVERSE
+    2.0f,     // OP_COST_LUT1D_LOOKUP
+    8.0f,     // OP_COST_LUT3D
+    1350.0f,  // OP_COST_LUT3D_INVERSE
+    1.0f,     // OP_COST_MATRIX
+    0.5f      // OP_COST_RANGE
+};
+
+// Serializes the table changes. The costs are read without the lock as the optimizer queries
+// them for each op.
+Mutex g_costMutex;
+
+std::atomic<float> g_costs[OP_COST_NUM_ENTRIES];
+
+std::once_flag g_costsInitialized;
+
+// The default costs do not drive the optimizer, only a loaded cost table does.
+std::atomic<bool> g_costTableLoaded{ false };
+
+// You must manually acquire the cost mutex before calling these (except for the
+// initialization).
+
+void ResetCosts()
+{
+    for (int entry = 0; entry < OP_COST_NUM_ENTRIES; ++entry)
+    {
+        g_costs[entry].store(g_defaultCosts[entry], std::memory_order_relaxed);
+    }
+    g_costTableLoaded = false;
+}
+
+void LoadCosts(std::istream & istream)
+{
+    float costs[OP_COST_NUM_ENTRIES];
+    for (int entry = 0; entry < OP_COST_NUM_ENTRIES; ++entry)
+    {
+        costs[entry] = g_costs[entry].load(std::memory_order_relaxed);
+    }
+
+    unsigned lineNumber = 0;
+    std::string line;
+    while (std::getline(istream, line))
+    {
+        ++lineNumber;
+
+        const auto comment = line.find('#');
+        if (comment != std::string::npos)
+        {
+            line.resize(comment);
+        }
+
+        const StringUtils::StringVec parts = StringUtils::SplitByWhiteSpaces(StringUtils::Trim(line));
+        if (parts.empty() || (parts.size() == 1 && parts[0].empty()))
+        {
+            continue;
+        }
+
+        int entry = 0;
+        for (; entry < OP_COST_NUM_ENTRIES; ++entry)
+        {
+            if (StringUtils::Compare(parts[0], OpCostEntryToString(OpCostEntry(entry))))
+            {
+                break;
+            }
+        }
+
+        float cost = 0.0f;
+        if (parts.size() != 2 || entry == OP_COST_NUM_ENTRIES
+            || !StringToFloat(&cost, parts[1].c_str()) || !(cost > 0.0f))
+        {
+            std::ostringstream oss;
+            oss << "Invalid op cost table at line " << lineNumber << ": '" << line
+                << "'. Expecting '<op type> <positive cost>'.";
+            throw Exception(oss.str().c_str());
+        }
+
+        costs[entry] = cost;
+    }
+
+    for (int entry = 0; entry < OP_COST_NUM_ENTRIES; ++entry)
+    {
+        g_costs[entry].store(costs[entry], std::memory_order_relaxed);
+    }
+    g_costTableLoaded = true;
+}
+
+// Only called once, before any other access to the costs.
+void LoadInitialCosts()
+{
+    ResetCosts();
+
+    std::string filepath;
+    Platform::Getenv(OCIO_OPTIMIZER_COSTS_ENVVAR, filepath);
+    if (!filepath.empty())
+    {
+        std::ifstream istream(filepath.c_str(), std::ios_base::in);
+        if (!istream.good())
+        {
+            std::ostringstream oss;
+            oss << "Could not open the op cost table '" << filepath << "' from $"
+                << OCIO_OPTIMIZER_COSTS_ENVVAR << ". Using the default costs.";
+            LogWarning(oss.str());
+            return;
+        }
+
+        try
+        {
+            LoadCosts(istream);
+        }
+        catch (Exception & e)
+        {
+            LogWarning(std::string(e.what()) + " Using the default costs.");
+            ResetCosts();
+        }
+    }
+}
+
+OpCostEntry GetOpCostEntry(const ConstOpDataRcPtr & data)
+{
+    switch (data->getType())
+    {
+    case OpData::CDLType:
+        return OP_COST_CDL;
+    case OpData::ExponentType:
+        return OP_COST_EXPONENT;
+    case OpData::ExposureContrastType:
+        return OP_COST_EXPOSURE_CONTRAST;
+    case OpData::FixedFunctionType:
+        return OP_COST_FIXED_FUNCTION;
+    case OpData::GammaType:
+        return OP_COST_GAMMA;
+    case OpData::LogType:
+        return OP_COST_LOG;
+    case OpData::Lut1DType:
+    {
+        auto lut = OCIO_DYNAMIC_POINTER_CAST<const Lut1DOpData>(data);
+        return lut->getDirection() == TRANSFORM_DIR_INVERSE ? OP_COST_LUT1D_INVERSE
+                                                            : OP_COST_LUT1D;
+    }
+    case OpData::Lut3DType:
+    {
+        auto lut = OCIO_DYNAMIC_POINTER_CAST<const Lut3DOpData>(data);
+        return lut->getDirection() == TRANSFORM_DIR_INVERSE ? OP_COST_LUT3D_INVERSE
+                                                            : OP_COST_LUT3D;
+    }
+    case OpData::MatrixType:
+        return OP_COST_MATRIX;
+    case OpData::RangeType:
+        return OP_COST_RANGE;
+
+    case OpData::ReferenceType:
+    case OpData::NoOpType:
+    default:
+        return OP_COST_NUM_ENTRIES;
+    }
+}
+
+} // anon.
+
+const char * OpCostEntryToString(OpCostEntry entry)
+{
+    switch (entry)
+    {
+    case OP_COST_CDL:               return "CDL";
+    case OP_COST_EXPONENT:          return "Exponent";
+    case OP_COST_EXPOSURE_CONTRAST: return "ExposureContrast";
+    case OP_COST_FIXED_FUNCTION:    return "FixedFunction";
+    case OP_COST_GAMMA:             return "Gamma";
+    case OP_COST_LOG:               return "Log";
+    case OP_COST_LUT1D:             return "Lut1D";
+    case OP_COST_LUT1D_INVERSE:     return "Lut1DInverse";
+    case OP_COST_LUT1D_LOOKUP:      return "Lut1DLookup";
+    case OP_COST_LUT3D:             return "Lut3D";
+    case OP_COST_LUT3D_INVERSE:     return "Lut3DInverse";
+    case OP_COST_MATRIX:            return "Matrix";
+    case OP_COST_RANGE:             return "Range";
+    case OP_COST_NUM_ENTRIES:       break;
+    }
+
+    throw Exception("Unknown op cost entry.");
+}
+
+float GetOpCost(OpCostEntry entry)
+{
+    if (entry >= OP_COST_NUM_ENTRIES)
+    {
+        return 0.0f;
+    }
+
+    std::call_once(g_costsInitialized, LoadInitialCosts);
+
+    return g_costs[entry].load(std::memory_order_relaxed);
+}
+
+float GetOpCost(const ConstOpRcPtr & op)
+{
+    // No-op types (e.g. file and look markers) do not process pixels.
+    return GetOpCost(GetOpCostEntry(op->data()));
+}
+
+float GetOpVecCost(const OpRcPtrVec & ops)
+{
+    float cost = 0.0f;
+    for (const auto & op : ops)
+    {
+        cost += GetOpCost(ConstOpRcPtr(op));
+    }
+    return cost;
+}
+
+void LoadOpCostTable(std::istream & istream)
+{
+    std::call_once(g_costsInitialized, LoadInitialCosts);
+
+    AutoMutex lock(g_costMutex);
+    LoadCosts(istream);
+
+    // The cached op chains were optimized using the previous costs.
+    ClearOpVecCache();
+}
+
+void ResetOpCostTable()
+{
+    std::call_once(g_costsInitialized, LoadInitialCosts);
+
+    AutoMutex lock(g_costMutex);
+    ResetCosts();
+
+    ClearOpVecCache();
+}
+
+bool IsOpCostTableLoaded()
+{
+    std::call_once(g_costsInitialized, LoadInitialCosts);
+
+    return g_costTableLoaded;
+}
+
+} // namespace OCIO_NAMESPACE
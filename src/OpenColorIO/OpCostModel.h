@@ -0,0 +1,66 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+
+#ifndef INCLUDED_OCIO_OPCOSTMODEL_H
+#define INCLUDED_OCIO_OPCOSTMODEL_H
+
+#include <istream>
+
+#include <OpenColorIO/OpenColorIO.h>
+
+#include "Op.h"
+
+
+namespace OCIO_NAMESPACE
+{
+
+// The cost model used by the optimizer to choose between alternative op chains (e.g. combine
+// two ops or not, replace ops by a 1D LUT or not).  The costs are the relative CPU times to
+// process one pixel through each op type, where a matrix costs 1.
+//
+// The default costs could be overridden by a cost table (for example measured on the target
+// computer using 'ocioperf --calibrate') whose path is in the $OCIO_OPTIMIZER_COSTS env. variable.
+// The optimizer only relies on the costs once a cost table is loaded, otherwise it keeps its
+// default rules (the default costs are then only used for the logging).
+
+enum OpCostEntry
+{
+    OP_COST_CDL = 0,
+    OP_COST_EXPONENT,
+    OP_COST_EXPOSURE_CONTRAST,
+    OP_COST_FIXED_FUNCTION,
+    OP_COST_GAMMA,
+    OP_COST_LOG,
+    OP_COST_LUT1D,
+    OP_COST_LUT1D_INVERSE,
+    OP_COST_LUT1D_LOOKUP,     // A Lut1D for an integer or half input (i.e. no interpolation)
+    OP_COST_LUT3D,
+    OP_COST_LUT3D_INVERSE,
+    OP_COST_MATRIX,
+    OP_COST_RANGE,
+
+    // Note: Keep at end of list.
+    OP_COST_NUM_ENTRIES
+};
+
+const char * OpCostEntryToString(OpCostEntry entry);
+
+// Return the cost of an op, or of an op chain.
+float GetOpCost(const ConstOpRcPtr & op);
+float GetOpCost(OpCostEntry entry);
+float GetOpVecCost(const OpRcPtrVec & ops);
+
+// Read a cost table i.e. lines of '<op type> <cost>' where '#' starts a comment. Types which
+// are not listed keep their current cost. Throws if the table is invalid.
+void LoadOpCostTable(std::istream & istream);
+
+// Restore the default costs (the $OCIO_OPTIMIZER_COSTS env. variable is ignored).
+void ResetOpCostTable();
+
+// True if a cost table was loaded i.e. the optimizer decisions use the costs.
+bool IsOpCostTableLoaded();
+
+} // namespace OCIO_NAMESPACE
+
+#endif
@@ -10,8 +10,13 @@
 #include "BitDepthUtils.h"
 #include "Logging.h"
 #include "Op.h"
+#include "OpCostModel.h"
 #include "ops/lut1d/Lut1DOp.h"
 #include "ops/lut1d/Lut1DOpData.h"
+#include "ops/lut3d/Lut3DOp.h"
+#include "ops/lut3d/Lut3DOpData.h"
+#include "ops/matrix/MatrixOpData.h"
+#include "ops/OpTools.h"
 #include "ops/range/RangeOpData.h"
 
 namespace OCIO_NAMESPACE
@@ -69,6 +74,97 @@ bool IsCombineEnabled(OpData::Type type, OptimizationFlags flags)
 
 constexpr int MAX_OPTIMIZATION_PASSES = 8;
 
+// The optimizations are applied in several passes until no more progress is made.  As the
+// checks only depend on the ops (or on the pairs of adjacent ops) and on the optimization
+// flags, the rejected ones are remembered so that the next passes only revisit the ops that
+// were changed (i.e. the new ops and the ops having a new neighbor).  The flags are kept in
+// sync with the op list so they must be updated along with any change to the op list.
+class RejectedOptimizations
+{
+public:
+    enum Check : uint8_t
+    {
+        CHECK_NOOP             = 0x01,
+        CHECK_IDENTITY         = 0x02,
+        // The next ones are about the op and the next op.
+        CHECK_INVERSE          = 0x04,
+        CHECK_COMBINE          = 0x08,
+        CHECK_LUT3D_ABSORPTION = 0x10
+    };
+
+    explicit RejectedOptimizations(size_t numOps) : m_rejected(numOps, 0) {}
+
+    bool isRejected(size_t index, Check check) const
+    {
+        return (m_rejected[index] & check) == check;
+    }
+
+    void reject(size_t index, Check check)
+    {
+        m_rejected[index] |= check;
+    }
+
+    // The op at index is replaced by a new op.
+    void replace(size_t index)
+    {
+        m_rejected[index] = 0;
+        resetPrevious(index);
+    }
+
+    // The ops in [first, last) are removed.
+    void erase(size_t first, size_t last)
+    {
+        m_rejected.erase(m_rejected.begin() + first, m_rejected.begin() + last);
+        resetPrevious(first);
+    }
+
+    // New ops are inserted at index.
+    void insert(size_t index, size_t count)
+    {
+        m_rejected.insert(m_rejected.begin() + index, count, 0);
+        resetPrevious(index);
+    }
+
+private:
+    // The op before index has a new next op.
+    void resetPrevious(size_t index)
+    {
+        if (index > 0)
+        {
+            m_rejected[index - 1] &= (CHECK_NOOP | CHECK_IDENTITY);
+        }
+    }
+
+    std::vector<uint8_t> m_rejected;
+};
+
+typedef RejectedOptimizations ROpt;
+
+bool IsRejected(const ROpt * rejected, size_t index, ROpt::Check check)
+{
+    return rejected && rejected->isRejected(index, check);
+}
+
+void Reject(ROpt * rejected, size_t index, ROpt::Check check)
+{
+    if (rejected) rejected->reject(index, check);
+}
+
+void Replace(ROpt * rejected, size_t index)
+{
+    if (rejected) rejected->replace(index);
+}
+
+void Erase(ROpt * rejected, size_t first, size_t last)
+{
+    if (rejected) rejected->erase(first, last);
+}
+
+void Insert(ROpt * rejected, size_t index, size_t count)
+{
+    if (rejected) rejected->insert(index, count);
+}
+
 void RemoveNoOpTypes(OpRcPtrVec & opVec)
 {
     OpRcPtrVec::const_iterator iter = opVec.begin();
@@ -103,26 +199,29 @@ void RemoveDynamicProperties(OpRcPtrVec & opVec)
     }
 }
 
-int RemoveNoOps(OpRcPtrVec & opVec)
+int RemoveNoOps(OpRcPtrVec & opVec, ROpt * rejected = nullptr)
 {
     int count = 0;
-    OpRcPtrVec::const_iterator iter = opVec.begin();
-    while (iter != opVec.end())
+    size_t idx = 0;
+    while (idx < opVec.size())
     {
-        if ((*iter)->isNoOp())
+        if (!IsRejected(rejected, idx, ROpt::CHECK_NOOP) && opVec[idx]->isNoOp())
         {
-            iter = opVec.erase(iter);
+            opVec.erase(opVec.begin() + idx);
+            Erase(rejected, idx, idx + 1);
             ++count;
         }
         else
         {
-            ++iter;
+            Reject(rejected, idx, ROpt::CHECK_NOOP);
+            ++idx;
         }
     }
     return count;
 }
 
-int ReplaceIdentityOps(OpRcPtrVec & opVec, OptimizationFlags oFlags)
+int ReplaceIdentityOps(OpRcPtrVec & opVec, OptimizationFlags oFlags,
+                       ROpt * rejected = nullptr)
 {
     int count = 0;
 
@@ -136,6 +235,11 @@ int ReplaceIdentityOps(OpRcPtrVec & opVec, OptimizationFlags oFlags)
         const size_t nbOps = opVec.size();
         for (size_t i = 0; i < nbOps; ++i)
         {
+            if (IsRejected(rejected, i, ROpt::CHECK_IDENTITY))
+            {
+                continue;
+            }
+
             ConstOpRcPtr op = opVec[i];
             const auto type = op->data()->getType();
             if (type != OpData::RangeType && // Do not replace a range identity.
@@ -146,20 +250,32 @@ int ReplaceIdentityOps(OpRcPtrVec & opVec, OptimizationFlags oFlags)
                 // Optimization flag is tested before.
                 auto replacedBy = op->getIdentityReplacement();
                 opVec[i] = replacedBy;
+                Replace(rejected, i);
                 ++count;
             }
+            else
+            {
+                Reject(rejected, i, ROpt::CHECK_IDENTITY);
+            }
         }
     }
     return count;
 }
 
-int RemoveInverseOps(OpRcPtrVec & opVec, OptimizationFlags oFlags)
+int RemoveInverseOps(OpRcPtrVec & opVec, OptimizationFlags oFlags,
+                     ROpt * rejected = nullptr)
 {
     int count      = 0;
     int firstindex = 0; // this must be a signed int
 
     while (firstindex < static_cast<int>(opVec.size() - 1))
     {
+        if (IsRejected(rejected, firstindex, ROpt::CHECK_INVERSE))
+        {
+            ++firstindex;
+            continue;
+        }
+
         ConstOpRcPtr op1 = opVec[firstindex];
         ConstOpRcPtr op2 = opVec[firstindex + 1];
         const auto type1 = op1->data()->getType();
@@ -196,6 +312,7 @@ int RemoveInverseOps(OpRcPtrVec & opVec, OptimizationFlags oFlags)
             if (replacedBy->isNoOp())
             {
                 opVec.erase(opVec.begin() + firstindex, opVec.begin() + firstindex + 2);
+                Erase(rejected, firstindex, firstindex + 2);
                 firstindex = std::max(0, firstindex - 1);
             }
             else
@@ -203,12 +320,15 @@ int RemoveInverseOps(OpRcPtrVec & opVec, OptimizationFlags oFlags)
                 // Forward + inverse does clamp.
                 opVec[firstindex] = replacedBy;
                 opVec.erase(opVec.begin() + firstindex + 1);
+                Erase(rejected, firstindex + 1, firstindex + 2);
+                Replace(rejected, firstindex);
                 ++firstindex;
             }
             ++count;
         }
         else
         {
+            Reject(rejected, firstindex, ROpt::CHECK_INVERSE);
             ++firstindex;
         }
     }
@@ -216,15 +336,23 @@ int RemoveInverseOps(OpRcPtrVec & opVec, OptimizationFlags oFlags)
     return count;
 }
 
-int CombineOps(OpRcPtrVec & opVec, OptimizationFlags oFlags)
+int CombineOps(OpRcPtrVec & opVec, OptimizationFlags oFlags, ROpt * rejected = nullptr)
 {
     int count      = 0;
     int firstindex = 0; // this must be a signed int
 
     OpRcPtrVec tmpops;
 
+    const bool useCosts = IsOpCostTableLoaded();
+
     while (firstindex < static_cast<int>(opVec.size() - 1))
     {
+        if (IsRejected(rejected, firstindex, ROpt::CHECK_COMBINE))
+        {
+            ++firstindex;
+            continue;
+        }
+
         ConstOpRcPtr op1 = opVec[firstindex];
         ConstOpRcPtr op2 = opVec[firstindex + 1];
         const auto type1 = op1->data()->getType();
@@ -234,6 +362,14 @@ int CombineOps(OpRcPtrVec & opVec, OptimizationFlags oFlags)
             tmpops.clear();
             op1->combineWith(tmpops, op2);
 
+            // Only keep the combination if it is not more expensive than the original ops.
+            if (useCosts && GetOpVecCost(tmpops) > GetOpCost(op1) + GetOpCost(op2))
+            {
+                Reject(rejected, firstindex, ROpt::CHECK_COMBINE);
+                ++firstindex;
+                continue;
+            }
+
             // tmpops may have any number of ops in it. (0, 1, 2, ...)
             // (size 0 would occur only if the combination results in a no-op).
             //
@@ -245,6 +381,9 @@ int CombineOps(OpRcPtrVec & opVec, OptimizationFlags oFlags)
             // Insert the new ops (which may be empty) at this location.
             opVec.insert(opVec.begin() + firstindex, tmpops.begin(), tmpops.end());
 
+            Erase(rejected, firstindex, firstindex + 2);
+            Insert(rejected, firstindex, tmpops.size());
+
             // Decrement firstindex by 1,
             // to backstep and reconsider the A, A' case.
             // See RemoveInverseOps for the full discussion of
@@ -256,6 +395,7 @@ int CombineOps(OpRcPtrVec & opVec, OptimizationFlags oFlags)
         }
         else
         {
+            Reject(rejected, firstindex, ROpt::CHECK_COMBINE);
             ++firstindex;
         }
     }
@@ -263,6 +403,147 @@ int CombineOps(OpRcPtrVec & opVec, OptimizationFlags oFlags)
     return count;
 }
 
+// A forward Lut3D evaluates a convex combination of its lattice entries (for both the
+// trilinear and the tetrahedral interpolations).  So an affine op that follows it may be
+// applied directly to the entries without changing the result (lossless).  The same holds
+// for a Range that does not clamp any of the entries.  Other separable ops (e.g. a Lut1D or
+// a clamping Range) may also be applied to the entries but the result is only an
+// approximation (lossy) since the op is then evaluated before the interpolation.
+enum Lut3DAbsorption
+{
+    LUT3D_ABSORB_NONE = 0,
+    LUT3D_ABSORB_LOSSLESS,
+    LUT3D_ABSORB_LOSSY
+};
+
+Lut3DAbsorption GetLut3DAbsorption(const Lut3DOpData & lut, ConstOpRcPtr & op)
+{
+    if (lut.getDirection() != TRANSFORM_DIR_FORWARD || op->isDynamic())
+    {
+        return LUT3D_ABSORB_NONE;
+    }
+
+    auto opData = op->data();
+    switch (opData->getType())
+    {
+    case OpData::MatrixType:
+    {
+        // The Lut3D passes the alpha through so a matrix changing the alpha is kept.
+        auto matrix = OCIO_DYNAMIC_POINTER_CAST<const MatrixOpData>(opData);
+        return matrix->hasAlpha() ? LUT3D_ABSORB_NONE : LUT3D_ABSORB_LOSSLESS;
+    }
+
+    case OpData::RangeType:
+    {
+        auto range = OCIO_DYNAMIC_POINTER_CAST<const RangeOpData>(opData);
+        const bool hasMin = range->hasMinInValue();
+        const bool hasMax = range->hasMaxInValue();
+        const float minIn = hasMin ? (float)range->getMinInValue() : 0.0f;
+        const float maxIn = hasMax ? (float)range->getMaxInValue() : 0.0f;
+
+        for (const auto & val : lut.getArray().getValues())
+        {
+            if ((hasMin && val < minIn) || (hasMax && val > maxIn))
+            {
+                return LUT3D_ABSORB_LOSSY;
+            }
+        }
+        return LUT3D_ABSORB_LOSSLESS;
+    }
+
+    case OpData::Lut1DType:
+        return LUT3D_ABSORB_LOSSY;
+
+    case OpData::CDLType:
+    case OpData::ExponentType:
+    case OpData::ExposureContrastType:
+    case OpData::FixedFunctionType:
+    case OpData::GammaType:
+    case OpData::LogType:
+    case OpData::Lut3DType:
+    case OpData::ReferenceType:
+    case OpData::NoOpType:
+        break;
+    }
+
+    return LUT3D_ABSORB_NONE;
+}
+
+bool IsLut3DAbsorptionEnabled(Lut3DAbsorption absorption,
+                              OpData::Type type,
+                              OptimizationFlags flags)
+{
+    switch (absorption)
+    {
+    case LUT3D_ABSORB_LOSSLESS:
+        // Controlled by the same flags as the composition of the absorbed op.
+        return IsCombineEnabled(type, flags);
+    case LUT3D_ABSORB_LOSSY:
+        // As lossy as the Lut3D composition.
+        return HasFlag(flags, OPTIMIZATION_COMP_LUT3D);
+    case LUT3D_ABSORB_NONE:
+    default:
+        return false;
+    }
+}
+
+// Replace a forward Lut3D followed by a Matrix, Range or Lut1D with a single Lut3D where the
+// second op is applied to the lattice entries.
+int AbsorbIntoLut3D(OpRcPtrVec & opVec, OptimizationFlags oFlags, ROpt * rejected = nullptr)
+{
+    int count = 0;
+    size_t idx = 0;
+
+    while (idx + 1 < opVec.size())
+    {
+        ConstOpRcPtr op1 = opVec[idx];
+        ConstOpRcPtr op2 = opVec[idx + 1];
+
+        if (op1->data()->getType() != OpData::Lut3DType
+            || IsRejected(rejected, idx, ROpt::CHECK_LUT3D_ABSORPTION))
+        {
+            ++idx;
+            continue;
+        }
+
+        auto lut = OCIO_DYNAMIC_POINTER_CAST<const Lut3DOpData>(op1->data());
+        const auto absorption = GetLut3DAbsorption(*lut, op2);
+
+        if (!IsLut3DAbsorptionEnabled(absorption, op2->data()->getType(), oFlags))
+        {
+            Reject(rejected, idx, ROpt::CHECK_LUT3D_ABSORPTION);
+            ++idx;
+            continue;
+        }
+
+        Lut3DOpDataRcPtr newLut = lut->clone();
+
+        newLut->getFormatMetadata().combine(op2->data()->getFormatMetadata());
+
+        // Render the lattice entries through the absorbed op.
+        OpRcPtrVec ops;
+        ops.push_back(op2->clone());
+
+        Array::Values & values = newLut->getArray().getValues();
+        const long gridSize = newLut->getArray().getLength();
+        EvalTransform(values.data(), values.data(), gridSize * gridSize * gridSize, ops);
+
+        OpRcPtrVec lutOps;
+        CreateLut3DOp(lutOps, newLut, TRANSFORM_DIR_FORWARD);
+
+        opVec.erase(opVec.begin() + idx, opVec.begin() + idx + 2);
+        opVec.insert(opVec.begin() + idx, lutOps.begin(), lutOps.end());
+
+        Erase(rejected, idx, idx + 2);
+        Insert(rejected, idx, lutOps.size());
+
+        // Stay on the new Lut3D since it may absorb the following op as well.
+        ++count;
+    }
+
+    return count;
+}
+
 int RemoveLeadingClampIdentity(OpRcPtrVec & opVec)
 {
     int count = 0;
@@ -342,6 +623,14 @@ unsigned FindSeparablePrefix(const OpRcPtrVec & ops)
             break;
         }
 
+        // The 1D LUT does not process the alpha channel.
+        ConstOpRcPtr constOp = op;
+        auto matrix = DynamicPtrCast<const MatrixOpData>(constOp->data());
+        if (matrix && matrix->hasAlpha())
+        {
+            break;
+        }
+
         // Op is separable, keep going.
         prefixLen++;
     }
@@ -363,9 +652,9 @@ unsigned FindSeparablePrefix(const OpRcPtrVec & ops)
         }
     }
 
-    // Some ops are so fast that it may not make sense to replace just one of those.
-    // E.g., if it's just a single matrix, it may not be faster to replace it with a LUT.
-    // So make sure there are some more expensive ops to combine.
+    // Some ops are so fast that it may not make sense to replace them.  Note that the
+    // look-up also replaces the conversion of the input pixels to float.
+    OpRcPtrVec prefixOps;
     unsigned expensiveOps = 0U;
     for (unsigned i = 0; i < prefixLen; ++i)
     {
@@ -377,12 +666,13 @@ unsigned FindSeparablePrefix(const OpRcPtrVec & ops)
             throw Exception("Non-separable op.");
         }
 
+        prefixOps.push_back(op);
+
         ConstOpRcPtr constOp = op;
         if (constOp->data()->getType() == OpData::MatrixType
             || constOp->data()->getType() == OpData::RangeType)
         {
             // Potentially separable, but inexpensive ops.
-            // TODO: Perhaps a LUT is faster once the conversion to float is considered?
         }
         else
         {
@@ -390,7 +680,9 @@ unsigned FindSeparablePrefix(const OpRcPtrVec & ops)
         }
     }
 
-    if (expensiveOps == 0)
+    // Without a cost table, make sure there are some more expensive ops to combine.
+    if (IsOpCostTableLoaded() ? GetOpVecCost(prefixOps) <= GetOpCost(OP_COST_LUT1D_LOOKUP)
+                              : expensiveOps == 0)
     {
         return 0;
     }
@@ -448,6 +740,47 @@ void OptimizeSeparablePrefix(OpRcPtrVec & ops, BitDepth in)
 
     ops.insert(ops.begin(), lutOps.begin(), lutOps.end());
 }
+
+struct OptimizationStats
+{
+    int m_passes      = 0;
+    int m_noops       = 0;
+    int m_identityops = 0;
+    int m_inverseops  = 0;
+    int m_combines    = 0;
+};
+
+// Apply the optimizations until no more progress is made.  When rejected is not null, the
+// rejected optimizations are not checked again by the next passes.
+void OptimizeOpVecPasses(OpRcPtrVec & ops,
+                         OptimizationFlags oFlags,
+                         RejectedOptimizations * rejected,
+                         OptimizationStats & stats)
+{
+    const bool optimizeIdentity = HasFlag(oFlags, OPTIMIZATION_IDENTITY);
+
+    while (stats.m_passes <= MAX_OPTIMIZATION_PASSES)
+    {
+        int noops       = optimizeIdentity ? RemoveNoOps(ops, rejected) : 0;
+        int identityops = ReplaceIdentityOps(ops, oFlags, rejected);
+        int inverseops  = RemoveInverseOps(ops, oFlags, rejected);
+        int combines    = CombineOps(ops, oFlags, rejected);
+        combines       += AbsorbIntoLut3D(ops, oFlags, rejected);
+
+        if (noops + identityops + inverseops + combines == 0)
+        {
+            // No optimization progress was made, so stop trying.
+            break;
+        }
+
+        stats.m_noops += noops;
+        stats.m_identityops += identityops;
+        stats.m_inverseops += inverseops;
+        stats.m_combines += combines;
+
+        ++stats.m_passes;
+    }
+}
 } // namespace
 
 void OptimizeOpVec(OpRcPtrVec & ops,
@@ -485,34 +818,14 @@ void OptimizeOpVec(OpRcPtrVec & ops,
     // preserve their values.
 
     const auto originalSize = ops.size();
-    int total_noops         = 0;
-    int total_identityops   = 0;
-    int total_inverseops    = 0;
-    int total_combines      = 0;
-    int passes              = 0;
+    const float originalCost = IsDebugLoggingEnabled() ? GetOpVecCost(ops) : 0.0f;
 
-    const bool optimizeIdentity = HasFlag(oFlags, OPTIMIZATION_IDENTITY);
-
-    while (passes <= MAX_OPTIMIZATION_PASSES)
+    OptimizationStats stats;
     {
-        int noops       = optimizeIdentity ? RemoveNoOps(ops) : 0;
-        int identityops = ReplaceIdentityOps(ops, oFlags);
-        int inverseops  = RemoveInverseOps(ops, oFlags);
-        int combines    = CombineOps(ops, oFlags);
-
-        if (noops + identityops + inverseops + combines == 0)
-        {
-            // No optimization progress was made, so stop trying.
-            break;
-        }
-
-        total_noops += noops;
-        total_identityops += identityops;
-        total_inverseops += inverseops;
-        total_combines += combines;
-
-        ++passes;
+        RejectedOptimizations rejected(ops.size());
+        OptimizeOpVecPasses(ops, oFlags, &rejected, stats);
     }
+    const int passes = stats.m_passes;
 
     if (!ops.empty())
     {
@@ -549,11 +862,12 @@ void OptimizeOpVec(OpRcPtrVec & ops,
         std::ostringstream os;
         os << "Optimized ";
         os << originalSize << "->" << finalSize << ", ";
+        os << "estimated cost " << originalCost << "->" << GetOpVecCost(ops) << ", ";
         os << passes << " passes, ";
-        os << total_noops << " noops removed, ";
-        os << total_identityops << " identity ops replaced, ";
-        os << total_inverseops << " inverse ops removed\n";
-        os << total_combines << " ops combines\n";
+        os << stats.m_noops << " noops removed, ";
+        os << stats.m_identityops << " identity ops replaced, ";
+        os << stats.m_inverseops << " inverse ops removed\n";
+        os << stats.m_combines << " ops combines\n";
         os << SerializeOpVec(ops, 4);
         LogDebug(os.str());
     }
@@ -0,0 +1,186 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+#include <list>
+#include <map>
+#include <sstream>
+
+#include <OpenColorIO/OpenColorIO.h>
+
+#include "Mutex.h"
+#include "ops/lut1d/Lut1DOpData.h"
+#include "ops/lut3d/Lut3DOpData.h"
+#include "OpVecCache.h"
+
+
+namespace OCIO_NAMESPACE
+{
+namespace
+{
+
+struct OpVecCacheEntry
+{
+    OpRcPtrVec m_ops;
+    size_t m_memory = 0;
+    // Position in the least recently used list.
+    std::list<std::string>::iterator m_lruPos;
+};
+
+typedef std::map<std::string, OpVecCacheEntry> OpVecCacheMap;
+
+Mutex g_opVecCacheMutex;
+OpVecCacheMap g_opVecCache;
+// The most recently used key is at the front.
+std::list<std::string> g_opVecCacheLRU;
+size_t g_opVecCacheMemory = 0;
+size_t g_opVecCacheMaxMemory = 256 * 1024 * 1024;
+
+// Estimate the memory used by the ops where only the LUTs really matter.
+size_t EstimateMemory(const OpRcPtrVec & ops)
+{
+    size_t memory = 0;
+    for (const auto & op : ops)
+    {
+        ConstOpRcPtr constOp = op;
+        auto data = constOp->data();
+
+        memory += 512;
+
+        if (data->getType() == OpData::Lut1DType)
+        {
+            auto lut = OCIO_DYNAMIC_POINTER_CAST<const Lut1DOpData>(data);
+            memory += lut->getArray().getNumValues() * sizeof(float);
+        }
+        else if (data->getType() == OpData::Lut3DType)
+        {
+            auto lut = OCIO_DYNAMIC_POINTER_CAST<const Lut3DOpData>(data);
+            memory += lut->getArray().getNumValues() * sizeof(float);
+        }
+    }
+    return memory;
+}
+
+// You must manually acquire the cache mutex before calling this.
+void EvictOpVecs()
+{
+    while (g_opVecCacheMemory > g_opVecCacheMaxMemory && !g_opVecCacheLRU.empty())
+    {
+        auto iter = g_opVecCache.find(g_opVecCacheLRU.back());
+        g_opVecCacheMemory -= iter->second.m_memory;
+        g_opVecCache.erase(iter);
+        g_opVecCacheLRU.pop_back();
+    }
+}
+
+// Return an empty key if the op chain cannot be cached.
+std::string CreateKey(const OpRcPtrVec & rawOps, const std::string & processingDesc)
+{
+    std::ostringstream oss;
+    oss << processingDesc << " ops:";
+
+    for (const auto & op : rawOps)
+    {
+        // The no-op types (e.g. file and look markers) are always removed by the optimizer.
+        if (op->isNoOpType())
+        {
+            continue;
+        }
+
+        // Dynamic properties are specific to a processor.
+        if (op->isDynamic())
+        {
+            return "";
+        }
+
+        // The ops must be finalized to have a cache identifier.
+        const std::string id = op->getCacheID();
+        if (id.empty())
+        {
+            return "";
+        }
+
+        oss << " " << id;
+    }
+
+    return oss.str();
+}
+
+} // anon.
+
+void FinalizeOpVecCached(OpRcPtrVec & ops,
+                         const OpRcPtrVec & rawOps,
+                         const std::string & processingDesc,
+                         const OpVecFinalizer & finalizer)
+{
+    const std::string key = CreateKey(rawOps, processingDesc);
+    if (key.empty())
+    {
+        ops = rawOps;
+        finalizer(ops);
+        return;
+    }
+
+    {
+        AutoMutex lock(g_opVecCacheMutex);
+
+        auto iter = g_opVecCache.find(key);
+        if (iter != g_opVecCache.end())
+        {
+            g_opVecCacheLRU.splice(g_opVecCacheLRU.begin(), g_opVecCacheLRU, iter->second.m_lruPos);
+            ops = iter->second.m_ops;
+            return;
+        }
+    }
+
+    // The cached ops are shared between processors so the optimization and finalization
+    // must not alter the raw ops (that the processor could finalize differently later).
+    // Note: The lock is not held during the finalization to avoid serializing all the
+    // processor creations.
+    ops = rawOps.clone();
+    finalizer(ops);
+
+    AutoMutex lock(g_opVecCacheMutex);
+
+    // Another thread may have already added the same ops.
+    if (g_opVecCache.find(key) == g_opVecCache.end())
+    {
+        OpVecCacheEntry & entry = g_opVecCache[key];
+        entry.m_ops = ops;
+        entry.m_memory = EstimateMemory(ops);
+
+        g_opVecCacheLRU.push_front(key);
+        entry.m_lruPos = g_opVecCacheLRU.begin();
+
+        g_opVecCacheMemory += entry.m_memory;
+        EvictOpVecs();
+    }
+}
+
+void ClearOpVecCache()
+{
+    AutoMutex lock(g_opVecCacheMutex);
+
+    g_opVecCache.clear();
+    g_opVecCacheLRU.clear();
+    g_opVecCacheMemory = 0;
+}
+
+size_t GetOpVecCacheSize()
+{
+    AutoMutex lock(g_opVecCacheMutex);
+
+    return g_opVecCache.size();
+}
+
+size_t SetOpVecCacheMaxMemory(size_t maxMemory)
+{
+    AutoMutex lock(g_opVecCacheMutex);
+
+    const size_t prevMaxMemory = g_opVecCacheMaxMemory;
+    g_opVecCacheMaxMemory = maxMemory;
+    EvictOpVecs();
+
+    return prevMaxMemory;
+}
+
+} // namespace OCIO_NAMESPACE
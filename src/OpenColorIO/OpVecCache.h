@@ -0,0 +1,45 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+
+#ifndef INCLUDED_OCIO_OPVECCACHE_H
+#define INCLUDED_OCIO_OPVECCACHE_H
+
+#include <functional>
+#include <string>
+
+#include <OpenColorIO/OpenColorIO.h>
+
+#include "Op.h"
+
+
+namespace OCIO_NAMESPACE
+{
+
+// Different processors often end up with identical op chains (e.g. several display/view pairs
+// sharing the same output transform) so the optimized & finalized op chains are kept in a
+// process-wide cache.  The key is made of the cache identifiers of the raw ops and of the
+// processing description (i.e. bit-depths and optimization flags).
+
+typedef std::function<void(OpRcPtrVec & ops)> OpVecFinalizer;
+
+// Return in ops the result of the finalizer applied to a copy of rawOps. The result is reused
+// for any identical raw op chain having the same processing description. Note that op chains
+// with dynamic properties are never cached as the dynamic properties could not be shared.
+void FinalizeOpVecCached(OpRcPtrVec & ops,
+                         const OpRcPtrVec & rawOps,
+                         const std::string & processingDesc,
+                         const OpVecFinalizer & finalizer);
+
+void ClearOpVecCache();
+
+// Number of op chains in the cache.
+size_t GetOpVecCacheSize();
+
+// The least recently used op chains are removed when the estimated memory used by the cached
+// ops exceeds the limit. Return the previous limit (in bytes).
+size_t SetOpVecCacheMaxMemory(size_t maxMemory);
+
+} // namespace OCIO_NAMESPACE
+
+#endif
@@ -11,6 +11,7 @@
 
 #include <OpenColorIO/OpenColorIO.h>
 
+#include "FileWatcher.h"
 #include "Mutex.h"
 #include "PathUtils.h"
 #include "Platform.h"
@@ -34,9 +35,7 @@ extern char **environ;
 
 namespace OCIO_NAMESPACE
 {
-namespace
-{
-std::string ComputeHash(const std::string & filename)
+std::string ComputeFastFileHash(const std::string & filename)
 {
     struct stat results;
     if (stat(filename.c_str(), &results) == 0)
@@ -51,6 +50,8 @@ std::string ComputeHash(const std::string & filename)
     return "";
 }
 
+namespace
+{
 // We mutex both the main map and each item individually, so that
 // the potentially slow stat calls dont block other lookups to already
 // existing items. (The stat calls will block other lookups on the
@@ -97,7 +98,9 @@ std::string GetFastFileHash(const std::string & filename)
         if(!fileHashResultPtr->ready)
         {
             fileHashResultPtr->ready = true;
-            fileHashResultPtr->hash = ComputeHash(filename);
+            fileHashResultPtr->hash = ComputeFastFileHash(filename);
+
+            WatchFile(filename, fileHashResultPtr->hash);
         }
 
         hash = fileHashResultPtr->hash;
@@ -106,6 +109,21 @@ std::string GetFastFileHash(const std::string & filename)
     return hash;
 }
 
+void SetFastFileHash(const std::string & filename, const std::string & hash)
+{
+    FileHashResultPtr fileHashResultPtr = FileHashResultPtr(new FileHashResult);
+    fileHashResultPtr->ready = true;
+    fileHashResultPtr->hash = hash;
+
+    {
+        AutoMutex lock(g_fastFileHashCache_mutex);
+        g_fastFileHashCache[filename] = fileHashResultPtr;
+    }
+
+    // The file could change after the hash was computed (e.g. by a config snapshot).
+    WatchFile(filename, hash);
+}
+
 bool FileExists(const std::string & filename)
 {
     std::string hash = GetFastFileHash(filename);
@@ -118,6 +136,12 @@ void ClearPathCaches()
     g_fastFileHashCache.clear();
 }
 
+void ClearPathCaches(const std::string & filename)
+{
+    AutoMutex lock(g_fastFileHashCache_mutex);
+    g_fastFileHashCache.erase(filename);
+}
+
 namespace
 {
 std::string GetCwd()
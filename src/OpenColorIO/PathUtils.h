@@ -54,8 +54,19 @@ bool FileExists(const std::string & filename);
 // Currently, this checks the mtime and the inode number.
 std::string GetFastFileHash(const std::string & filename);
 
+// Compute the fast hash of a file, bypassing the cache. Return an empty string if the file
+// does not exist.
+std::string ComputeFastFileHash(const std::string & filename);
+
+// Set the fast hash of a file (e.g. from a config snapshot) so that the file system is not
+// queried again until the path caches are cleared.
+void SetFastFileHash(const std::string & filename, const std::string & hash);
+
 void ClearPathCaches();
 
+// Only remove the fast hash of the file.
+void ClearPathCaches(const std::string & filename);
+
 int ParseColorSpaceFromString(const Config & config, const char * str);
 
 } // namespace OCIO_NAMESPACE
@@ -10,7 +10,12 @@
 #include "Platform.h"
 
 #ifndef _WIN32
+#include <dirent.h>
+#include <fcntl.h>
 #include <strings.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
 #endif
 
 
@@ -145,6 +150,140 @@ std::string CreateTempFilename(const std::string & filenameExt)
     return filename;
 }
 
+bool ListDirectory(const std::string & dirname, std::vector<std::string> & names)
+{
+    names.clear();
+
+#ifdef _WIN32
+
+    WIN32_FIND_DATAA data;
+    HANDLE handle = FindFirstFileA((dirname + "\\*").c_str(), &data);
+    if (handle == INVALID_HANDLE_VALUE)
+    {
+        return false;
+    }
+
+    do
+    {
+        const std::string name(data.cFileName);
+        if (name != "." && name != "..")
+        {
+            names.push_back(name);
+        }
+    }
+    while (FindNextFileA(handle, &data));
+
+    FindClose(handle);
+
+#else
+
+    DIR * dir = opendir(dirname.c_str());
+    if (!dir)
+    {
+        return false;
+    }
+
+    while (const struct dirent * entry = readdir(dir))
+    {
+        const std::string name(entry->d_name);
+        if (name != "." && name != "..")
+        {
+            names.push_back(name);
+        }
+    }
+
+    closedir(dir);
+
+#endif
+
+    return true;
+}
+
+bool MapFile(const std::string & filepath, const char *& data, size_t & size)
+{
+    data = nullptr;
+    size = 0;
+
+#ifdef _WIN32
+
+    HANDLE file = CreateFileA(filepath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                              OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+    {
+        return false;
+    }
+
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart == 0)
+    {
+        CloseHandle(file);
+        return false;
+    }
+
+    HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    CloseHandle(file);
+    if (!mapping)
+    {
+        return false;
+    }
+
+    // The view keeps the mapping alive.
+    const void * view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    CloseHandle(mapping);
+    if (!view)
+    {
+        return false;
+    }
+
+    data = static_cast<const char *>(view);
+    size = static_cast<size_t>(fileSize.QuadPart);
+
+#else
+
+    const int fd = open(filepath.c_str(), O_RDONLY);
+    if (fd < 0)
+    {
+        return false;
+    }
+
+    struct stat results;
+    if (fstat(fd, &results) != 0 || results.st_size <= 0)
+    {
+        close(fd);
+        return false;
+    }
+
+    void * view = mmap(nullptr, static_cast<size_t>(results.st_size), PROT_READ, MAP_SHARED,
+                       fd, 0);
+    // The mapping stays valid once the file is closed.
+    close(fd);
+    if (view == MAP_FAILED)
+    {
+        return false;
+    }
+
+    data = static_cast<const char *>(view);
+    size = static_cast<size_t>(results.st_size);
+
+#endif
+
+    return true;
+}
+
+void UnmapFile(const char * data, size_t size)
+{
+    if (!data)
+    {
+        return;
+    }
+
+#ifdef _WIN32
+    UnmapViewOfFile(data);
+#else
+    munmap(const_cast<char *>(data), size);
+#endif
+}
+
 
 
 } // Platform
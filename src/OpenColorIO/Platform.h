@@ -21,6 +21,7 @@
 
 
 #include <string>
+#include <vector>
 
 
 // Missing functions on Windows.
@@ -65,6 +66,17 @@ void AlignedFree(void * memBlock);
 //       the file if created.
 std::string CreateTempFilename(const std::string & filenameExt);
 
+// List the names of the entries of a directory (excluding '.' and '..').  Return false if
+// the directory cannot be read.
+bool ListDirectory(const std::string & dirname, std::vector<std::string> & names);
+
+// Map the whole file in memory for reading. The pages are shared with the other processes
+// mapping the same file. Return false if the file cannot be mapped (e.g. empty file).
+bool MapFile(const std::string & filepath, const char *& data, size_t & size);
+
+// Unmap a file mapped with MapFile.
+void UnmapFile(const char * data, size_t size);
+
 }
 
 } // namespace OCIO_NAMESPACE
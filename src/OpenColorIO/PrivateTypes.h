@@ -9,6 +9,7 @@
 
 #include <map>
 #include <set>
+#include <unordered_map>
 #include <vector>
 
 
@@ -18,6 +19,9 @@ namespace OCIO_NAMESPACE
 typedef std::map<std::string, std::string> StringMap;
 typedef std::map<std::string, bool> StringBoolMap;
 typedef std::set<std::string> StringSet;
+// Case-insensitive name lookup i.e. the keys are the lowercase names and the values are
+// the positions in the list of named elements.
+typedef std::unordered_map<std::string, size_t> NameIndexMap;
 
 typedef std::vector<ConstTransformRcPtr> ConstTransformVec;
 typedef std::vector<LookRcPtr> LookVec;
@@ -42,6 +46,23 @@ enum LutInversionQuality
     LUT_INVERSION_FAST
 };
 
+// Specify the accuracy of the log2, exp2 and pow evaluations of the CPU renderers of the
+// Log, Gamma and Exponent ops.  The EXACT accuracy relies on the standard library
+// functions.  The HIGH accuracy uses the SSE polynomial approximations (relative error of
+// a 2.4 gamma about 2.6e-5 i.e. 15 bits of mantissa) and is the default.  Note that the
+// Exponent op has always used the standard library so HIGH is the same as EXACT for it.
+// The PREVIEW accuracy uses lower degree polynomials (relative error of a 2.4 gamma about
+// 1.1e-3 i.e. 10 bits of mantissa) for interactive use.  The approximations are only
+// available when SSE is enabled, otherwise the EXACT method is always used.  See SSE.h
+// for the error bounds.
+//
+enum MathAccuracy
+{
+    MATH_ACCURACY_EXACT = 0,
+    MATH_ACCURACY_HIGH,
+    MATH_ACCURACY_PREVIEW
+};
+
 } // namespace OCIO_NAMESPACE
 
 #endif
@@ -19,6 +19,39 @@
 namespace OCIO_NAMESPACE
 {
 
+namespace
+{
+
+// Only the transforms which are costly to build (i.e. they load files or resolve config
+// elements) and which are fully described by their serialization have a key.
+std::string GetReusableTransformKey(const ConstTransformRcPtr & transform,
+                                    TransformDirection dir)
+{
+    std::ostringstream oss;
+    if (ConstFileTransformRcPtr fileTransform = DynamicPtrCast<const FileTransform>(transform))
+    {
+        oss << *fileTransform;
+    }
+    else if (ConstColorSpaceTransformRcPtr colorSpaceTransform
+                = DynamicPtrCast<const ColorSpaceTransform>(transform))
+    {
+        oss << *colorSpaceTransform;
+    }
+    else if (ConstLookTransformRcPtr lookTransform = DynamicPtrCast<const LookTransform>(transform))
+    {
+        oss << *lookTransform;
+    }
+    else
+    {
+        return "";
+    }
+
+    oss << " " << TransformDirectionToString(dir);
+    return oss.str();
+}
+
+} // anon.
+
 class ProcessorMetadata::Impl
 {
 public:
@@ -228,7 +261,8 @@ ConstCPUProcessorRcPtr Processor::getOptimizedCPUProcessor(BitDepth inBitDepth,
 
 
 Processor::Impl::Impl():
-    m_metadata(ProcessorMetadata::Create())
+    m_metadata(ProcessorMetadata::Create()),
+    m_cpuRenderers(std::make_shared<CPURendererCache>())
 {
 }
 
@@ -342,14 +376,15 @@ const char * Processor::Impl::getCacheID() const
     }
     else
     {
-        std::ostringstream cacheid;
+        // Hash the op cache identifiers in place instead of concatenating them.
+        CacheIDHasher hasher;
         for(const auto & op : m_ops)
         {
-            cacheid << op->getCacheID() << " ";
+            hasher.append(op->getCacheID());
+            hasher.append(" ", 1);
         }
-        std::string fullstr = cacheid.str();
 
-        m_cpuCacheID = CacheIDHash(fullstr.c_str(), (int)fullstr.size());
+        m_cpuCacheID = hasher.getPrintableHash();
     }
 
     return m_cpuCacheID.c_str();
@@ -390,7 +425,7 @@ ConstCPUProcessorRcPtr Processor::Impl::getDefaultCPUProcessor() const
 {
     CPUProcessorRcPtr cpu = CPUProcessorRcPtr(new CPUProcessor(), &CPUProcessor::deleter);
 
-    cpu->getImpl()->finalize(m_ops, BIT_DEPTH_F32, BIT_DEPTH_F32, OPTIMIZATION_DEFAULT);
+    cpu->getImpl()->finalize(m_ops, BIT_DEPTH_F32, BIT_DEPTH_F32, OPTIMIZATION_DEFAULT, m_cpuRenderers.get());
 
     return cpu;
 }
@@ -399,7 +434,7 @@ ConstCPUProcessorRcPtr Processor::Impl::getOptimizedCPUProcessor(OptimizationFla
 {
     CPUProcessorRcPtr cpu = CPUProcessorRcPtr(new CPUProcessor(), &CPUProcessor::deleter);
 
-    cpu->getImpl()->finalize(m_ops, BIT_DEPTH_F32, BIT_DEPTH_F32, oFlags);
+    cpu->getImpl()->finalize(m_ops, BIT_DEPTH_F32, BIT_DEPTH_F32, oFlags, m_cpuRenderers.get());
 
     return cpu;
 }
@@ -410,7 +445,7 @@ ConstCPUProcessorRcPtr Processor::Impl::getOptimizedCPUProcessor(BitDepth inBitD
 {
     CPUProcessorRcPtr cpu = CPUProcessorRcPtr(new CPUProcessor(), &CPUProcessor::deleter);
 
-    cpu->getImpl()->finalize(m_ops, inBitDepth, outBitDepth, oFlags);
+    cpu->getImpl()->finalize(m_ops, inBitDepth, outBitDepth, oFlags, m_cpuRenderers.get());
 
     return cpu;
 }
@@ -438,7 +473,9 @@ void Processor::Impl::setColorSpaceConversion(const Config & config,
 void Processor::Impl::setTransform(const Config & config,
                                    const ConstContextRcPtr & context,
                                    const ConstTransformRcPtr& transform,
-                                   TransformDirection direction)
+                                   TransformDirection direction,
+                                   const std::string & buildID,
+                                   const Impl * previous)
 {
     if (!m_ops.empty())
     {
@@ -447,12 +484,107 @@ void Processor::Impl::setTransform(const Config & config,
 
     transform->validate();
 
-    BuildOps(m_ops, config, context, transform, direction);
+    m_buildID = buildID;
+
+    ReusableOps reusableOps;
+    if (previous && !m_buildID.empty() && previous->m_buildID == m_buildID)
+    {
+        for (const auto & transformOps : previous->m_transformOps)
+        {
+            if (!transformOps.m_key.empty())
+            {
+                reusableOps.emplace(transformOps.m_key, &transformOps.m_ops);
+            }
+        }
+
+        m_cpuRenderers = previous->m_cpuRenderers;
+    }
+
+    buildTransformOps(config, context, transform, direction, reusableOps);
 
-    m_ops.finalize(OPTIMIZATION_NONE);
     m_ops.unifyDynamicProperties();
 }
 
+// Build the ops the same way as BuildOps does, but transform by transform within the groups
+// so that the ops of each transform are either reused or built & finalized separately.
+void Processor::Impl::buildTransformOps(const Config & config,
+                                        const ConstContextRcPtr & context,
+                                        const ConstTransformRcPtr & transform,
+                                        TransformDirection direction,
+                                        ReusableOps & reusableOps)
+{
+    if (ConstGroupTransformRcPtr group = DynamicPtrCast<const GroupTransform>(transform))
+    {
+        const TransformDirection combinedDir
+            = CombineTransformDirections(direction, group->getDirection());
+
+        if (combinedDir == TRANSFORM_DIR_FORWARD || combinedDir == TRANSFORM_DIR_INVERSE)
+        {
+            // Refer to BuildGroupOps.
+            if (m_ops.empty())
+            {
+                m_ops.getFormatMetadata() = group->getFormatMetadata();
+            }
+
+            const int numTransforms = group->getNumTransforms();
+            for (int i = 0; i < numTransforms; ++i)
+            {
+                const int idx = (combinedDir == TRANSFORM_DIR_FORWARD) ? i : numTransforms - 1 - i;
+                buildTransformOps(config, context, group->getTransform(idx), combinedDir,
+                                  reusableOps);
+            }
+            return;
+        }
+    }
+
+    TransformOps transformOps;
+    transformOps.m_key = GetReusableTransformKey(transform, direction);
+
+    // Reuse the ops built for an identical transform.
+    auto reusable = transformOps.m_key.empty() ? reusableOps.end()
+                                               : reusableOps.find(transformOps.m_key);
+    if (reusable != reusableOps.end())
+    {
+        transformOps.m_ops = *reusable->second;
+        // Each previous transform is only reused once.
+        reusableOps.erase(reusable);
+
+        for (const auto & op : transformOps.m_ops)
+        {
+            m_ops.push_back(op);
+        }
+    }
+    else
+    {
+        const FormatMetadataImpl metadata = m_ops.getFormatMetadata();
+        const size_t start = m_ops.size();
+
+        BuildOps(m_ops, config, context, transform, direction);
+
+        for (size_t idx = start; idx < m_ops.size(); ++idx)
+        {
+            m_ops[idx]->finalize(OPTIMIZATION_NONE);
+
+            // The dynamic properties are specific to a processor.
+            if (m_ops[idx]->isDynamic())
+            {
+                transformOps.m_key.clear();
+            }
+
+            transformOps.m_ops.push_back(m_ops[idx]);
+        }
+
+        // The ops of a transform also altering the processor metadata (e.g. a CLF file) are
+        // not reused as the metadata would be missing.
+        if (!(m_ops.getFormatMetadata() == metadata))
+        {
+            transformOps.m_key.clear();
+        }
+    }
+
+    m_transformOps.push_back(transformOps);
+}
+
 void Processor::Impl::concatenate(ConstProcessorRcPtr & p1, ConstProcessorRcPtr & p2)
 {
     m_ops = p1->getImpl()->m_ops;
@@ -5,8 +5,12 @@
 #ifndef INCLUDED_OCIO_PROCESSOR_H
 #define INCLUDED_OCIO_PROCESSOR_H
 
+#include <map>
+#include <vector>
+
 #include <OpenColorIO/OpenColorIO.h>
 
+#include "CPUProcessor.h"
 #include "Mutex.h"
 #include "Op.h"
 #include "PrivateTypes.h"
@@ -21,6 +25,21 @@ private:
     // Vector of ops for the processor.
     OpRcPtrVec m_ops;
 
+    // The ops built by each transform of the flattened transform tree, so that a processor
+    // rebuilt from a modified tree only builds the ops of the transforms that changed.
+    struct TransformOps
+    {
+        // Empty when the ops cannot be reused.
+        std::string m_key;
+        OpRcPtrVec m_ops;
+    };
+    std::vector<TransformOps> m_transformOps;
+    // Identifies the config, the context and the file caches used to build the ops.
+    std::string m_buildID;
+
+    // Renderers of the CPU processors, shared with the processors rebuilt from this one.
+    CPURendererCacheRcPtr m_cpuRenderers;
+
     mutable std::string m_cpuCacheID;
 
     mutable Mutex m_resultsCacheMutex;
@@ -80,14 +99,27 @@ public:
                                  const ConstColorSpaceRcPtr & srcColorSpace,
                                  const ConstColorSpaceRcPtr & dstColorSpace);
 
+    // The ops of the transforms that did not change are reused from the optional previous
+    // processor when both have the same build identifier (refer to m_buildID).
     void setTransform(const Config & config,
                       const ConstContextRcPtr & context,
                       const ConstTransformRcPtr& transform,
-                      TransformDirection direction);
+                      TransformDirection direction,
+                      const std::string & buildID = "",
+                      const Impl * previous = nullptr);
 
     void concatenate(ConstProcessorRcPtr & p1, ConstProcessorRcPtr & p2);
 
     void computeMetadata();
+
+private:
+    typedef std::multimap<std::string, const OpRcPtrVec *> ReusableOps;
+
+    void buildTransformOps(const Config & config,
+                           const ConstContextRcPtr & context,
+                           const ConstTransformRcPtr & transform,
+                           TransformDirection direction,
+                           ReusableOps & reusableOps);
 };
 
 } // namespace OCIO_NAMESPACE
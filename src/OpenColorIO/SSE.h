@@ -9,12 +9,14 @@
 #ifdef USE_SSE
 
 
+#include <cmath>
 #include <emmintrin.h>
 #include <stdio.h>
 
 
 #include <OpenColorIO/OpenColorIO.h>
 
+#include "PrivateTypes.h"
 
 
 namespace OCIO_NAMESPACE
@@ -271,6 +273,179 @@ inline __m128 ssePower(__m128 x, __m128 exp)
     return values;
 }
 
+// Coefficients of minimax degree 3 polynomial approximation to log2() over the
+// range [1.0, 2.0[.  The maximum absolute error is 6.4e-4.
+static const __m128 PNLOG3_PREVIEW = _mm_set1_ps((float)+1.582487027650351e-1);
+static const __m128 PNLOG2_PREVIEW = _mm_set1_ps((float)-1.051875022452731);
+static const __m128 PNLOG1_PREVIEW = _mm_set1_ps((float)+3.047884148002948);
+static const __m128 PNLOG0_PREVIEW = _mm_set1_ps((float)-2.153620711030510);
+
+// Coefficients of minimax degree 3 polynomial approximation to exp2() over the
+// range [0.0, 1.0[.  The maximum relative error is 7.5e-5.
+static const __m128 PNEXP3_PREVIEW = _mm_set1_ps((float)7.802452266443176e-2);
+static const __m128 PNEXP2_PREVIEW = _mm_set1_ps((float)2.260671553931302e-1);
+static const __m128 PNEXP1_PREVIEW = _mm_set1_ps((float)6.958335405064480e-1);
+static const __m128 PNEXP0_PREVIEW = _mm_set1_ps((float)9.999252185640100e-1);
+
+// Lower accuracy version of sseLog2 for preview purposes.
+//
+// Same argument reduction as sseLog2 but the mantissa is evaluated with a degree 3
+// polynomial.
+inline __m128 sseLog2Preview(__m128 x)
+{
+    __m128 mantissa
+        = _mm_or_ps(
+            _mm_andnot_ps(_mm_castsi128_ps(EMASK), x), EONE);
+
+    __m128 log2
+        = _mm_add_ps(
+            _mm_mul_ps(
+                _mm_add_ps(
+                    _mm_mul_ps(
+                        _mm_add_ps(
+                            _mm_mul_ps(PNLOG3_PREVIEW, mantissa),
+                            PNLOG2_PREVIEW),
+                        mantissa),
+                    PNLOG1_PREVIEW),
+                mantissa),
+            PNLOG0_PREVIEW);
+
+    __m128i exponent
+        = _mm_sub_epi32(
+            _mm_srli_epi32(
+                _mm_and_si128(_mm_castps_si128(x),
+                    EMASK),
+                EXP_SHIFT),
+            EBIAS);
+
+    log2 = _mm_add_ps(log2, _mm_cvtepi32_ps(exponent));
+
+    return log2;
+}
+
+// Lower accuracy version of sseExp2 for preview purposes.
+//
+// Same argument reduction and underflow/overflow handling as sseExp2 but the fraction
+// is evaluated with a degree 3 polynomial.
+inline __m128 sseExp2Preview(__m128 x)
+{
+    __m128i floor_x
+        = _mm_add_epi32(
+            _mm_cvttps_epi32(x),
+            _mm_castps_si128(
+                _mm_cmpnle_ps(EZERO, x)));
+
+    __m128 zf
+        = _mm_castsi128_ps(
+            _mm_slli_epi32(
+                _mm_add_epi32(floor_x, EBIAS),
+                EXP_SHIFT));
+
+    __m128 iexp = _mm_cvtepi32_ps(floor_x);
+    __m128 fraction = _mm_sub_ps(x, iexp);
+
+    __m128 mexp
+        = _mm_add_ps(
+            _mm_mul_ps(
+                _mm_add_ps(
+                    _mm_mul_ps(
+                        _mm_add_ps(
+                            _mm_mul_ps(PNEXP3_PREVIEW, fraction),
+                            PNEXP2_PREVIEW),
+                        fraction),
+                    PNEXP1_PREVIEW),
+                fraction),
+            PNEXP0_PREVIEW);
+
+    __m128 exp2 = _mm_mul_ps(zf, mexp);
+
+    exp2 = _mm_andnot_ps(_mm_cmplt_ps(iexp, ENEG126), exp2);
+    exp2 = sseSelect(_mm_cmpgt_ps(iexp, EPOS127), EPOSINF, exp2);
+
+    return exp2;
+}
+
+// Lower accuracy version of ssePower for preview purposes.
+//
+// The relative error is approximately 4.4e-4 * |exp| + 7.5e-5, i.e. 1.1e-3 (about 10 bits
+// of mantissa) for a gamma of 2.4.  Results from base values smaller
+// than zero are mapped to zero.
+inline __m128 ssePowerPreview(__m128 x, __m128 exp)
+{
+    __m128 values = sseLog2Preview(x);
+
+    values = _mm_mul_ps(exp, values);
+
+    values = sseExp2Preview(values);
+
+    values = _mm_and_ps(values, _mm_cmpgt_ps(x, EZERO));
+
+    return values;
+}
+
+// Selection of the log2, exp2 and power implementations according to the requested
+// accuracy (refer to MathAccuracy).  It is used as a template argument by the renderers
+// so that the choice is made once, when the renderer is created.
+//
+// MATH_ACCURACY_EXACT   : Scalar evaluation of each lane using the standard library.
+// MATH_ACCURACY_HIGH    : sseLog2 (absolute error 1.4e-5), sseExp2 (relative error 2.7e-6).
+// MATH_ACCURACY_PREVIEW : sseLog2Preview (absolute error 6.4e-4), sseExp2Preview
+//                         (relative error 7.5e-5).
+template<MathAccuracy accuracy> struct SSEMath;
+
+template<> struct SSEMath<MATH_ACCURACY_EXACT>
+{
+    static inline __m128 Log2(__m128 x)
+    {
+        OCIO_ALIGN(float v[4]);
+        _mm_store_ps(v, x);
+        v[0] = std::log2(v[0]);
+        v[1] = std::log2(v[1]);
+        v[2] = std::log2(v[2]);
+        v[3] = std::log2(v[3]);
+        return _mm_load_ps(v);
+    }
+
+    static inline __m128 Exp2(__m128 x)
+    {
+        OCIO_ALIGN(float v[4]);
+        _mm_store_ps(v, x);
+        v[0] = std::exp2(v[0]);
+        v[1] = std::exp2(v[1]);
+        v[2] = std::exp2(v[2]);
+        v[3] = std::exp2(v[3]);
+        return _mm_load_ps(v);
+    }
+
+    static inline __m128 Power(__m128 x, __m128 exp)
+    {
+        OCIO_ALIGN(float v[4]);
+        OCIO_ALIGN(float e[4]);
+        _mm_store_ps(v, x);
+        _mm_store_ps(e, exp);
+        for (int i = 0; i < 4; ++i)
+        {
+            // Results from base values smaller than zero are mapped to zero (like ssePower).
+            v[i] = v[i] > 0.0f ? std::pow(v[i], e[i]) : 0.0f;
+        }
+        return _mm_load_ps(v);
+    }
+};
+
+template<> struct SSEMath<MATH_ACCURACY_HIGH>
+{
+    static inline __m128 Log2(__m128 x) { return sseLog2(x); }
+    static inline __m128 Exp2(__m128 x) { return sseExp2(x); }
+    static inline __m128 Power(__m128 x, __m128 exp) { return ssePower(x, exp); }
+};
+
+template<> struct SSEMath<MATH_ACCURACY_PREVIEW>
+{
+    static inline __m128 Log2(__m128 x) { return sseLog2Preview(x); }
+    static inline __m128 Exp2(__m128 x) { return sseExp2Preview(x); }
+    static inline __m128 Power(__m128 x, __m128 exp) { return ssePowerPreview(x, exp); }
+};
+
 static const __m128 ESIGN_MASK = _mm_castsi128_ps(_mm_set1_epi32(0x80000000));
 static const __m128 EABS_MASK  = _mm_castsi128_ps(_mm_set1_epi32(0x7fffffff));
 
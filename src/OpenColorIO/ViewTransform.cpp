@@ -6,6 +6,7 @@
 #include <OpenColorIO/OpenColorIO.h>
 
 #include "Categories.h"
+#include "LazyTransform.h"
 
 namespace OCIO_NAMESPACE
 {
@@ -18,8 +19,8 @@ public:
     std::string m_description;
     ReferenceSpaceType m_referenceSpaceType{ REFERENCE_SPACE_SCENE };
 
-    TransformRcPtr m_toRefTransform;
-    TransformRcPtr m_fromRefTransform;
+    LazyTransform m_toRefTransform;
+    LazyTransform m_fromRefTransform;
 
     Impl() = delete;
     Impl(ReferenceSpaceType referenceSpace)
@@ -41,12 +42,8 @@ public:
 
             m_referenceSpaceType = rhs.m_referenceSpaceType;
 
-            m_toRefTransform = rhs.m_toRefTransform ? rhs.m_toRefTransform->createEditableCopy() :
-                                                      rhs.m_toRefTransform;
-
-            m_fromRefTransform = rhs.m_fromRefTransform ?
-                                 rhs.m_fromRefTransform->createEditableCopy() :
-                                 rhs.m_fromRefTransform;
+            m_toRefTransform = rhs.m_toRefTransform;
+            m_fromRefTransform = rhs.m_fromRefTransform;
 
             m_categories = rhs.m_categories;
         }
@@ -152,11 +149,11 @@ ConstTransformRcPtr ViewTransform::getTransform(ViewTransformDirection dir) cons
 {
     if (dir == VIEWTRANSFORM_DIR_TO_REFERENCE)
     {
-        return getImpl()->m_toRefTransform;
+        return getImpl()->m_toRefTransform.get();
     }
     else if (dir == VIEWTRANSFORM_DIR_FROM_REFERENCE)
     {
-        return getImpl()->m_fromRefTransform;
+        return getImpl()->m_fromRefTransform.get();
     }
 
     throw Exception("View transform: Unspecified ViewTransformDirection.");
@@ -172,11 +169,11 @@ void ViewTransform::setTransform(const ConstTransformRcPtr & transform, ViewTran
 
     if (dir == VIEWTRANSFORM_DIR_TO_REFERENCE)
     {
-        getImpl()->m_toRefTransform = transformCopy;
+        getImpl()->m_toRefTransform.set(transformCopy);
     }
     else if (dir == VIEWTRANSFORM_DIR_FROM_REFERENCE)
     {
-        getImpl()->m_fromRefTransform = transformCopy;
+        getImpl()->m_fromRefTransform.set(transformCopy);
     }
     else
     {
@@ -184,6 +181,13 @@ void ViewTransform::setTransform(const ConstTransformRcPtr & transform, ViewTran
     }
 }
 
+void SetTransformLoader(ViewTransform & vt,
+                        ViewTransformDirection dir,
+                        const TransformLoader & loader)
+{
+    vt.setTransform(std::make_shared<LoaderTransform>(loader), dir);
+}
+
 
 namespace
 {
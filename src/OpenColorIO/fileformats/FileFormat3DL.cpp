@@ -84,6 +84,11 @@ public:
 
     Lut1DOpDataRcPtr lut1D;
     Lut3DOpDataRcPtr lut3D;
+
+    size_t getMemorySize() const override
+    {
+        return CachedFile::getMemorySize() + GetLutMemorySize(lut1D) + GetLutMemorySize(lut3D);
+    }
 };
 
 typedef OCIO_SHARED_PTR<LocalCachedFile> LocalCachedFileRcPtr;
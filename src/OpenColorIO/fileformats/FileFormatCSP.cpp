@@ -302,6 +302,14 @@ public:
     Lut1DOpDataRcPtr prelut;
     Lut1DOpDataRcPtr lut1D;
     Lut3DOpDataRcPtr lut3D;
+
+    size_t getMemorySize() const override
+    {
+        return CachedFile::getMemorySize()
+               + GetLutMemorySize(prelut)
+               + GetLutMemorySize(lut1D)
+               + GetLutMemorySize(lut3D);
+    }
 };
 typedef OCIO_SHARED_PTR<CachedFileCSP> CachedFileCSPRcPtr;
 
@@ -106,6 +106,18 @@ public:
     CTFReaderTransformPtr m_transform;
     std::string m_filePath;
 
+    size_t getMemorySize() const override
+    {
+        size_t memory = CachedFile::getMemorySize();
+        if (m_transform)
+        {
+            for (const auto & op : m_transform->getOps())
+            {
+                memory += GetLutMemorySize(op);
+            }
+        }
+        return memory;
+    }
 };
 
 typedef OCIO_SHARED_PTR<LocalCachedFile> LocalCachedFileRcPtr;
@@ -647,6 +647,11 @@ public:
     ~LocalCachedFile() = default;
 
     Lut1DOpDataRcPtr lut1D;
+
+    size_t getMemorySize() const override
+    {
+        return CachedFile::getMemorySize() + GetLutMemorySize(lut1D);
+    }
 };
 
 typedef OCIO_SHARED_PTR<LocalCachedFile> LocalCachedFileRcPtr;
@@ -40,6 +40,11 @@ public:
     float mGammaRGB[4]{ 1.0f };
 
     Lut1DOpDataRcPtr lut;
+
+    size_t getMemorySize() const override
+    {
+        return CachedFile::getMemorySize() + GetLutMemorySize(lut);
+    }
 };
 
 typedef OCIO_SHARED_PTR<LocalCachedFile> LocalCachedFileRcPtr;
@@ -78,6 +78,11 @@ public:
     Lut3DOpDataRcPtr lut3D;
     float domain_min[3]{ 0.0f, 0.0f, 0.0f };
     float domain_max[3]{ 1.0f, 1.0f, 1.0f };
+
+    size_t getMemorySize() const override
+    {
+        return CachedFile::getMemorySize() + GetLutMemorySize(lut1D) + GetLutMemorySize(lut3D);
+    }
 };
 
 typedef OCIO_SHARED_PTR<LocalCachedFile> LocalCachedFileRcPtr;
@@ -52,6 +52,11 @@ public:
     ~LocalCachedFile() = default;
 
     Lut3DOpDataRcPtr lut3D;
+
+    size_t getMemorySize() const override
+    {
+        return CachedFile::getMemorySize() + GetLutMemorySize(lut3D);
+    }
 };
 
 typedef OCIO_SHARED_PTR<LocalCachedFile> LocalCachedFileRcPtr;
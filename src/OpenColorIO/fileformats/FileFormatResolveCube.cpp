@@ -187,6 +187,11 @@ public:
     Lut3DOpDataRcPtr lut3D;
     float range3d_min = 0.0f;
     float range3d_max = 1.0f;
+
+    size_t getMemorySize() const override
+    {
+        return CachedFile::getMemorySize() + GetLutMemorySize(lut1D) + GetLutMemorySize(lut3D);
+    }
 };
 
 typedef OCIO_SHARED_PTR<LocalCachedFile> LocalCachedFileRcPtr;
@@ -42,6 +42,11 @@ public:
     Lut1DOpDataRcPtr lut;
     float from_min = 0.0f;
     float from_max = 1.0f;
+
+    size_t getMemorySize() const override
+    {
+        return CachedFile::getMemorySize() + GetLutMemorySize(lut);
+    }
 };
 
 typedef OCIO_SHARED_PTR<LocalCachedFile> LocalCachedFileRcPtr;
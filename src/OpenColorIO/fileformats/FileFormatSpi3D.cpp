@@ -38,6 +38,11 @@ public:
     ~LocalCachedFile() = default;
 
     Lut3DOpDataRcPtr lut;
+
+    size_t getMemorySize() const override
+    {
+        return CachedFile::getMemorySize() + GetLutMemorySize(lut);
+    }
 };
 
 typedef OCIO_SHARED_PTR<LocalCachedFile> LocalCachedFileRcPtr;
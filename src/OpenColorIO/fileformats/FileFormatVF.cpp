@@ -28,6 +28,11 @@ public:
     Lut3DOpDataRcPtr lut3D;
     double m44[16]{ 0 };
     bool useMatrix = false;
+
+    size_t getMemorySize() const override
+    {
+        return CachedFile::getMemorySize() + GetLutMemorySize(lut3D);
+    }
 };
 
 typedef OCIO_SHARED_PTR<LocalCachedFile> LocalCachedFileRcPtr;
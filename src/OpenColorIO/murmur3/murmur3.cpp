@@ -0,0 +1,157 @@
+/*
+  MurmurHash3 was written by Austin Appleby, and is placed in the public
+  domain. The author hereby disclaims copyright to this source code.
+
+  https://github.com/aappleby/smhasher
+ */
+
+//  This file was altered for OCIO compilation purposes
+
+#include <cstring>
+
+#include "murmur3.h"
+
+namespace OCIO_NAMESPACE
+{
+
+namespace
+{
+
+const murmur3_word_t c1 = 0x87c37b91114253d5ULL;
+const murmur3_word_t c2 = 0x4cf5ad432745937fULL;
+
+inline murmur3_word_t rotl64(murmur3_word_t x, int r)
+{
+    return (x << r) | (x >> (64 - r));
+}
+
+/* Block read - if your platform needs to do endian-swapping, do the
+   conversion here. */
+inline murmur3_word_t getblock64(const murmur3_byte_t *p, int i)
+{
+    murmur3_word_t k;
+    std::memcpy(&k, p + i * 8, sizeof(k));
+    return k;
+}
+
+/* Finalization mix - force all bits of a hash block to avalanche. */
+inline murmur3_word_t fmix64(murmur3_word_t k)
+{
+    k ^= k >> 33;
+    k *= 0xff51afd7ed558ccdULL;
+    k ^= k >> 33;
+    k *= 0xc4ceb9fe1a85ec53ULL;
+    k ^= k >> 33;
+
+    return k;
+}
+
+inline void murmur3_process(murmur3_word_t h[2], const murmur3_byte_t *block)
+{
+    murmur3_word_t k1 = getblock64(block, 0);
+    murmur3_word_t k2 = getblock64(block, 1);
+
+    k1 *= c1; k1 = rotl64(k1, 31); k1 *= c2; h[0] ^= k1;
+
+    h[0] = rotl64(h[0], 27); h[0] += h[1]; h[0] = h[0] * 5 + 0x52dce729;
+
+    k2 *= c2; k2 = rotl64(k2, 33); k2 *= c1; h[1] ^= k2;
+
+    h[1] = rotl64(h[1], 31); h[1] += h[0]; h[1] = h[1] * 5 + 0x38495ab5;
+}
+
+} // anon.
+
+void murmur3_init(murmur3_state_t *pms, uint32_t seed)
+{
+    pms->h[0] = seed;
+    pms->h[1] = seed;
+    pms->length = 0;
+}
+
+void murmur3_append(murmur3_state_t *pms, const murmur3_byte_t *data, size_t nbytes)
+{
+    const murmur3_byte_t *p = data;
+    size_t left = nbytes;
+    const size_t offset = (size_t)(pms->length & 15);
+
+    if (nbytes == 0)
+        return;
+
+    pms->length += nbytes;
+
+    /* Process an initial partial block. */
+    if (offset)
+    {
+        const size_t copy = (offset + nbytes > 16 ? 16 - offset : nbytes);
+
+        std::memcpy(pms->buf + offset, p, copy);
+        if (offset + copy < 16)
+            return;
+        p += copy;
+        left -= copy;
+        murmur3_process(pms->h, pms->buf);
+    }
+
+    /* Process full blocks. */
+    for (; left >= 16; p += 16, left -= 16)
+        murmur3_process(pms->h, p);
+
+    /* Process a final partial block. */
+    if (left)
+        std::memcpy(pms->buf, p, left);
+}
+
+void murmur3_finish(const murmur3_state_t *pms, murmur3_byte_t digest[16])
+{
+    const murmur3_byte_t *tail = pms->buf;
+
+    murmur3_word_t h1 = pms->h[0];
+    murmur3_word_t h2 = pms->h[1];
+
+    murmur3_word_t k1 = 0;
+    murmur3_word_t k2 = 0;
+
+    switch (pms->length & 15)
+    {
+    case 15: k2 ^= ((murmur3_word_t)tail[14]) << 48; // fall through
+    case 14: k2 ^= ((murmur3_word_t)tail[13]) << 40; // fall through
+    case 13: k2 ^= ((murmur3_word_t)tail[12]) << 32; // fall through
+    case 12: k2 ^= ((murmur3_word_t)tail[11]) << 24; // fall through
+    case 11: k2 ^= ((murmur3_word_t)tail[10]) << 16; // fall through
+    case 10: k2 ^= ((murmur3_word_t)tail[ 9]) << 8;  // fall through
+    case  9: k2 ^= ((murmur3_word_t)tail[ 8]) << 0;
+             k2 *= c2; k2 = rotl64(k2, 33); k2 *= c1; h2 ^= k2;
+             // fall through
+
+    case  8: k1 ^= ((murmur3_word_t)tail[ 7]) << 56; // fall through
+    case  7: k1 ^= ((murmur3_word_t)tail[ 6]) << 48; // fall through
+    case  6: k1 ^= ((murmur3_word_t)tail[ 5]) << 40; // fall through
+    case  5: k1 ^= ((murmur3_word_t)tail[ 4]) << 32; // fall through
+    case  4: k1 ^= ((murmur3_word_t)tail[ 3]) << 24; // fall through
+    case  3: k1 ^= ((murmur3_word_t)tail[ 2]) << 16; // fall through
+    case  2: k1 ^= ((murmur3_word_t)tail[ 1]) << 8;  // fall through
+    case  1: k1 ^= ((murmur3_word_t)tail[ 0]) << 0;
+             k1 *= c1; k1 = rotl64(k1, 31); k1 *= c2; h1 ^= k1;
+    };
+
+    h1 ^= pms->length;
+    h2 ^= pms->length;
+
+    h1 += h2;
+    h2 += h1;
+
+    h1 = fmix64(h1);
+    h2 = fmix64(h2);
+
+    h1 += h2;
+    h2 += h1;
+
+    for (int i = 0; i < 8; ++i)
+    {
+        digest[i]     = (murmur3_byte_t)(h1 >> (8 * i));
+        digest[i + 8] = (murmur3_byte_t)(h2 >> (8 * i));
+    }
+}
+
+} // namespace OCIO_NAMESPACE
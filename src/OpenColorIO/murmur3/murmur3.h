@@ -0,0 +1,49 @@
+/*
+  MurmurHash3 was written by Austin Appleby, and is placed in the public
+  domain. The author hereby disclaims copyright to this source code.
+
+  https://github.com/aappleby/smhasher
+ */
+
+//  This file was altered for OCIO compilation purposes: only the x64 128-bit
+//  variant is kept and it is turned into an incremental (streaming) interface
+//  similar to the md5 one.
+
+#ifndef INCLUDED_OCIO_MURMUR3_H
+#define INCLUDED_OCIO_MURMUR3_H
+
+
+#include <cstddef>
+#include <cstdint>
+
+#include <OpenColorIO/OpenColorIO.h>
+
+namespace OCIO_NAMESPACE
+{
+
+// Note: the murmur3 functions should not be wrapped in extern "C', otherwise
+// the symbols will not be appropriately wrapped in the OCIO namespace
+
+typedef unsigned char murmur3_byte_t; /* 8-bit byte */
+typedef uint64_t murmur3_word_t; /* 64-bit word */
+
+/* Define the state of the MurmurHash3 x64 128-bit algorithm. */
+typedef struct murmur3_state_s {
+    murmur3_word_t h[2];        /* digest buffer */
+    murmur3_word_t length;      /* message length in bytes */
+    murmur3_byte_t buf[16];     /* accumulate block */
+} murmur3_state_t;
+
+/* Initialize the algorithm. */
+void murmur3_init(murmur3_state_t *pms, uint32_t seed);
+
+/* Append a string to the message. */
+void murmur3_append(murmur3_state_t *pms, const murmur3_byte_t *data, size_t nbytes);
+
+/* Finish the message and return the digest (i.e. h1 then h2, little-endian). */
+void murmur3_finish(const murmur3_state_t *pms, murmur3_byte_t digest[16]);
+
+
+} // namespace OCIO_NAMESPACE
+
+#endif /* INCLUDED_OCIO_MURMUR3_H */
@@ -0,0 +1,106 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+#include <algorithm>
+#include <map>
+
+#include <OpenColorIO/OpenColorIO.h>
+
+#include "Mutex.h"
+#include "ops/OpArray.h"
+
+
+namespace OCIO_NAMESPACE
+{
+namespace
+{
+
+// Content hash to the values.  A multimap is used because different values could have the
+// same hash.
+typedef std::multimap<std::string, std::weak_ptr<Array::Values>> InternedArrays;
+
+Mutex g_internedArraysMutex;
+InternedArrays g_internedArrays;
+
+// The expired entries are removed when the table doubles in size.
+constexpr size_t MIN_SWEEP_SIZE = 64;
+size_t g_internedArraysSweepSize = MIN_SWEEP_SIZE;
+
+// You must manually acquire the table mutex before calling this.
+void RemoveExpiredArrays()
+{
+    for (auto iter = g_internedArrays.begin(); iter != g_internedArrays.end(); )
+    {
+        if (iter->second.expired())
+        {
+            iter = g_internedArrays.erase(iter);
+        }
+        else
+        {
+            ++iter;
+        }
+    }
+
+    g_internedArraysSweepSize = std::max(MIN_SWEEP_SIZE, 2 * g_internedArrays.size());
+}
+
+} // anon.
+
+void InternArray(ArrayT<float> & array)
+{
+    const std::string & hash = array.getContentHash();
+    if (hash.empty())
+    {
+        return;
+    }
+
+    AutoMutex lock(g_internedArraysMutex);
+
+    auto range = g_internedArrays.equal_range(hash);
+    for (auto iter = range.first; iter != range.second; ++iter)
+    {
+        auto values = iter->second.lock();
+        if (values == array.m_data)
+        {
+            // Already interned.
+            return;
+        }
+
+        // Identical hashes do not guarantee identical values.
+        if (values && *values == *array.m_data)
+        {
+            array.m_data = values;
+            return;
+        }
+    }
+
+    g_internedArrays.emplace(hash, array.m_data);
+
+    if (g_internedArrays.size() >= g_internedArraysSweepSize)
+    {
+        RemoveExpiredArrays();
+    }
+}
+
+void GetSharedLutStats(size_t & numLuts, size_t & numUsers, size_t & memory)
+{
+    numLuts  = 0;
+    numUsers = 0;
+    memory   = 0;
+
+    AutoMutex lock(g_internedArraysMutex);
+
+    for (const auto & interned : g_internedArrays)
+    {
+        auto values = interned.second.lock();
+        if (values)
+        {
+            ++numLuts;
+            // Do not count the local reference.
+            numUsers += values.use_count() - 1;
+            memory += values->size() * sizeof(float);
+        }
+    }
+}
+
+} // namespace OCIO_NAMESPACE
@@ -4,14 +4,25 @@
 #ifndef INCLUDED_OCIO_OPARRAY_H
 #define INCLUDED_OCIO_OPARRAY_H
 
+#include <memory>
 #include <sstream>
 #include <vector>
 
 #include <OpenColorIO/OpenColorIO.h>
 
+#include "HashUtils.h"
+
 namespace OCIO_NAMESPACE
 {
 
+template<typename T> class ArrayT;
+
+// Identical LUT values (e.g. from several copies of the same LUT file, or identical composed
+// LUTs in several processors) are stored once for the whole process.  The array must be
+// finalized (i.e. have a content hash); it then uses the values of any identical array that is
+// still alive.  Note that the table does not keep the values alive.
+void InternArray(ArrayT<float> & array);
+
 class ArrayBase
 {
 public:
@@ -32,6 +43,10 @@ public:
 // other classes. Since the dimensionality of the underlying array of those 
 // classes varies, the interpretation of "length" is defined by child classes.
 // The class represents the array for a 3by1D LUT and a 3D LUT or a matrix.
+//
+// The values of a finalized array (i.e. having a content hash) are shared by the copies of
+// the array (e.g. when an op is cloned by the processor creation or by the optimizer) until
+// one of them is modified (i.e. copy-on-write).
 template<typename T> class ArrayT : public ArrayBase
 {
 public:
@@ -41,6 +56,7 @@ public:
     ArrayT()
         : m_length(0)
         , m_numColorComponents(0)
+        , m_data(std::make_shared<Values>())
     {
     }
 
@@ -48,14 +64,32 @@ public:
     {
     }
 
-    ArrayT(const ArrayT&) = default;
-    ArrayT& operator= (const ArrayT&) = default;
+    ArrayT(const ArrayT & a)
+        : ArrayBase(a)
+        , m_length(a.m_length)
+        , m_numColorComponents(a.m_numColorComponents)
+        , m_data(a.isShareable() ? a.m_data : std::make_shared<Values>(*a.m_data))
+        , m_contentHash(a.m_contentHash)
+    {
+    }
+
+    ArrayT& operator= (const ArrayT & a)
+    {
+        if (this != &a)
+        {
+            m_length = a.m_length;
+            m_numColorComponents = a.m_numColorComponents;
+            m_data = a.isShareable() ? a.m_data : std::make_shared<Values>(*a.m_data);
+            m_contentHash = a.m_contentHash;
+        }
+        return *this;
+    }
 
     virtual void resize(unsigned long length, unsigned long numColorComponents)
     {
         m_length = length;
         m_numColorComponents = numColorComponents;
-        m_data.resize(getNumValues());
+        data().resize(getNumValues());
     }
 
     void setLength(unsigned long length)
@@ -63,13 +97,13 @@ public:
         if (m_length != length)
         {
             m_length = length;
-            m_data.resize(getNumValues());
+            data().resize(getNumValues());
         }
     }
 
     void setDoubleValue(unsigned long index, double value) override
     {
-        m_data[index] = (T)value;
+        data()[index] = (T)value;
     }
 
     unsigned long getLength() const override
@@ -82,7 +116,7 @@ public:
         if (m_numColorComponents != getMaxColorComponents())
         {
             m_numColorComponents = getMaxColorComponents();
-            m_data.resize(getNumValues());
+            data().resize(getNumValues());
         }
     }
 
@@ -96,7 +130,7 @@ public:
         if (m_numColorComponents != numColorComponents)
         {
             m_numColorComponents = numColorComponents;
-            m_data.resize(getNumValues());
+            data().resize(getNumValues());
         }
     }
 
@@ -104,11 +138,13 @@ public:
     {
         if (m_numColorComponents == 3)
         {
+            const Values & values = *m_data;
+
             bool sameCoeff = true;
             for (unsigned long idx = 0; idx < m_length && sameCoeff; ++idx)
             {
-                if (m_data[idx * 3] != m_data[idx * 3 + 1]
-                    || m_data[idx * 3] != m_data[idx * 3 + 2])
+                if (values[idx * 3] != values[idx * 3 + 1]
+                    || values[idx * 3] != values[idx * 3 + 2])
                 {
                     sameCoeff = false;
                     break;
@@ -129,22 +165,52 @@ public:
 
     inline const Values& getValues() const
     {
-        return m_data;
+        return *m_data;
     }
 
     inline Values& getValues()
     {
-        return m_data;
+        return data();
     }
 
     inline const T& operator[](unsigned long index) const
     {
-        return m_data[index];
+        return (*m_data)[index];
     }
 
     inline T& operator[](unsigned long index)
     {
-        return m_data[index];
+        return data()[index];
+    }
+
+    // The content hash is computed on request (i.e. when the op is finalized) and it is reset
+    // by any non-const access to the values.  It is always computed again as the values could
+    // have been modified through a reference obtained before the previous computation.  Note
+    // that the values must not be modified through such a reference once hashed as the values
+    // could then be shared.
+    void updateContentHash()
+    {
+        CacheIDHasher hasher;
+        hasher.append(*m_data);
+        m_contentHash = hasher.getPrintableHash();
+    }
+
+    // True if the copies of the array share the values.
+    bool isShareable() const
+    {
+        return !m_contentHash.empty();
+    }
+
+    // True if the two arrays share the same values.
+    bool sharesValuesWith(const ArrayT & a) const
+    {
+        return m_data == a.m_data;
+    }
+
+    // Empty if not computed.
+    const std::string & getContentHash() const
+    {
+        return m_contentHash;
     }
 
     virtual void validate() const
@@ -156,10 +222,10 @@ public:
 
         // getNumValues is based on the dimensions claimed in the file.  Check
         // that this matches the number of values that were actually set.
-        if (m_data.size() != getNumValues())
+        if (m_data->size() != getNumValues())
         {
             std::ostringstream os;
-            os << "Array contains: " << m_data.size() << " values, ";
+            os << "Array contains: " << m_data->size() << " values, ";
             os << "but " << getNumValues() << " are expected.";
             throw Exception(os.str().c_str());
         }
@@ -168,27 +234,64 @@ public:
     bool operator==(const ArrayT & a) const
     {
         if (this == &a) return true;
-        return (m_length == a.m_length)
-            && (m_numColorComponents == a.m_numColorComponents)
-            && (m_data == a.m_data);
+
+        if (m_length != a.m_length || m_numColorComponents != a.m_numColorComponents)
+        {
+            return false;
+        }
+
+        // Different hashes avoid comparing all the values of large arrays, but equal hashes
+        // still need the complete comparison.
+        if (m_data == a.m_data)
+        {
+            return true;
+        }
+
+        if (!m_contentHash.empty() && !a.m_contentHash.empty()
+            && m_contentHash != a.m_contentHash)
+        {
+            return false;
+        }
+
+        return *m_data == *a.m_data;
     }
 
     void scale(T scale)
     {
         if (scale != (T)1.)
         {
-            const size_t nbVal = m_data.size();
+            Values & values = data();
+            const size_t nbVal = values.size();
             for (size_t i = 0; i < nbVal; ++i)
             {
-                m_data[i] *= scale;
+                values[i] *= scale;
             }
         }
     }
 
+private:
+    friend void InternArray(ArrayT<float> & array);
+
+    // Return the values to be modified.
+    Values & data()
+    {
+        // Once hashed, the values could be shared with other arrays or interned (i.e. another
+        // thread could start sharing them at any time) so make a copy before any change.
+        if (!m_contentHash.empty() || m_data.use_count() > 1)
+        {
+            m_data = std::make_shared<Values>(*m_data);
+        }
+        m_contentHash.clear();
+        return *m_data;
+    }
+
 protected:
     unsigned long m_length;
     unsigned long m_numColorComponents;
-    Values        m_data;
+
+private:
+    std::shared_ptr<Values> m_data;
+    std::string             m_contentHash;
 };
 
 typedef ArrayT<double> ArrayDouble;
@@ -44,4 +44,34 @@ void EvalTransform(const float * in,
         result += 3;
     }
 }
+
+MathAccuracy GetMathAccuracy(OptimizationFlags oFlags)
+{
+    if ((oFlags & OPTIMIZATION_FAST_MATH_PREVIEW) == OPTIMIZATION_FAST_MATH_PREVIEW)
+    {
+        return MATH_ACCURACY_PREVIEW;
+    }
+    else if ((oFlags & OPTIMIZATION_EXACT_MATH) == OPTIMIZATION_EXACT_MATH)
+    {
+        return MATH_ACCURACY_EXACT;
+    }
+
+    return MATH_ACCURACY_HIGH;
+}
+
+const char * MathAccuracyToString(MathAccuracy accuracy)
+{
+    switch (accuracy)
+    {
+        case MATH_ACCURACY_EXACT:
+            return "exact";
+        case MATH_ACCURACY_HIGH:
+            return "high";
+        case MATH_ACCURACY_PREVIEW:
+            return "preview";
+    }
+
+    throw Exception("Unknown math accuracy.");
+}
+
 } // namespace OCIO_NAMESPACE
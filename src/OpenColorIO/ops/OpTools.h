@@ -18,6 +18,11 @@ void EvalTransform(const float * in, float * out,
                    long numPixels,
                    OpRcPtrVec & ops);
 
+// Accuracy of the log2, exp2 and pow evaluations requested by the optimization flags.
+MathAccuracy GetMathAccuracy(OptimizationFlags oFlags);
+
+const char * MathAccuracyToString(MathAccuracy accuracy);
+
 // Allow us to temporarily manipulate the inversion quality without
 // cloning the object.
 template <class LutType>
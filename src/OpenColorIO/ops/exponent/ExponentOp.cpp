@@ -12,6 +12,8 @@
 #include "ops/exponent/ExponentOp.h"
 #include "GpuShaderUtils.h"
 #include "MathUtils.h"
+#include "ops/OpTools.h"
+#include "SSE.h"
 
 namespace OCIO_NAMESPACE
 {
@@ -50,11 +52,22 @@ ExponentOpData & ExponentOpData::operator = (const ExponentOpData & rhs)
     {
         OpData::operator=(rhs);
         memcpy(m_exp4, rhs.m_exp4, sizeof(double)*4);
+        m_mathAccuracy = rhs.m_mathAccuracy;
     }
 
     return *this;
 }
 
+bool ExponentOpData::operator==(const OpData & other) const
+{
+    if (!OpData::operator==(other)) return false;
+
+    const ExponentOpData * exp = static_cast<const ExponentOpData *>(&other);
+
+    return std::equal(m_exp4, m_exp4 + 4, exp->m_exp4)
+           && m_mathAccuracy == exp->m_mathAccuracy;
+}
+
 bool ExponentOpData::isNoOp() const
 {
     return isIdentity();
@@ -81,12 +94,14 @@ void ExponentOpData::finalize()
     {
         cacheIDStream << m_exp4[i] << " ";
     }
+    cacheIDStream << MathAccuracyToString(m_mathAccuracy);
 
     m_cacheID = cacheIDStream.str();
 }
 
 namespace
 {
+template<MathAccuracy accuracy>
 class ExponentOpCPU : public OpCPU
 {
 public:
@@ -99,7 +114,8 @@ private:
     ConstExponentOpDataRcPtr m_data;
 };
 
-void ExponentOpCPU::apply(const void * inImg, void * outImg, long numPixels) const
+template<MathAccuracy accuracy>
+void ExponentOpCPU<accuracy>::apply(const void * inImg, void * outImg, long numPixels) const
 {
     const float * in = (const float *)inImg;
     float * out = (float *)outImg;
@@ -109,6 +125,30 @@ void ExponentOpCPU::apply(const void * inImg, void * outImg, long numPixels) con
                             float(m_data->m_exp4[2]),
                             float(m_data->m_exp4[3]) };
 
+#ifdef USE_SSE
+    if (accuracy != MATH_ACCURACY_EXACT)
+    {
+        const __m128 mm_exp = _mm_set_ps(exp[3], exp[2], exp[1], exp[0]);
+        // Value of powf(0, exp) for the negative (and NaN) inputs.
+        const __m128 mm_zero = _mm_set_ps(powf(0.0f, exp[3]), powf(0.0f, exp[2]),
+                                          powf(0.0f, exp[1]), powf(0.0f, exp[0]));
+
+        for (long pixelIndex = 0; pixelIndex < numPixels; ++pixelIndex)
+        {
+            const __m128 pixel = _mm_loadu_ps(in);
+
+            const __m128 data = SSEMath<accuracy>::Power(pixel, mm_exp);
+
+            _mm_storeu_ps(out, sseSelect(_mm_cmpgt_ps(pixel, EZERO), data, mm_zero));
+
+            in  += 4;
+            out += 4;
+        }
+
+        return;
+    }
+#endif
+
     for (long pixelIndex = 0; pixelIndex < numPixels; ++pixelIndex)
     {
         out[0] = powf( std::max(0.0f, in[0]), exp[0]);
@@ -200,7 +240,9 @@ bool ExponentOp::isInverse(ConstOpRcPtr & /*op*/) const
 
 bool ExponentOp::canCombineWith(ConstOpRcPtr & op) const
 {
-    return isSameType(op);
+    ConstExponentOpRcPtr typedRcPtr = DynamicPtrCast<const ExponentOp>(op);
+    return typedRcPtr
+           && expData()->getMathAccuracy() == typedRcPtr->expData()->getMathAccuracy();
 }
 
 void ExponentOp::combineWith(OpRcPtrVec & ops, ConstOpRcPtr & secondOp) const
@@ -232,8 +274,10 @@ void ExponentOp::combineWith(OpRcPtrVec & ops, ConstOpRcPtr & secondOp) const
     }
 }
 
-void ExponentOp::finalize(OptimizationFlags /*oFlags*/)
+void ExponentOp::finalize(OptimizationFlags oFlags)
 {
+    expData()->setMathAccuracy(GetMathAccuracy(oFlags));
+
     expData()->finalize();
 
     // Create the cacheID
@@ -246,7 +290,18 @@ void ExponentOp::finalize(OptimizationFlags /*oFlags*/)
 
 ConstOpCPURcPtr ExponentOp::getCPUOp() const
 {
-    return std::make_shared<ExponentOpCPU>(expData());
+    ConstExponentOpDataRcPtr data = expData();
+
+#ifdef USE_SSE
+    // The exponent has always been evaluated with the standard library (even with SSE) so
+    // the HIGH accuracy preserves it and only the PREVIEW accuracy uses the approximation.
+    if (data->getMathAccuracy() == MATH_ACCURACY_PREVIEW)
+    {
+        return std::make_shared<ExponentOpCPU<MATH_ACCURACY_PREVIEW>>(data);
+    }
+#endif
+
+    return std::make_shared<ExponentOpCPU<MATH_ACCURACY_EXACT>>(data);
 }
 
 void ExponentOp::extractGpuShaderInfo(GpuShaderCreatorRcPtr & shaderCreator) const
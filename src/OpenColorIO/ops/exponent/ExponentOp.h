@@ -8,6 +8,7 @@
 #include <OpenColorIO/OpenColorIO.h>
 
 #include "Op.h"
+#include "PrivateTypes.h"
 
 namespace OCIO_NAMESPACE
 {
@@ -32,9 +33,18 @@ public:
 
     virtual bool hasChannelCrosstalk() const override { return false; }
 
+    bool operator==(const OpData & other) const override;
+
     double m_exp4[4];
 
     virtual void finalize() override;
+
+    // Accuracy of the log2/exp2/pow evaluations of the CPU renderer (set at finalization).
+    inline MathAccuracy getMathAccuracy() const { return m_mathAccuracy; }
+    inline void setMathAccuracy(MathAccuracy accuracy) { m_mathAccuracy = accuracy; }
+
+private:
+    MathAccuracy m_mathAccuracy = MATH_ACCURACY_HIGH;
 };
 
 // If the exponent is 1.0, this will return without clamping
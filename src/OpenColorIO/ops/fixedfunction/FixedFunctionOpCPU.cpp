@@ -9,6 +9,7 @@
 
 #include "BitDepthUtils.h"
 #include "ops/fixedfunction/FixedFunctionOpCPU.h"
+#include "SSE.h"
 
 
 namespace OCIO_NAMESPACE
@@ -226,6 +227,107 @@ __inline float CalcSatWeight(const float red, const float grn, const float blu,
     return sat;
 }
 
+#ifdef USE_SSE
+
+// The SSE versions of the renderers process 4 pixels at a time. The RGBA pixels are
+// transposed so that each register holds one channel of the 4 pixels, and the channel
+// mixing of the fixed functions then maps to packed operations. Branches are replaced by
+// selects, and the operations are done in the same order as the scalar code, so both
+// paths produce the same results. The remaining pixels are processed by the scalar code.
+
+inline void LoadTransposed(const float * in, __m128 & red, __m128 & grn, __m128 & blu, __m128 & alp)
+{
+    red = _mm_loadu_ps(in);
+    grn = _mm_loadu_ps(in + 4);
+    blu = _mm_loadu_ps(in + 8);
+    alp = _mm_loadu_ps(in + 12);
+    _MM_TRANSPOSE4_PS(red, grn, blu, alp);
+}
+
+inline void StoreTransposed(float * out, __m128 red, __m128 grn, __m128 blu, __m128 alp)
+{
+    _MM_TRANSPOSE4_PS(red, grn, blu, alp);
+    _mm_storeu_ps(out,      red);
+    _mm_storeu_ps(out + 4,  grn);
+    _mm_storeu_ps(out + 8,  blu);
+    _mm_storeu_ps(out + 12, alp);
+}
+
+// Equivalent of std::min(a, b) and std::max(a, b). Note that the std functions return
+// the first argument when the comparison involves a NaN, whereas the SSE instructions
+// return the second one, hence the swap.
+inline __m128 sseMin(const __m128 a, const __m128 b) { return _mm_min_ps(b, a); }
+inline __m128 sseMax(const __m128 a, const __m128 b) { return _mm_max_ps(b, a); }
+
+// Equivalent of Clamp() from MathUtils.h.
+inline __m128 sseClamp(const __m128 a, const __m128 minVal, const __m128 maxVal)
+{
+    return sseMin(sseMax(minVal, a), maxVal);
+}
+
+// Equivalent of std::floor() i.e. also valid for values outside of the int range.
+inline __m128 sseFloor(const __m128 x)
+{
+    static const __m128 INT_LIMIT = _mm_set1_ps(8388608.f); // 2^23
+
+    const __m128 trunc = _mm_cvtepi32_ps(_mm_cvttps_epi32(x));
+    const __m128 floor = _mm_sub_ps(trunc, _mm_and_ps(_mm_cmpgt_ps(trunc, x), EONE));
+
+    // Values larger than 2^23 (and NaNs) are already integers.
+    return sseSelect(_mm_cmplt_ps(_mm_and_ps(x, EABS_MASK), INT_LIMIT), floor, x);
+}
+
+// The SSE approximations of the transcendental functions (see SSE.h) are not accurate
+// enough for the fixed functions so the scalar versions are called for each lane.
+inline __m128 PerLaneAtan2(const __m128 y, const __m128 x)
+{
+    OCIO_ALIGN(float ybuf[4]);
+    OCIO_ALIGN(float xbuf[4]);
+    _mm_store_ps(ybuf, y);
+    _mm_store_ps(xbuf, x);
+    return _mm_setr_ps(atan2f(ybuf[0], xbuf[0]), atan2f(ybuf[1], xbuf[1]),
+                       atan2f(ybuf[2], xbuf[2]), atan2f(ybuf[3], xbuf[3]));
+}
+
+inline __m128 PerLanePow(const __m128 x, const float exp)
+{
+    OCIO_ALIGN(float buf[4]);
+    _mm_store_ps(buf, x);
+    return _mm_setr_ps(powf(buf[0], exp), powf(buf[1], exp),
+                       powf(buf[2], exp), powf(buf[3], exp));
+}
+
+// Solve the red modifier quadratic with the same expression as the scalar path.
+inline __m128 PerLaneRedModRoot(const __m128 a, const __m128 b, const __m128 c)
+{
+    OCIO_ALIGN(float abuf[4]);
+    OCIO_ALIGN(float bbuf[4]);
+    OCIO_ALIGN(float cbuf[4]);
+    OCIO_ALIGN(float res[4]);
+    _mm_store_ps(abuf, a);
+    _mm_store_ps(bbuf, b);
+    _mm_store_ps(cbuf, c);
+    for (int i = 0; i < 4; ++i)
+    {
+        res[i] = ( -bbuf[i] - sqrt( bbuf[i] * bbuf[i] - 4.f * abuf[i] * cbuf[i])) / ( 2.f * abuf[i]);
+    }
+    return _mm_load_ps(res);
+}
+
+__inline __m128 CalcSatWeight(const __m128 red, const __m128 grn, const __m128 blu,
+                              const __m128 noiseLimit)
+{
+    static const __m128 LIMIT = _mm_set1_ps(1e-10f);
+
+    const __m128 minVal = sseMin( red, sseMin( grn, blu ) );
+    const __m128 maxVal = sseMax( red, sseMax( grn, blu ) );
+
+    return _mm_div_ps( _mm_sub_ps( sseMax( LIMIT, maxVal ), sseMax( LIMIT, minVal ) ),
+                       sseMax( noiseLimit, maxVal ) );
+}
+
+#endif
+
 Renderer_ACES_RedMod03_Fwd::Renderer_ACES_RedMod03_Fwd(ConstFixedFunctionOpDataRcPtr & /*data*/)
     :   OpCPU()
 {
@@ -287,12 +389,106 @@ __inline float CalcHueWeight(const float red, const float grn, const float blu,
     return f_H;
 }
 
+#ifdef USE_SSE
+__inline __m128 CalcHueWeight(const __m128 red, const __m128 grn, const __m128 blu,
+                              const __m128 inv_width)
+{
+    static const __m128 TWO   = _mm_set1_ps(2.f);
+    static const __m128 SQRT3 = _mm_set1_ps(1.7320508075688772f);
+
+    // Convert RGB to Yab (luma/chroma).
+    const __m128 a = _mm_sub_ps( _mm_mul_ps(TWO, red), _mm_add_ps(grn, blu) );
+    const __m128 b = _mm_mul_ps( SQRT3, _mm_sub_ps(grn, blu) );
+
+    const __m128 hue = PerLaneAtan2(b, a);
+
+    // Determine normalized input coords to B-spline.
+    const __m128 knot_coord = _mm_add_ps( _mm_mul_ps(hue, inv_width), TWO );
+    const __m128i j = _mm_cvttps_epi32(knot_coord);
+
+    const __m128 t = _mm_sub_ps(knot_coord, _mm_cvtepi32_ps(j));
+
+    // Select the coefficients of the quadratic B-spline basis function (see the _M matrix
+    // of the scalar version) for the knot index of each lane.
+    const __m128 j0 = _mm_castsi128_ps( _mm_cmpeq_epi32(j, _mm_set1_epi32(0)) );
+    const __m128 j1 = _mm_castsi128_ps( _mm_cmpeq_epi32(j, _mm_set1_epi32(1)) );
+    const __m128 j2 = _mm_castsi128_ps( _mm_cmpeq_epi32(j, _mm_set1_epi32(2)) );
+
+    const __m128 c0 = sseSelect(j0, _mm_set1_ps( 0.25f),
+                      sseSelect(j1, _mm_set1_ps(-0.75f),
+                      sseSelect(j2, _mm_set1_ps( 0.75f), _mm_set1_ps(-0.25f))));
+    const __m128 c1 = sseSelect(j0, EZERO,
+                      sseSelect(j1, _mm_set1_ps( 0.75f),
+                      sseSelect(j2, _mm_set1_ps(-1.50f), _mm_set1_ps( 0.75f))));
+    const __m128 c2 = sseSelect(j0, EZERO,
+                      sseSelect(j1, _mm_set1_ps( 0.75f),
+                      sseSelect(j2, EZERO,               _mm_set1_ps(-0.75f))));
+    const __m128 c3 = sseSelect(j0, EZERO,
+                      sseSelect(j1, _mm_set1_ps( 0.25f),
+                      sseSelect(j2, EONE,                _mm_set1_ps( 0.25f))));
+
+    const __m128 f_H
+        = _mm_add_ps(c3, _mm_mul_ps(t, _mm_add_ps(c2, _mm_mul_ps(t, _mm_add_ps(c1, _mm_mul_ps(t, c0))))));
+
+    // The weight is zero outside of the hue window i.e. when j is not in [0, 3].
+    const __m128 inWindow
+        = _mm_castsi128_ps( _mm_and_si128( _mm_cmpgt_epi32(j, _mm_set1_epi32(-1)),
+                                           _mm_cmplt_epi32(j, _mm_set1_epi32(4)) ) );
+
+    return _mm_and_ps(f_H, inWindow);
+}
+#endif
+
 void Renderer_ACES_RedMod03_Fwd::apply(const void * inImg, void * outImg, long numPixels) const
 {
     const float * in = (const float *)inImg;
     float * out = (float *)outImg;
 
-    for(long idx=0; idx<numPixels; ++idx)
+    long idx = 0;
+
+#ifdef USE_SSE
+    const __m128 inv_width     = _mm_set1_ps(m_inv_width);
+    const __m128 noiseLimit    = _mm_set1_ps(m_noiseLimit);
+    const __m128 pivot         = _mm_set1_ps(m_pivot);
+    const __m128 oneMinusScale = _mm_set1_ps(m_1minusScale);
+    const __m128 minDenom      = _mm_set1_ps(1e-10f);
+
+    for(; idx + 4 <= numPixels; idx += 4)
+    {
+        __m128 red, grn, blu, alp;
+        LoadTransposed(in, red, grn, blu, alp);
+
+        const __m128 f_H = CalcHueWeight(red, grn, blu, inv_width);
+        const __m128 f_S = CalcSatWeight(red, grn, blu, noiseLimit);
+
+        // Hue is in range of the window, apply mod.
+        const __m128 applyMod = _mm_cmpgt_ps(f_H, EZERO);
+
+        const __m128 newRed
+            = _mm_add_ps(red, _mm_mul_ps(_mm_mul_ps(_mm_mul_ps(f_H, f_S), _mm_sub_ps(pivot, red)),
+                                         oneMinusScale));
+
+        // Restore hue.
+        const __m128 grnGeBlu = _mm_cmpge_ps(grn, blu);
+
+        const __m128 grnHueFac = _mm_div_ps(_mm_sub_ps(grn, blu), sseMax(minDenom, _mm_sub_ps(red, blu)));
+        const __m128 newGrn = _mm_add_ps(_mm_mul_ps(grnHueFac, _mm_sub_ps(newRed, blu)), blu);
+
+        const __m128 bluHueFac = _mm_div_ps(_mm_sub_ps(blu, grn), sseMax(minDenom, _mm_sub_ps(red, grn)));
+        const __m128 newBlu = _mm_add_ps(_mm_mul_ps(bluHueFac, _mm_sub_ps(newRed, grn)), grn);
+
+        grn = sseSelect(_mm_and_ps(applyMod, grnGeBlu), newGrn, grn);
+        blu = sseSelect(_mm_andnot_ps(grnGeBlu, applyMod), newBlu, blu);
+        red = sseSelect(applyMod, newRed, red);
+
+        StoreTransposed(out, red, grn, blu, alp);
+
+        in  += 16;
+        out += 16;
+    }
+#endif
+
+    for(; idx<numPixels; ++idx)
     {
         float red = in[0];
         float grn = in[1];
@@ -348,7 +544,52 @@ void Renderer_ACES_RedMod03_Inv::apply(const void * inImg, void * outImg, long n
     const float * in = (const float *)inImg;
     float * out = (float *)outImg;
 
-    for(long idx=0; idx<numPixels; ++idx)
+    long idx = 0;
+
+#ifdef USE_SSE
+    const __m128 inv_width     = _mm_set1_ps(m_inv_width);
+    const __m128 pivot         = _mm_set1_ps(m_pivot);
+    const __m128 oneMinusScale = _mm_set1_ps(m_1minusScale);
+    const __m128 minDenom      = _mm_set1_ps(1e-10f);
+
+    for(; idx + 4 <= numPixels; idx += 4)
+    {
+        __m128 red, grn, blu, alp;
+        LoadTransposed(in, red, grn, blu, alp);
+
+        const __m128 f_H = CalcHueWeight(red, grn, blu, inv_width);
+        const __m128 applyMod = _mm_cmpgt_ps(f_H, EZERO);
+
+        const __m128 minChan = _mm_min_ps(grn, blu);
+
+        const __m128 a = _mm_sub_ps(_mm_mul_ps(f_H, oneMinusScale), EONE);
+        const __m128 b = _mm_sub_ps(red, _mm_mul_ps(_mm_mul_ps(f_H, _mm_add_ps(pivot, minChan)),
+                                                    oneMinusScale));
+        const __m128 c = _mm_mul_ps(_mm_mul_ps(_mm_mul_ps(f_H, pivot), minChan), oneMinusScale);
+
+        const __m128 newRed = PerLaneRedModRoot(a, b, c);
+
+        // Restore hue.
+        const __m128 grnGeBlu = _mm_cmpge_ps(grn, blu);
+
+        const __m128 grnHueFac = _mm_div_ps(_mm_sub_ps(grn, blu), sseMax(minDenom, _mm_sub_ps(red, blu)));
+        const __m128 newGrn = _mm_add_ps(_mm_mul_ps(grnHueFac, _mm_sub_ps(newRed, blu)), blu);
+
+        const __m128 bluHueFac = _mm_div_ps(_mm_sub_ps(blu, grn), sseMax(minDenom, _mm_sub_ps(red, grn)));
+        const __m128 newBlu = _mm_add_ps(_mm_mul_ps(bluHueFac, _mm_sub_ps(newRed, grn)), grn);
+
+        grn = sseSelect(_mm_and_ps(applyMod, grnGeBlu), newGrn, grn);
+        blu = sseSelect(_mm_andnot_ps(grnGeBlu, applyMod), newBlu, blu);
+        red = sseSelect(applyMod, newRed, red);
+
+        StoreTransposed(out, red, grn, blu, alp);
+
+        in  += 16;
+        out += 16;
+    }
+#endif
+
+    for(; idx<numPixels; ++idx)
     {
         float red = in[0];
         float grn = in[1];
@@ -408,7 +649,37 @@ void Renderer_ACES_RedMod10_Fwd::apply(const void * inImg, void * outImg, long n
     const float * in = (const float *)inImg;
     float * out = (float *)outImg;
 
-    for(long idx=0; idx<numPixels; ++idx)
+    long idx = 0;
+
+#ifdef USE_SSE
+    const __m128 inv_width     = _mm_set1_ps(m_inv_width);
+    const __m128 noiseLimit    = _mm_set1_ps(m_noiseLimit);
+    const __m128 pivot         = _mm_set1_ps(m_pivot);
+    const __m128 oneMinusScale = _mm_set1_ps(m_1minusScale);
+
+    for(; idx + 4 <= numPixels; idx += 4)
+    {
+        __m128 red, grn, blu, alp;
+        LoadTransposed(in, red, grn, blu, alp);
+
+        const __m128 f_H = CalcHueWeight(red, grn, blu, inv_width);
+        const __m128 f_S = CalcSatWeight(red, grn, blu, noiseLimit);
+
+        // Hue is in range of the window, apply mod.
+        const __m128 newRed
+            = _mm_add_ps(red, _mm_mul_ps(_mm_mul_ps(_mm_mul_ps(f_H, f_S), _mm_sub_ps(pivot, red)),
+                                         oneMinusScale));
+
+        red = sseSelect(_mm_cmpgt_ps(f_H, EZERO), newRed, red);
+
+        StoreTransposed(out, red, grn, blu, alp);
+
+        in  += 16;
+        out += 16;
+    }
+#endif
+
+    for(; idx<numPixels; ++idx)
     {
         float red = in[0];
         const float grn = in[1];
@@ -450,7 +721,39 @@ void Renderer_ACES_RedMod10_Inv::apply(const void * inImg, void * outImg, long n
     const float * in = (const float *)inImg;
     float * out = (float *)outImg;
 
-    for(long idx=0; idx<numPixels; ++idx)
+    long idx = 0;
+
+#ifdef USE_SSE
+    const __m128 inv_width     = _mm_set1_ps(m_inv_width);
+    const __m128 pivot         = _mm_set1_ps(m_pivot);
+    const __m128 oneMinusScale = _mm_set1_ps(m_1minusScale);
+
+    for(; idx + 4 <= numPixels; idx += 4)
+    {
+        __m128 red, grn, blu, alp;
+        LoadTransposed(in, red, grn, blu, alp);
+
+        const __m128 f_H = CalcHueWeight(red, grn, blu, inv_width);
+
+        const __m128 minChan = _mm_min_ps(grn, blu);
+
+        const __m128 a = _mm_sub_ps(_mm_mul_ps(f_H, oneMinusScale), EONE);
+        const __m128 b = _mm_sub_ps(red, _mm_mul_ps(_mm_mul_ps(f_H, _mm_add_ps(pivot, minChan)),
+                                                    oneMinusScale));
+        const __m128 c = _mm_mul_ps(_mm_mul_ps(_mm_mul_ps(f_H, pivot), minChan), oneMinusScale);
+
+        const __m128 newRed = PerLaneRedModRoot(a, b, c);
+
+        red = sseSelect(_mm_cmpgt_ps(f_H, EZERO), newRed, red);
+
+        StoreTransposed(out, red, grn, blu, alp);
+
+        in  += 16;
+        out += 16;
+    }
+#endif
+
+    for(; idx<numPixels; ++idx)
     {
         float red = in[0];
         const float grn = in[1];
@@ -511,7 +814,69 @@ void Renderer_ACES_Glow03_Fwd::apply(const void * inImg, void * outImg, long num
     const float * in = (const float *)inImg;
     float * out = (float *)outImg;
 
-    for(long idx=0; idx<numPixels; ++idx)
+    long idx = 0;
+
+#ifdef USE_SSE
+    static const __m128 YC_RADIUS_WEIGHT = _mm_set1_ps(1.75f);
+    static const __m128 ONE_THIRD_DIV    = _mm_set1_ps(3.f);
+    static const __m128 HALF             = _mm_set1_ps(0.5f);
+    static const __m128 SAT_PIVOT        = _mm_set1_ps(0.4f);
+    static const __m128 SAT_SCALE        = _mm_set1_ps(5.f);
+
+    const __m128 noiseLimit = _mm_set1_ps(m_noiseLimit);
+    const __m128 glowGain   = _mm_set1_ps(m_glowGain);
+    const __m128 glowMid    = _mm_set1_ps(m_glowMid);
+    const __m128 highLimit  = _mm_set1_ps(m_glowMid * 2.f);
+    const __m128 lowLimit   = _mm_set1_ps(m_glowMid * 2.f / 3.f);
+
+    for(; idx + 4 <= numPixels; idx += 4)
+    {
+        __m128 red, grn, blu, alp;
+        LoadTransposed(in, red, grn, blu, alp);
+
+        // NB: YC is at inScale.
+        const __m128 chroma
+            = _mm_sqrt_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(blu, _mm_sub_ps(blu, grn)),
+                                                _mm_mul_ps(grn, _mm_sub_ps(grn, red))),
+                                     _mm_mul_ps(red, _mm_sub_ps(red, blu))));
+        const __m128 YC
+            = _mm_div_ps(_mm_add_ps(_mm_add_ps(_mm_add_ps(blu, grn), red),
+                                    _mm_mul_ps(YC_RADIUS_WEIGHT, chroma)),
+                         ONE_THIRD_DIV);
+
+        const __m128 sat = CalcSatWeight(red, grn, blu, noiseLimit);
+
+        // Sigmoid shaper, using a sign bit copy instead of std::copysignf().
+        const __m128 x = _mm_mul_ps(_mm_sub_ps(sat, SAT_PIVOT), SAT_SCALE);
+        const __m128 sign = _mm_or_ps(_mm_and_ps(x, ESIGN_MASK), EONE);
+        const __m128 t = sseMax(EZERO, _mm_sub_ps(EONE, _mm_mul_ps(_mm_mul_ps(HALF, sign), x)));
+        const __m128 s = _mm_mul_ps(_mm_add_ps(EONE, _mm_mul_ps(sign, _mm_sub_ps(EONE, _mm_mul_ps(t, t)))),
+                                    HALF);
+
+        const __m128 GlowGain = _mm_mul_ps(glowGain, s);
+
+        // Apply FwdGlow.
+        const __m128 midGain = _mm_mul_ps(GlowGain, _mm_sub_ps(_mm_div_ps(glowMid, YC), HALF));
+
+        const __m128 glowGainOut
+            = _mm_andnot_ps(_mm_cmpge_ps(YC, highLimit),
+                            sseSelect(_mm_cmple_ps(YC, lowLimit), GlowGain, midGain));
+
+        // Calculate glow factor.
+        const __m128 glowFactor = _mm_add_ps(EONE, glowGainOut);
+
+        red = _mm_mul_ps(red, glowFactor);
+        grn = _mm_mul_ps(grn, glowFactor);
+        blu = _mm_mul_ps(blu, glowFactor);
+
+        StoreTransposed(out, red, grn, blu, alp);
+
+        in  += 16;
+        out += 16;
+    }
+#endif
+
+    for(; idx<numPixels; ++idx)
     {
         const float red = in[0];
         const float grn = in[1];
@@ -567,7 +932,76 @@ void Renderer_ACES_Glow03_Inv::apply(const void * inImg, void * outImg, long num
     const float * in = (const float *)inImg;
     float * out = (float *)outImg;
 
-    for(long idx=0; idx<numPixels; ++idx)
+    long idx = 0;
+
+#ifdef USE_SSE
+    static const __m128 YC_RADIUS_WEIGHT = _mm_set1_ps(1.75f);
+    static const __m128 ONE_THIRD_DIV    = _mm_set1_ps(3.f);
+    static const __m128 HALF             = _mm_set1_ps(0.5f);
+    static const __m128 SAT_PIVOT        = _mm_set1_ps(0.4f);
+    static const __m128 SAT_SCALE        = _mm_set1_ps(5.f);
+
+    const __m128 noiseLimit = _mm_set1_ps(m_noiseLimit);
+    const __m128 glowGain   = _mm_set1_ps(m_glowGain);
+    const __m128 glowMid    = _mm_set1_ps(m_glowMid);
+    const __m128 highLimit  = _mm_set1_ps(m_glowMid * 2.f);
+    const __m128 two        = _mm_set1_ps(2.f);
+    const __m128 three      = _mm_set1_ps(3.f);
+
+    for(; idx + 4 <= numPixels; idx += 4)
+    {
+        __m128 red, grn, blu, alp;
+        LoadTransposed(in, red, grn, blu, alp);
+
+        // NB: YC is at inScale.
+        const __m128 chroma
+            = _mm_sqrt_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(blu, _mm_sub_ps(blu, grn)),
+                                                _mm_mul_ps(grn, _mm_sub_ps(grn, red))),
+                                     _mm_mul_ps(red, _mm_sub_ps(red, blu))));
+        const __m128 YC
+            = _mm_div_ps(_mm_add_ps(_mm_add_ps(_mm_add_ps(blu, grn), red),
+                                    _mm_mul_ps(YC_RADIUS_WEIGHT, chroma)),
+                         ONE_THIRD_DIV);
+
+        const __m128 sat = CalcSatWeight(red, grn, blu, noiseLimit);
+
+        // Sigmoid shaper, using a sign bit copy instead of std::copysignf().
+        const __m128 x = _mm_mul_ps(_mm_sub_ps(sat, SAT_PIVOT), SAT_SCALE);
+        const __m128 sign = _mm_or_ps(_mm_and_ps(x, ESIGN_MASK), EONE);
+        const __m128 t = sseMax(EZERO, _mm_sub_ps(EONE, _mm_mul_ps(_mm_mul_ps(HALF, sign), x)));
+        const __m128 s = _mm_mul_ps(_mm_add_ps(EONE, _mm_mul_ps(sign, _mm_sub_ps(EONE, _mm_mul_ps(t, t)))),
+                                    HALF);
+
+        const __m128 GlowGain = _mm_mul_ps(glowGain, s);
+
+        // Apply InvGlow.
+        const __m128 onePlusGain = _mm_add_ps(EONE, GlowGain);
+        const __m128 lowLimit = _mm_div_ps(_mm_mul_ps(_mm_mul_ps(onePlusGain, glowMid), two), three);
+
+        const __m128 lowGain = _mm_div_ps(_mm_xor_ps(GlowGain, ESIGN_MASK), onePlusGain);
+        const __m128 midGain
+            = _mm_div_ps(_mm_mul_ps(GlowGain, _mm_sub_ps(_mm_div_ps(glowMid, YC), HALF)),
+                         _mm_sub_ps(_mm_mul_ps(GlowGain, HALF), EONE));
+
+        const __m128 glowGainOut
+            = _mm_andnot_ps(_mm_cmpge_ps(YC, highLimit),
+                            sseSelect(_mm_cmple_ps(YC, lowLimit), lowGain, midGain));
+
+        // Calculate glow factor.
+        const __m128 glowFactor = _mm_add_ps(EONE, glowGainOut);
+
+        red = _mm_mul_ps(red, glowFactor);
+        grn = _mm_mul_ps(grn, glowFactor);
+        blu = _mm_mul_ps(blu, glowFactor);
+
+        StoreTransposed(out, red, grn, blu, alp);
+
+        in  += 16;
+        out += 16;
+    }
+#endif
+
+    for(; idx<numPixels; ++idx)
     {
         const float red = in[0];
         const float grn = in[1];
@@ -623,7 +1057,37 @@ void Renderer_ACES_DarkToDim10_Fwd::apply(const void * inImg, void * outImg, lon
     const float * in = (const float *)inImg;
     float * out = (float *)outImg;
 
-    for(long idx=0; idx<numPixels; ++idx)
+    long idx = 0;
+
+#ifdef USE_SSE
+    const __m128 minLum = _mm_set1_ps(1e-10f);
+    const __m128 lumR   = _mm_set1_ps(0.27222871678091454f);
+    const __m128 lumG   = _mm_set1_ps(0.67408176581114831f);
+    const __m128 lumB   = _mm_set1_ps(0.053689517407937051f);
+
+    for(; idx + 4 <= numPixels; idx += 4)
+    {
+        __m128 red, grn, blu, alp;
+        LoadTransposed(in, red, grn, blu, alp);
+
+        const __m128 Y
+            = sseMax(minLum, _mm_add_ps(_mm_add_ps(_mm_mul_ps(lumR, red), _mm_mul_ps(lumG, grn)),
+                                        _mm_mul_ps(lumB, blu)));
+
+        const __m128 Ypow_over_Y = PerLanePow(Y, m_gamma);
+
+        red = _mm_mul_ps(red, Ypow_over_Y);
+        grn = _mm_mul_ps(grn, Ypow_over_Y);
+        blu = _mm_mul_ps(blu, Ypow_over_Y);
+
+        StoreTransposed(out, red, grn, blu, alp);
+
+        in  += 16;
+        out += 16;
+    }
+#endif
+
+    for(; idx<numPixels; ++idx)
     {
         const float red = in[0];
         const float grn = in[1];
@@ -667,7 +1131,37 @@ void Renderer_REC2100_Surround::apply(const void * inImg, void * outImg, long nu
     const float * in = (const float *)inImg;
     float * out = (float *)outImg;
 
-    for(long idx=0; idx<numPixels; ++idx)
+    long idx = 0;
+
+#ifdef USE_SSE
+    const __m128 minLum = _mm_set1_ps(1e-4f);
+    const __m128 lumR   = _mm_set1_ps(0.2627f);
+    const __m128 lumG   = _mm_set1_ps(0.6780f);
+    const __m128 lumB   = _mm_set1_ps(0.0593f);
+
+    for(; idx + 4 <= numPixels; idx += 4)
+    {
+        __m128 red, grn, blu, alp;
+        LoadTransposed(in, red, grn, blu, alp);
+
+        const __m128 Y
+            = sseMax(minLum, _mm_add_ps(_mm_add_ps(_mm_mul_ps(lumR, red), _mm_mul_ps(lumG, grn)),
+                                        _mm_mul_ps(lumB, blu)));
+
+        const __m128 Ypow_over_Y = PerLanePow(Y, m_gamma);
+
+        red = _mm_mul_ps(red, Ypow_over_Y);
+        grn = _mm_mul_ps(grn, Ypow_over_Y);
+        blu = _mm_mul_ps(blu, Ypow_over_Y);
+
+        StoreTransposed(out, red, grn, blu, alp);
+
+        in  += 16;
+        out += 16;
+    }
+#endif
+
+    for(; idx<numPixels; ++idx)
     {
         const float red = in[0];
         const float grn = in[1];
@@ -716,7 +1210,54 @@ void Renderer_RGB_TO_HSV::apply(const void * inImg, void * outImg, long numPixel
     const float * in = (const float *)inImg;
     float * out = (float *)outImg;
 
-    for(long idx=0; idx<numPixels; ++idx)
+    long idx = 0;
+
+#ifdef USE_SSE
+    static const __m128 TWO   = _mm_set1_ps(2.f);
+    static const __m128 FOUR  = _mm_set1_ps(4.f);
+    static const __m128 SIX   = _mm_set1_ps(6.f);
+    static const __m128 SIXTH = _mm_set1_ps(0.16666666666666666f);
+
+    for(; idx + 4 <= numPixels; idx += 4)
+    {
+        __m128 red, grn, blu, alp;
+        LoadTransposed(in, red, grn, blu, alp);
+
+        const __m128 rgb_min = sseMin( sseMin( red, grn ), blu );
+        const __m128 rgb_max = sseMax( sseMax( red, grn ), blu );
+
+        const __m128 delta = _mm_sub_ps(rgb_max, rgb_min);
+
+        // Sat
+        const __m128 hasChroma = _mm_cmpneq_ps(rgb_min, rgb_max);
+        __m128 sat = _mm_and_ps(_mm_and_ps(hasChroma, _mm_cmpneq_ps(rgb_max, EZERO)),
+                                _mm_div_ps(delta, rgb_max));
+
+        // Hue
+        const __m128 redHue = _mm_div_ps(_mm_sub_ps(grn, blu), delta);
+        const __m128 grnHue = _mm_add_ps(TWO, _mm_div_ps(_mm_sub_ps(blu, red), delta));
+        const __m128 bluHue = _mm_add_ps(FOUR, _mm_div_ps(_mm_sub_ps(red, grn), delta));
+
+        __m128 hue = sseSelect(_mm_cmpeq_ps(red, rgb_max), redHue,
+                               sseSelect(_mm_cmpeq_ps(grn, rgb_max), grnHue, bluHue));
+        hue = sseSelect(_mm_cmplt_ps(hue, EZERO), _mm_add_ps(hue, SIX), hue);
+        hue = _mm_and_ps(hasChroma, _mm_mul_ps(hue, SIXTH));
+
+        // Handle extended range inputs.
+        const __m128 val = sseSelect(_mm_cmplt_ps(rgb_min, EZERO),
+                                     _mm_add_ps(rgb_max, rgb_min), rgb_max);
+
+        const __m128 neg_min = _mm_xor_ps(rgb_min, ESIGN_MASK);
+        sat = sseSelect(_mm_cmpgt_ps(neg_min, rgb_max), _mm_div_ps(delta, neg_min), sat);
+
+        StoreTransposed(out, hue, sat, val, alp);
+
+        in  += 16;
+        out += 16;
+    }
+#endif
+
+    for(; idx<numPixels; ++idx)
     {
         const float red = in[0];
         const float grn = in[1];
@@ -798,7 +1339,58 @@ void Renderer_HSV_TO_RGB::apply(const void * inImg, void * outImg, long numPixel
     const float * in = (const float *)inImg;
     float * out = (float *)outImg;
 
-    for (long idx=0; idx<numPixels; ++idx)
+    long idx = 0;
+
+#ifdef USE_SSE
+    static const __m128 MAX_SAT = _mm_set1_ps(1.999f);
+    static const __m128 TWO     = _mm_set1_ps(2.f);
+    static const __m128 THREE   = _mm_set1_ps(3.f);
+    static const __m128 FOUR    = _mm_set1_ps(4.f);
+    static const __m128 SIX     = _mm_set1_ps(6.f);
+
+    for(; idx + 4 <= numPixels; idx += 4)
+    {
+        __m128 hue, sat, val, alp;
+        LoadTransposed(in, hue, sat, val, alp);
+
+        hue = _mm_mul_ps(_mm_sub_ps(hue, sseFloor(hue)), SIX);
+        sat = sseClamp(sat, EZERO, MAX_SAT);
+
+        const __m128 red = sseClamp(_mm_sub_ps(_mm_and_ps(_mm_sub_ps(hue, THREE), EABS_MASK), EONE),
+                                    EZERO, EONE);
+        const __m128 grn = sseClamp(_mm_sub_ps(TWO, _mm_and_ps(_mm_sub_ps(hue, TWO), EABS_MASK)),
+                                    EZERO, EONE);
+        const __m128 blu = sseClamp(_mm_sub_ps(TWO, _mm_and_ps(_mm_sub_ps(hue, FOUR), EABS_MASK)),
+                                    EZERO, EONE);
+
+        __m128 rgb_max = val;
+        __m128 rgb_min = _mm_mul_ps(val, _mm_sub_ps(EONE, sat));
+
+        // Handle extended range inputs.
+        const __m128 twoMinusSat = _mm_sub_ps(TWO, sat);
+
+        const __m128 satAboveOne = _mm_cmpgt_ps(sat, EONE);
+        rgb_min = sseSelect(satAboveOne, _mm_div_ps(rgb_min, twoMinusSat), rgb_min);
+        rgb_max = sseSelect(satAboveOne, _mm_sub_ps(val, rgb_min), rgb_max);
+
+        const __m128 negVal = _mm_cmplt_ps(val, EZERO);
+        rgb_min = sseSelect(negVal, _mm_div_ps(val, twoMinusSat), rgb_min);
+        rgb_max = sseSelect(negVal, _mm_sub_ps(val, rgb_min), rgb_max);
+
+        const __m128 delta = _mm_sub_ps(rgb_max, rgb_min);
+
+        StoreTransposed(out,
+                        _mm_add_ps(_mm_mul_ps(red, delta), rgb_min),
+                        _mm_add_ps(_mm_mul_ps(grn, delta), rgb_min),
+                        _mm_add_ps(_mm_mul_ps(blu, delta), rgb_min),
+                        alp);
+
+        in  += 16;
+        out += 16;
+    }
+#endif
+
+    for(; idx<numPixels; ++idx)
     {
         constexpr float MAX_SAT = 1.999f;
 
@@ -846,7 +1438,25 @@ void Renderer_XYZ_TO_xyY::apply(const void * inImg, void * outImg, long numPixel
     const float * in = (const float *)inImg;
     float * out = (float *)outImg;
 
-    for(long idx=0; idx<numPixels; ++idx)
+    long idx = 0;
+
+#ifdef USE_SSE
+    for(; idx + 4 <= numPixels; idx += 4)
+    {
+        __m128 X, Y, Z, alp;
+        LoadTransposed(in, X, Y, Z, alp);
+
+        __m128 d = _mm_add_ps(_mm_add_ps(X, Y), Z);
+        d = _mm_andnot_ps(_mm_cmpeq_ps(d, EZERO), _mm_div_ps(EONE, d));
+
+        StoreTransposed(out, _mm_mul_ps(X, d), _mm_mul_ps(Y, d), Y, alp);
+
+        in  += 16;
+        out += 16;
+    }
+#endif
+
+    for(; idx<numPixels; ++idx)
     {
         const float X = in[0];
         const float Y = in[1];
@@ -877,7 +1487,27 @@ void Renderer_xyY_TO_XYZ::apply(const void * inImg, void * outImg, long numPixel
     const float * in = (const float *)inImg;
     float * out = (float *)outImg;
 
-    for(long idx=0; idx<numPixels; ++idx)
+    long idx = 0;
+
+#ifdef USE_SSE
+    for(; idx + 4 <= numPixels; idx += 4)
+    {
+        __m128 x, y, Y, alp;
+        LoadTransposed(in, x, y, Y, alp);
+
+        const __m128 d = _mm_andnot_ps(_mm_cmpeq_ps(y, EZERO), _mm_div_ps(EONE, y));
+
+        const __m128 X = _mm_mul_ps(_mm_mul_ps(Y, x), d);
+        const __m128 Z = _mm_mul_ps(_mm_mul_ps(Y, _mm_sub_ps(_mm_sub_ps(EONE, x), y)), d);
+
+        StoreTransposed(out, X, Y, Z, alp);
+
+        in  += 16;
+        out += 16;
+    }
+#endif
+
+    for(; idx<numPixels; ++idx)
     {
         const float x = in[0];
         const float y = in[1];
@@ -907,7 +1537,32 @@ void Renderer_XYZ_TO_uvY::apply(const void * inImg, void * outImg, long numPixel
     const float * in = (const float *)inImg;
     float * out = (float *)outImg;
 
-    for(long idx=0; idx<numPixels; ++idx)
+    long idx = 0;
+
+#ifdef USE_SSE
+    static const __m128 THREE   = _mm_set1_ps(3.f);
+    static const __m128 FOUR    = _mm_set1_ps(4.f);
+    static const __m128 NINE    = _mm_set1_ps(9.f);
+    static const __m128 FIFTEEN = _mm_set1_ps(15.f);
+
+    for(; idx + 4 <= numPixels; idx += 4)
+    {
+        __m128 X, Y, Z, alp;
+        LoadTransposed(in, X, Y, Z, alp);
+
+        __m128 d = _mm_add_ps(_mm_add_ps(X, _mm_mul_ps(FIFTEEN, Y)), _mm_mul_ps(THREE, Z));
+        d = _mm_andnot_ps(_mm_cmpeq_ps(d, EZERO), _mm_div_ps(EONE, d));
+        const __m128 u = _mm_mul_ps(_mm_mul_ps(FOUR, X), d);
+        const __m128 v = _mm_mul_ps(_mm_mul_ps(NINE, Y), d);
+
+        StoreTransposed(out, u, v, Y, alp);
+
+        in  += 16;
+        out += 16;
+    }
+#endif
+
+    for(; idx<numPixels; ++idx)
     {
         // TODO: Check robustness for arbitrary float inputs.
 
@@ -940,7 +1595,34 @@ void Renderer_uvY_TO_XYZ::apply(const void * inImg, void * outImg, long numPixel
     const float * in = (const float *)inImg;
     float * out = (float *)outImg;
 
-    for(long idx=0; idx<numPixels; ++idx)
+    long idx = 0;
+
+#ifdef USE_SSE
+    static const __m128 FOUR  = _mm_set1_ps(4.f);
+    static const __m128 X_FAC = _mm_set1_ps(9.f / 4.f);
+    static const __m128 Z_FAC = _mm_set1_ps(3.f / 4.f);
+    static const __m128 V_FAC = _mm_set1_ps(6.666666666666667f);
+
+    for(; idx + 4 <= numPixels; idx += 4)
+    {
+        __m128 u, v, Y, alp;
+        LoadTransposed(in, u, v, Y, alp);
+
+        const __m128 d = _mm_andnot_ps(_mm_cmpeq_ps(v, EZERO), _mm_div_ps(EONE, v));
+        const __m128 X = _mm_mul_ps(_mm_mul_ps(_mm_mul_ps(X_FAC, Y), u), d);
+        const __m128 Z
+            = _mm_mul_ps(_mm_mul_ps(_mm_mul_ps(Z_FAC, Y),
+                                    _mm_sub_ps(_mm_sub_ps(FOUR, u), _mm_mul_ps(V_FAC, v))),
+                         d);
+
+        StoreTransposed(out, X, Y, Z, alp);
+
+        in  += 16;
+        out += 16;
+    }
+#endif
+
+    for(; idx<numPixels; ++idx)
     {
         // TODO: Check robustness for arbitrary float inputs.
 
@@ -972,7 +1654,48 @@ void Renderer_XYZ_TO_LUV::apply(const void * inImg, void * outImg, long numPixel
     const float * in = (const float *)inImg;
     float * out = (float *)outImg;
 
-    for(long idx=0; idx<numPixels; ++idx)
+    long idx = 0;
+
+#ifdef USE_SSE
+    static const __m128 THREE   = _mm_set1_ps(3.f);
+    static const __m128 FOUR    = _mm_set1_ps(4.f);
+    static const __m128 NINE    = _mm_set1_ps(9.f);
+    static const __m128 FIFTEEN = _mm_set1_ps(15.f);
+
+    static const __m128 THRESHOLD = _mm_set1_ps(0.008856451679f);
+    static const __m128 LIN_SCALE = _mm_set1_ps(9.0329629629629608f);
+    static const __m128 L_SCALE   = _mm_set1_ps(1.16f);
+    static const __m128 L_OFFSET  = _mm_set1_ps(0.16f);
+    static const __m128 THIRTEEN  = _mm_set1_ps(13.f);
+    static const __m128 U_WHITE   = _mm_set1_ps(0.19783001f);   // D65 white
+    static const __m128 V_WHITE   = _mm_set1_ps(0.46831999f);   // D65 white
+
+    for(; idx + 4 <= numPixels; idx += 4)
+    {
+        __m128 X, Y, Z, alp;
+        LoadTransposed(in, X, Y, Z, alp);
+
+        __m128 d = _mm_add_ps(_mm_add_ps(X, _mm_mul_ps(FIFTEEN, Y)), _mm_mul_ps(THREE, Z));
+        d = _mm_andnot_ps(_mm_cmpeq_ps(d, EZERO), _mm_div_ps(EONE, d));
+        const __m128 u = _mm_mul_ps(_mm_mul_ps(FOUR, X), d);
+        const __m128 v = _mm_mul_ps(_mm_mul_ps(NINE, Y), d);
+
+        const __m128 Lstar
+            = sseSelect(_mm_cmple_ps(Y, THRESHOLD),
+                        _mm_mul_ps(LIN_SCALE, Y),
+                        _mm_sub_ps(_mm_mul_ps(L_SCALE, PerLanePow(Y, 0.333333333f)), L_OFFSET));
+
+        const __m128 ustar = _mm_mul_ps(_mm_mul_ps(THIRTEEN, Lstar), _mm_sub_ps(u, U_WHITE));
+        const __m128 vstar = _mm_mul_ps(_mm_mul_ps(THIRTEEN, Lstar), _mm_sub_ps(v, V_WHITE));
+
+        StoreTransposed(out, Lstar, ustar, vstar, alp);
+
+        in  += 16;
+        out += 16;
+    }
+#endif
+
+    for(; idx<numPixels; ++idx)
     {
         // TODO: Check robustness for arbitrary float inputs.
 
@@ -1010,7 +1733,51 @@ void Renderer_LUV_TO_XYZ::apply(const void * inImg, void * outImg, long numPixel
     const float * in = (const float *)inImg;
     float * out = (float *)outImg;
 
-    for(long idx=0; idx<numPixels; ++idx)
+    long idx = 0;
+
+#ifdef USE_SSE
+    static const __m128 INV_13    = _mm_set1_ps(0.076923076923076927f);
+    static const __m128 U_WHITE   = _mm_set1_ps(0.19783001f);   // D65 white
+    static const __m128 V_WHITE   = _mm_set1_ps(0.46831999f);   // D65 white
+    static const __m128 L_OFFSET  = _mm_set1_ps(0.16f);
+    static const __m128 L_SCALE   = _mm_set1_ps(0.86206896551724144f);
+    static const __m128 THRESHOLD = _mm_set1_ps(0.08f);
+    static const __m128 LIN_SCALE = _mm_set1_ps(0.11070564598794539f);
+    static const __m128 QUARTER   = _mm_set1_ps(0.25f);
+    static const __m128 THREE     = _mm_set1_ps(3.f);
+    static const __m128 NINE      = _mm_set1_ps(9.f);
+    static const __m128 TWELVE    = _mm_set1_ps(12.f);
+    static const __m128 TWENTY    = _mm_set1_ps(20.f);
+
+    for(; idx + 4 <= numPixels; idx += 4)
+    {
+        __m128 Lstar, ustar, vstar, alp;
+        LoadTransposed(in, Lstar, ustar, vstar, alp);
+
+        const __m128 d = _mm_andnot_ps(_mm_cmpeq_ps(Lstar, EZERO), _mm_div_ps(INV_13, Lstar));
+        const __m128 u = _mm_add_ps(_mm_mul_ps(ustar, d), U_WHITE);
+        const __m128 v = _mm_add_ps(_mm_mul_ps(vstar, d), V_WHITE);
+
+        const __m128 tmp = _mm_mul_ps(_mm_add_ps(Lstar, L_OFFSET), L_SCALE);
+        const __m128 Y = sseSelect(_mm_cmple_ps(Lstar, THRESHOLD),
+                                   _mm_mul_ps(LIN_SCALE, Lstar),
+                                   _mm_mul_ps(_mm_mul_ps(tmp, tmp), tmp));
+
+        const __m128 dd = _mm_andnot_ps(_mm_cmpeq_ps(v, EZERO), _mm_div_ps(QUARTER, v));
+        const __m128 X = _mm_mul_ps(_mm_mul_ps(_mm_mul_ps(NINE, Y), u), dd);
+        const __m128 Z
+            = _mm_mul_ps(_mm_mul_ps(Y, _mm_sub_ps(_mm_sub_ps(TWELVE, _mm_mul_ps(THREE, u)),
+                                                  _mm_mul_ps(TWENTY, v))),
+                         dd);
+
+        StoreTransposed(out, X, Y, Z, alp);
+
+        in  += 16;
+        out += 16;
+    }
+#endif
+
+    for(; idx<numPixels; ++idx)
     {
         // TODO: Check robustness for arbitrary float inputs.
 
@@ -9,6 +9,7 @@
 #include "ops/gamma/GammaOpCPU.h"
 #include "ops/gamma/GammaOpGPU.h"
 #include "ops/gamma/GammaOpUtils.h"
+#include "ops/OpTools.h"
 #include "transforms/ExponentTransform.h"
 #include "transforms/ExponentWithLinearTransform.h"
 
@@ -126,6 +127,8 @@ void GammaOp::combineWith(OpRcPtrVec & ops, ConstOpRcPtr & secondOp) const
 
 void GammaOp::finalize(OptimizationFlags oFlags)
 {
+    gammaData()->setMathAccuracy(GetMathAccuracy(oFlags));
+
     gammaData()->finalize();
 
     // Create the cacheID
@@ -21,6 +21,7 @@ namespace OCIO_NAMESPACE
 
 
 // Base class for the Gamma (i.e. basic style) operation renderers.
+template<MathAccuracy accuracy>
 class GammaBasicOpCPU : public OpCPU
 {
 public:
@@ -40,24 +41,38 @@ protected:
     float m_alpGamma;
 };
 
-class GammaBasicMirrorOpCPU : public GammaBasicOpCPU
+template<MathAccuracy accuracy>
+class GammaBasicMirrorOpCPU : public GammaBasicOpCPU<accuracy>
 {
 public:
     GammaBasicMirrorOpCPU() = delete;
-    GammaBasicMirrorOpCPU(const GammaBasicOpCPU &) = delete;
+    GammaBasicMirrorOpCPU(const GammaBasicMirrorOpCPU &) = delete;
     explicit GammaBasicMirrorOpCPU(ConstGammaOpDataRcPtr & gamma);
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
+
+protected:
+    using GammaBasicOpCPU<accuracy>::m_redGamma;
+    using GammaBasicOpCPU<accuracy>::m_grnGamma;
+    using GammaBasicOpCPU<accuracy>::m_bluGamma;
+    using GammaBasicOpCPU<accuracy>::m_alpGamma;
 };
 
-class GammaBasicPassThruOpCPU : public GammaBasicOpCPU
+template<MathAccuracy accuracy>
+class GammaBasicPassThruOpCPU : public GammaBasicOpCPU<accuracy>
 {
 public:
     GammaBasicPassThruOpCPU() = delete;
-    GammaBasicPassThruOpCPU(const GammaBasicOpCPU &) = delete;
+    GammaBasicPassThruOpCPU(const GammaBasicPassThruOpCPU &) = delete;
     explicit GammaBasicPassThruOpCPU(ConstGammaOpDataRcPtr & gamma);
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
+
+protected:
+    using GammaBasicOpCPU<accuracy>::m_redGamma;
+    using GammaBasicOpCPU<accuracy>::m_grnGamma;
+    using GammaBasicOpCPU<accuracy>::m_bluGamma;
+    using GammaBasicOpCPU<accuracy>::m_alpGamma;
 };
 
 class GammaMoncurveOpCPU : public OpCPU
@@ -72,6 +87,7 @@ protected:
     RendererParams m_alpha;
 };
 
+template<MathAccuracy accuracy>
 class GammaMoncurveOpCPUFwd : public GammaMoncurveOpCPU
 {
 public:
@@ -83,6 +99,7 @@ protected:
     void update(ConstGammaOpDataRcPtr & gamma);
 };
 
+template<MathAccuracy accuracy>
 class GammaMoncurveOpCPURev : public GammaMoncurveOpCPU
 {
 public:
@@ -95,6 +112,7 @@ protected:
 
 };
 
+template<MathAccuracy accuracy>
 class GammaMoncurveMirrorOpCPUFwd : public GammaMoncurveOpCPU
 {
 public:
@@ -106,6 +124,7 @@ protected:
     void update(ConstGammaOpDataRcPtr & gamma);
 };
 
+template<MathAccuracy accuracy>
 class GammaMoncurveMirrorOpCPURev : public GammaMoncurveOpCPU
 {
 public:
@@ -118,50 +137,51 @@ protected:
 
 };
 
+template<MathAccuracy accuracy>
 ConstOpCPURcPtr GetGammaRenderer(ConstGammaOpDataRcPtr & gamma)
 {
     switch(gamma->getStyle())
     {
         case GammaOpData::MONCURVE_FWD:
         {
-            return std::make_shared<GammaMoncurveOpCPUFwd>(gamma);
+            return std::make_shared<GammaMoncurveOpCPUFwd<accuracy>>(gamma);
             break;
         }
 
         case GammaOpData::MONCURVE_REV:
         {
-            return std::make_shared<GammaMoncurveOpCPURev>(gamma);
+            return std::make_shared<GammaMoncurveOpCPURev<accuracy>>(gamma);
             break;
         }
 
         case GammaOpData::MONCURVE_MIRROR_FWD:
         {
-            return std::make_shared<GammaMoncurveMirrorOpCPUFwd>(gamma);
+            return std::make_shared<GammaMoncurveMirrorOpCPUFwd<accuracy>>(gamma);
             break;
         }
 
         case GammaOpData::MONCURVE_MIRROR_REV:
         {
-            return std::make_shared<GammaMoncurveMirrorOpCPURev>(gamma);
+            return std::make_shared<GammaMoncurveMirrorOpCPURev<accuracy>>(gamma);
             break;
         }
 
         case GammaOpData::BASIC_FWD:
         case GammaOpData::BASIC_REV:
         {
-            return std::make_shared<GammaBasicOpCPU>(gamma);
+            return std::make_shared<GammaBasicOpCPU<accuracy>>(gamma);
             break;
         }
         case GammaOpData::BASIC_MIRROR_FWD:
         case GammaOpData::BASIC_MIRROR_REV:
         {
-            return std::make_shared<GammaBasicMirrorOpCPU>(gamma);
+            return std::make_shared<GammaBasicMirrorOpCPU<accuracy>>(gamma);
             break;
         }
         case GammaOpData::BASIC_PASS_THRU_FWD:
         case GammaOpData::BASIC_PASS_THRU_REV:
         {
-            return std::make_shared<GammaBasicPassThruOpCPU>(gamma);
+            return std::make_shared<GammaBasicPassThruOpCPU<accuracy>>(gamma);
             break;
         }
     }
@@ -169,10 +189,28 @@ ConstOpCPURcPtr GetGammaRenderer(ConstGammaOpDataRcPtr & gamma)
     throw Exception("Unsupported Gamma style");
 }
 
+ConstOpCPURcPtr GetGammaRenderer(ConstGammaOpDataRcPtr & gamma)
+{
+#ifdef USE_SSE
+    switch (gamma->getMathAccuracy())
+    {
+        case MATH_ACCURACY_HIGH:
+            return GetGammaRenderer<MATH_ACCURACY_HIGH>(gamma);
+        case MATH_ACCURACY_PREVIEW:
+            return GetGammaRenderer<MATH_ACCURACY_PREVIEW>(gamma);
+        case MATH_ACCURACY_EXACT:
+            break;
+    }
+#endif
+
+    return GetGammaRenderer<MATH_ACCURACY_EXACT>(gamma);
+}
+
 
 
 
-GammaBasicOpCPU::GammaBasicOpCPU(ConstGammaOpDataRcPtr & gamma)
+template<MathAccuracy accuracy>
+GammaBasicOpCPU<accuracy>::GammaBasicOpCPU(ConstGammaOpDataRcPtr & gamma)
     :   OpCPU()
     ,   m_redGamma(0.0f)
     ,   m_grnGamma(0.0f)
@@ -182,7 +220,8 @@ GammaBasicOpCPU::GammaBasicOpCPU(ConstGammaOpDataRcPtr & gamma)
     update(gamma);
 }
 
-void GammaBasicOpCPU::update(ConstGammaOpDataRcPtr & gamma)
+template<MathAccuracy accuracy>
+void GammaBasicOpCPU<accuracy>::update(ConstGammaOpDataRcPtr & gamma)
 {
     // The gamma calculations are done in normalized space.
     const auto style = gamma->getStyle();
@@ -197,7 +236,8 @@ void GammaBasicOpCPU::update(ConstGammaOpDataRcPtr & gamma)
     m_alpGamma = (float)(forward ? gamma->getAlphaParams()[0] : 1. / gamma->getAlphaParams()[0]);
 }
 
-void GammaBasicOpCPU::apply(const void * inImg, void * outImg, long numPixels) const
+template<MathAccuracy accuracy>
+void GammaBasicOpCPU<accuracy>::apply(const void * inImg, void * outImg, long numPixels) const
 {
     const float * in = (const float *)inImg;
     float * out = (float *)outImg;
@@ -209,7 +249,7 @@ void GammaBasicOpCPU::apply(const void * inImg, void * outImg, long numPixels) c
     {
         __m128 pixel = _mm_set_ps(in[3], in[2], in[1], in[0]);
 
-        pixel = ssePower(pixel, gamma);
+        pixel = SSEMath<accuracy>::Power(pixel, gamma);
 
         _mm_storeu_ps(out, pixel);
 
@@ -235,12 +275,14 @@ void GammaBasicOpCPU::apply(const void * inImg, void * outImg, long numPixels) c
 #endif
 }
 
-GammaBasicMirrorOpCPU::GammaBasicMirrorOpCPU(ConstGammaOpDataRcPtr & gamma)
-    : GammaBasicOpCPU(gamma)
+template<MathAccuracy accuracy>
+GammaBasicMirrorOpCPU<accuracy>::GammaBasicMirrorOpCPU(ConstGammaOpDataRcPtr & gamma)
+    : GammaBasicOpCPU<accuracy>(gamma)
 {
 }
 
-void GammaBasicMirrorOpCPU::apply(const void * inImg, void * outImg, long numPixels) const
+template<MathAccuracy accuracy>
+void GammaBasicMirrorOpCPU<accuracy>::apply(const void * inImg, void * outImg, long numPixels) const
 {
     const float * in = (const float *)inImg;
     float * out = (float *)outImg;
@@ -254,7 +296,7 @@ void GammaBasicMirrorOpCPU::apply(const void * inImg, void * outImg, long numPix
         __m128 sign_pix = _mm_and_ps(pixel, ESIGN_MASK);
         __m128 abs_pix = _mm_and_ps(pixel, EABS_MASK);
 
-        pixel = ssePower(abs_pix, gamma);
+        pixel = SSEMath<accuracy>::Power(abs_pix, gamma);
         pixel = _mm_or_ps(sign_pix, pixel);
 
         _mm_storeu_ps(out, pixel);
@@ -281,12 +323,14 @@ void GammaBasicMirrorOpCPU::apply(const void * inImg, void * outImg, long numPix
 #endif
 }
 
-GammaBasicPassThruOpCPU::GammaBasicPassThruOpCPU(ConstGammaOpDataRcPtr & gamma)
-    : GammaBasicOpCPU(gamma)
+template<MathAccuracy accuracy>
+GammaBasicPassThruOpCPU<accuracy>::GammaBasicPassThruOpCPU(ConstGammaOpDataRcPtr & gamma)
+    : GammaBasicOpCPU<accuracy>(gamma)
 {
 }
 
-void GammaBasicPassThruOpCPU::apply(const void * inImg, void * outImg, long numPixels) const
+template<MathAccuracy accuracy>
+void GammaBasicPassThruOpCPU<accuracy>::apply(const void * inImg, void * outImg, long numPixels) const
 {
     const float * in = (const float *)inImg;
     float * out = (float *)outImg;
@@ -300,7 +344,7 @@ void GammaBasicPassThruOpCPU::apply(const void * inImg, void * outImg, long numP
         __m128 pixel = _mm_set_ps(in[3], in[2], in[1], in[0]);
         __m128 data = pixel;
 
-        data = ssePower(data, gamma);
+        data = SSEMath<accuracy>::Power(data, gamma);
 
         __m128 flag = _mm_cmpgt_ps(pixel, breakPnt);
 
@@ -328,13 +372,15 @@ void GammaBasicPassThruOpCPU::apply(const void * inImg, void * outImg, long numP
 #endif
 }
 
-GammaMoncurveOpCPUFwd::GammaMoncurveOpCPUFwd(ConstGammaOpDataRcPtr & gamma)
+template<MathAccuracy accuracy>
+GammaMoncurveOpCPUFwd<accuracy>::GammaMoncurveOpCPUFwd(ConstGammaOpDataRcPtr & gamma)
     :   GammaMoncurveOpCPU(gamma)
 {
     update(gamma);
 }
 
-void GammaMoncurveOpCPUFwd::update(ConstGammaOpDataRcPtr & gamma)
+template<MathAccuracy accuracy>
+void GammaMoncurveOpCPUFwd<accuracy>::update(ConstGammaOpDataRcPtr & gamma)
 {
     ComputeParamsFwd(gamma->getRedParams(),   m_red);
     ComputeParamsFwd(gamma->getGreenParams(), m_green);
@@ -342,7 +388,8 @@ void GammaMoncurveOpCPUFwd::update(ConstGammaOpDataRcPtr & gamma)
     ComputeParamsFwd(gamma->getAlphaParams(), m_alpha);
 }
 
-void GammaMoncurveOpCPUFwd::apply(const void * inImg, void * outImg, long numPixels) const
+template<MathAccuracy accuracy>
+void GammaMoncurveOpCPUFwd<accuracy>::apply(const void * inImg, void * outImg, long numPixels) const
 {
     const float * in = (const float *)inImg;
     float * out = (float *)outImg;
@@ -374,7 +421,7 @@ void GammaMoncurveOpCPUFwd::apply(const void * inImg, void * outImg, long numPix
 
         __m128 data = _mm_add_ps(_mm_mul_ps(pixel, scale), offset);
 
-        data = ssePower(data, gamma);
+        data = SSEMath<accuracy>::Power(data, gamma);
 
         __m128 flag = _mm_cmpgt_ps( pixel, breakPnt);
 
@@ -420,13 +467,15 @@ void GammaMoncurveOpCPUFwd::apply(const void * inImg, void * outImg, long numPix
 #endif
 }
 
-GammaMoncurveOpCPURev::GammaMoncurveOpCPURev(ConstGammaOpDataRcPtr & gamma)
+template<MathAccuracy accuracy>
+GammaMoncurveOpCPURev<accuracy>::GammaMoncurveOpCPURev(ConstGammaOpDataRcPtr & gamma)
     :   GammaMoncurveOpCPU(gamma)
 {
     update(gamma);
 }
 
-void GammaMoncurveOpCPURev::update(ConstGammaOpDataRcPtr & gamma)
+template<MathAccuracy accuracy>
+void GammaMoncurveOpCPURev<accuracy>::update(ConstGammaOpDataRcPtr & gamma)
 {
     ComputeParamsRev(gamma->getRedParams(),   m_red);
     ComputeParamsRev(gamma->getGreenParams(), m_green);
@@ -434,7 +483,8 @@ void GammaMoncurveOpCPURev::update(ConstGammaOpDataRcPtr & gamma)
     ComputeParamsRev(gamma->getAlphaParams(), m_alpha);
 }
 
-void GammaMoncurveOpCPURev::apply(const void * inImg, void * outImg, long numPixels) const
+template<MathAccuracy accuracy>
+void GammaMoncurveOpCPURev<accuracy>::apply(const void * inImg, void * outImg, long numPixels) const
 {
     const float * in = (const float *)inImg;
     float * out = (float *)outImg;
@@ -464,7 +514,7 @@ void GammaMoncurveOpCPURev::apply(const void * inImg, void * outImg, long numPix
     {
         __m128 pixel = _mm_set_ps(in[3], in[2], in[1], in[0]);
 
-        __m128 data = ssePower(pixel, gamma);
+        __m128 data = SSEMath<accuracy>::Power(pixel, gamma);
 
         data = _mm_sub_ps(_mm_mul_ps(data, scale), offset);
 
@@ -512,13 +562,15 @@ void GammaMoncurveOpCPURev::apply(const void * inImg, void * outImg, long numPix
 #endif
 }
 
-GammaMoncurveMirrorOpCPUFwd::GammaMoncurveMirrorOpCPUFwd(ConstGammaOpDataRcPtr & gamma)
+template<MathAccuracy accuracy>
+GammaMoncurveMirrorOpCPUFwd<accuracy>::GammaMoncurveMirrorOpCPUFwd(ConstGammaOpDataRcPtr & gamma)
     : GammaMoncurveOpCPU(gamma)
 {
     update(gamma);
 }
 
-void GammaMoncurveMirrorOpCPUFwd::update(ConstGammaOpDataRcPtr & gamma)
+template<MathAccuracy accuracy>
+void GammaMoncurveMirrorOpCPUFwd<accuracy>::update(ConstGammaOpDataRcPtr & gamma)
 {
     ComputeParamsFwd(gamma->getRedParams(), m_red);
     ComputeParamsFwd(gamma->getGreenParams(), m_green);
@@ -526,7 +578,8 @@ void GammaMoncurveMirrorOpCPUFwd::update(ConstGammaOpDataRcPtr & gamma)
     ComputeParamsFwd(gamma->getAlphaParams(), m_alpha);
 }
 
-void GammaMoncurveMirrorOpCPUFwd::apply(const void * inImg, void * outImg, long numPixels) const
+template<MathAccuracy accuracy>
+void GammaMoncurveMirrorOpCPUFwd<accuracy>::apply(const void * inImg, void * outImg, long numPixels) const
 {
     const float * in = (const float *)inImg;
     float * out = (float *)outImg;
@@ -555,7 +608,7 @@ void GammaMoncurveMirrorOpCPUFwd::apply(const void * inImg, void * outImg, long
 
         __m128 data = _mm_add_ps(_mm_mul_ps(abs_pix, scale), offset);
 
-        data = ssePower(data, gamma);
+        data = SSEMath<accuracy>::Power(data, gamma);
 
         __m128 flagbrk = _mm_cmpgt_ps(abs_pix, breakPnt);
 
@@ -603,13 +656,15 @@ void GammaMoncurveMirrorOpCPUFwd::apply(const void * inImg, void * outImg, long
 #endif
 }
 
-GammaMoncurveMirrorOpCPURev::GammaMoncurveMirrorOpCPURev(ConstGammaOpDataRcPtr & gamma)
+template<MathAccuracy accuracy>
+GammaMoncurveMirrorOpCPURev<accuracy>::GammaMoncurveMirrorOpCPURev(ConstGammaOpDataRcPtr & gamma)
     : GammaMoncurveOpCPU(gamma)
 {
     update(gamma);
 }
 
-void GammaMoncurveMirrorOpCPURev::update(ConstGammaOpDataRcPtr & gamma)
+template<MathAccuracy accuracy>
+void GammaMoncurveMirrorOpCPURev<accuracy>::update(ConstGammaOpDataRcPtr & gamma)
 {
     ComputeParamsRev(gamma->getRedParams(), m_red);
     ComputeParamsRev(gamma->getGreenParams(), m_green);
@@ -617,7 +672,8 @@ void GammaMoncurveMirrorOpCPURev::update(ConstGammaOpDataRcPtr & gamma)
     ComputeParamsRev(gamma->getAlphaParams(), m_alpha);
 }
 
-void GammaMoncurveMirrorOpCPURev::apply(const void * inImg, void * outImg, long numPixels) const
+template<MathAccuracy accuracy>
+void GammaMoncurveMirrorOpCPURev<accuracy>::apply(const void * inImg, void * outImg, long numPixels) const
 {
     const float * in = (const float *)inImg;
     float * out = (float *)outImg;
@@ -644,7 +700,7 @@ void GammaMoncurveMirrorOpCPURev::apply(const void * inImg, void * outImg, long
         __m128 sign_pix = _mm_and_ps(pixel, ESIGN_MASK);
         __m128 abs_pix = _mm_and_ps(pixel, EABS_MASK);
 
-        __m128 data = ssePower(abs_pix, gamma);
+        __m128 data = SSEMath<accuracy>::Power(abs_pix, gamma);
 
         data = _mm_sub_ps(_mm_mul_ps(data, scale), offset);
 
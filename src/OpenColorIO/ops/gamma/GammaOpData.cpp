@@ -9,6 +9,7 @@
 #include "BitDepthUtils.h"
 #include "ops/gamma/GammaOpData.h"
 #include "ops/matrix/MatrixOp.h"
+#include "ops/OpTools.h"
 #include "ops/range/RangeOpData.h"
 #include "ParseUtils.h"
 #include "Platform.h"
@@ -326,7 +327,8 @@ bool GammaOpData::isInverse(const GammaOpData & B) const
         if ( (getRedParams() == B.getRedParams()) &&
              (getGreenParams() == B.getGreenParams()) &&
              (getBlueParams() == B.getBlueParams()) &&
-             (getAlphaParams() == B.getAlphaParams()) )
+             (getAlphaParams() == B.getAlphaParams()) &&
+             (getMathAccuracy() == B.getMathAccuracy()) )
         {
             return true;
         }
@@ -569,6 +571,11 @@ bool GammaOpData::mayCompose(const GammaOpData & B) const
 {
     // NB: This also does not check bypass or dynamic.
 
+    if (getMathAccuracy() != B.getMathAccuracy())
+    {
+        return false;
+    }
+
     const auto styleA = getStyle();
     const auto styleB = B.getStyle();
 
@@ -799,7 +806,8 @@ bool GammaOpData::operator==(const OpData & other) const
             m_redParams == gop->m_redParams &&
             m_greenParams == gop->m_greenParams &&
             m_blueParams == gop->m_blueParams &&
-            m_alphaParams == gop->m_alphaParams;
+            m_alphaParams == gop->m_alphaParams &&
+            m_mathAccuracy == gop->m_mathAccuracy;
 }
 
 void GammaOpData::finalize()
@@ -818,6 +826,8 @@ void GammaOpData::finalize()
     cacheIDStream << "b:" << GetParametersString(getBlueParams())  << " ";
     cacheIDStream << "a:" << GetParametersString(getAlphaParams()) << " ";
 
+    cacheIDStream << "math:" << MathAccuracyToString(getMathAccuracy()) << " ";
+
     m_cacheID = cacheIDStream.str();
 }
 
@@ -9,6 +9,7 @@
 #include <OpenColorIO/OpenColorIO.h>
 
 #include "Op.h"
+#include "PrivateTypes.h"
 
 
 namespace OCIO_NAMESPACE
@@ -148,6 +149,10 @@ public:
     TransformDirection getDirection() const;
     void setDirection(TransformDirection dir);
 
+    // Accuracy of the log2/exp2/pow evaluations of the CPU renderer (set at finalization).
+    inline MathAccuracy getMathAccuracy() const { return m_mathAccuracy; }
+    inline void setMathAccuracy(MathAccuracy accuracy) { m_mathAccuracy = accuracy; }
+
     static bool isIdentityParameters(const Params & parameters, Style style);
     static Params getIdentityParameters(Style style);
 
@@ -162,6 +167,8 @@ private:
     Params m_greenParams;
     Params m_blueParams;
     Params m_alphaParams;
+
+    MathAccuracy m_mathAccuracy = MATH_ACCURACY_HIGH;
 };
 
 } // namespace OCIO_NAMESPACE
@@ -15,6 +15,7 @@
 #include "ops/log/LogOpData.h"
 #include "ops/log/LogOpGPU.h"
 #include "ops/log/LogOp.h"
+#include "ops/OpTools.h"
 #include "transforms/LogAffineTransform.h"
 #include "transforms/LogCameraTransform.h"
 #include "transforms/LogTransform.h"
@@ -93,8 +94,10 @@ bool LogOp::isInverse(ConstOpRcPtr & op) const
     return logData()->isInverse(logOpData);
 }
 
-void LogOp::finalize(OptimizationFlags /*oFlags*/)
+void LogOp::finalize(OptimizationFlags oFlags)
 {
+    logData()->setMathAccuracy(GetMathAccuracy(oFlags));
+
     logData()->finalize();
 
     // Create the cacheID.
@@ -50,6 +50,7 @@ protected:
 };
 
 // Renderer for LogToLin operations.
+template<MathAccuracy accuracy>
 class Log2LinRenderer : public L2LBaseRenderer
 {
 public:
@@ -67,6 +68,7 @@ protected:
 };
 
 // Renderer for Lin2Log operations.
+template<MathAccuracy accuracy>
 class Lin2LogRenderer : public L2LBaseRenderer
 {
 public:
@@ -98,6 +100,7 @@ protected:
 };
 
 // Renderer for CameraLogToLin operations.
+template<MathAccuracy accuracy>
 class CameraLog2LinRenderer : public CameraL2LBaseRenderer
 {
 public:
@@ -117,6 +120,7 @@ protected:
 };
 
 // Renderer for CameraLin2Log operations.
+template<MathAccuracy accuracy>
 class CameraLin2LogRenderer : public CameraL2LBaseRenderer
 {
 public:
@@ -135,6 +139,7 @@ protected:
 };
 
 // Renderer for Log10 and Log2 operations.
+template<MathAccuracy accuracy>
 class LogRenderer : public LogOpCPU
 {
 public:
@@ -147,6 +152,7 @@ private:
 };
 
 // Renderer for AntiLog10 and AntiLog2 operations.
+template<MathAccuracy accuracy>
 class AntiLogRenderer : public LogOpCPU
 {
 public:
@@ -161,6 +167,7 @@ private:
 static constexpr float LOG2_10 = ((float) 3.3219280948873623478703194294894);
 static constexpr float LOG10_2 = ((float) 0.3010299956639811952137388947245);
 
+template<MathAccuracy accuracy>
 ConstOpCPURcPtr GetLogRenderer(ConstLogOpDataRcPtr & log)
 {
     const TransformDirection dir = log->getDirection();
@@ -168,22 +175,22 @@ ConstOpCPURcPtr GetLogRenderer(ConstLogOpDataRcPtr & log)
     {
         if (dir == TRANSFORM_DIR_FORWARD)
         {
-            return std::make_shared<LogRenderer>(log, 1.0f);
+            return std::make_shared<LogRenderer<accuracy>>(log, 1.0f);
         }
         else
         {
-            return std::make_shared<AntiLogRenderer>(log, 1.0f);
+            return std::make_shared<AntiLogRenderer<accuracy>>(log, 1.0f);
         }
     }
     else if (log->isLog10())
     {
         if (dir == TRANSFORM_DIR_FORWARD)
         {
-            return std::make_shared<LogRenderer>(log, LOG10_2);
+            return std::make_shared<LogRenderer<accuracy>>(log, LOG10_2);
         }
         else
         {
-            return std::make_shared<AntiLogRenderer>(log, LOG2_10);
+            return std::make_shared<AntiLogRenderer<accuracy>>(log, LOG2_10);
         }
     }
     else
@@ -192,27 +199,44 @@ ConstOpCPURcPtr GetLogRenderer(ConstLogOpDataRcPtr & log)
         {
             if (dir == TRANSFORM_DIR_FORWARD)
             {
-                return std::make_shared<CameraLin2LogRenderer>(log);
+                return std::make_shared<CameraLin2LogRenderer<accuracy>>(log);
             }
             else
             {
-                return std::make_shared<CameraLog2LinRenderer>(log);
+                return std::make_shared<CameraLog2LinRenderer<accuracy>>(log);
             }
         }
         else
         {
             if (dir == TRANSFORM_DIR_FORWARD)
             {
-                return std::make_shared<Lin2LogRenderer>(log);
+                return std::make_shared<Lin2LogRenderer<accuracy>>(log);
             }
             else
             {
-                return std::make_shared<Log2LinRenderer>(log);
+                return std::make_shared<Log2LinRenderer<accuracy>>(log);
             }
         }
     }
 }
 
+ConstOpCPURcPtr GetLogRenderer(ConstLogOpDataRcPtr & log)
+{
+#ifdef USE_SSE
+    switch (log->getMathAccuracy())
+    {
+        case MATH_ACCURACY_HIGH:
+            return GetLogRenderer<MATH_ACCURACY_HIGH>(log);
+        case MATH_ACCURACY_PREVIEW:
+            return GetLogRenderer<MATH_ACCURACY_PREVIEW>(log);
+        case MATH_ACCURACY_EXACT:
+            break;
+    }
+#endif
+
+    return GetLogRenderer<MATH_ACCURACY_EXACT>(log);
+}
+
 LogOpCPU::LogOpCPU(ConstLogOpDataRcPtr & log)
     : OpCPU()
 {
@@ -238,7 +262,8 @@ void L2LBaseRenderer::updateData(ConstLogOpDataRcPtr & log)
     m_paramsB = log->getBlueParams();
 }
 
-LogRenderer::LogRenderer(ConstLogOpDataRcPtr & log, float logScale)
+template<MathAccuracy accuracy>
+LogRenderer<accuracy>::LogRenderer(ConstLogOpDataRcPtr & log, float logScale)
     : LogOpCPU(log)
     , m_logScale(logScale)
 {
@@ -291,7 +316,8 @@ inline void ApplyExp2(float * pix)
 }
 #endif
 
-void LogRenderer::apply(const void * inImg, void * outImg, long numPixels) const
+template<MathAccuracy accuracy>
+void LogRenderer<accuracy>::apply(const void * inImg, void * outImg, long numPixels) const
 {
     //
     // out = log2( max(in, minValue) ) * logScale;
@@ -311,7 +337,7 @@ void LogRenderer::apply(const void * inImg, void * outImg, long numPixels) const
     {
         mm_pixel = _mm_set_ps(0.0f, in[2], in[1], in[0]);
         mm_pixel = _mm_max_ps(mm_pixel, mm_minValue);
-        mm_pixel = sseLog2(mm_pixel);
+        mm_pixel = SSEMath<accuracy>::Log2(mm_pixel);
         mm_pixel = _mm_mul_ps(mm_pixel, mm_logScale);
 
         const float alphares = in[3];
@@ -343,14 +369,16 @@ void LogRenderer::apply(const void * inImg, void * outImg, long numPixels) const
 }
 
 // Renderer for AntiLog10 and AntiLog2 operations
-AntiLogRenderer::AntiLogRenderer(ConstLogOpDataRcPtr & log, float log2base)
+template<MathAccuracy accuracy>
+AntiLogRenderer<accuracy>::AntiLogRenderer(ConstLogOpDataRcPtr & log, float log2base)
     : LogOpCPU(log)
     , m_log2_base(log2base)
 {
     LogOpCPU::updateData(log);
 }
 
-void AntiLogRenderer::apply(const void * inImg, void * outImg, long numPixels) const
+template<MathAccuracy accuracy>
+void AntiLogRenderer<accuracy>::apply(const void * inImg, void * outImg, long numPixels) const
 {
     //
     // out = pow(base, in);
@@ -371,7 +399,7 @@ void AntiLogRenderer::apply(const void * inImg, void * outImg, long numPixels) c
     for (long idx = 0; idx<numPixels; ++idx)
     {
         mm_pixel = _mm_set_ps(0.0f, in[2], in[1], in[0]);
-        mm_pixel = sseExp2(_mm_mul_ps(mm_pixel, mm_log2_base));
+        mm_pixel = SSEMath<accuracy>::Exp2(_mm_mul_ps(mm_pixel, mm_log2_base));
 
         const float alphares = in[3];
 
@@ -401,13 +429,15 @@ void AntiLogRenderer::apply(const void * inImg, void * outImg, long numPixels) c
 }
 
 // Renderer for LogToLin operations
-Log2LinRenderer::Log2LinRenderer(ConstLogOpDataRcPtr & log)
+template<MathAccuracy accuracy>
+Log2LinRenderer<accuracy>::Log2LinRenderer(ConstLogOpDataRcPtr & log)
     : L2LBaseRenderer(log)
 {
     updateData(log);
 }
 
-void Log2LinRenderer::updateData(ConstLogOpDataRcPtr & log)
+template<MathAccuracy accuracy>
+void Log2LinRenderer<accuracy>::updateData(ConstLogOpDataRcPtr & log)
 {
     L2LBaseRenderer::updateData(log);
 
@@ -425,7 +455,8 @@ void Log2LinRenderer::updateData(ConstLogOpDataRcPtr & log)
     m_minv[2] = 1.0f / (float)m_paramsB[LIN_SIDE_SLOPE];
 }
 
-void Log2LinRenderer::apply(const void * inImg, void * outImg, long numPixels) const
+template<MathAccuracy accuracy>
+void Log2LinRenderer<accuracy>::apply(const void * inImg, void * outImg, long numPixels) const
 {
     //
     // out = ( pow( base, (in - logOffset) / logSlope ) - linOffset ) / linSlope;
@@ -453,7 +484,7 @@ void Log2LinRenderer::apply(const void * inImg, void * outImg, long numPixels) c
         mm_pixel = _mm_set_ps(0.0f, in[2], in[1], in[0]);
         mm_pixel = _mm_add_ps(mm_pixel, mm_minuskb);
         mm_pixel = _mm_mul_ps(mm_pixel, mm_kinv);
-        mm_pixel = sseExp2(mm_pixel);
+        mm_pixel = SSEMath<accuracy>::Exp2(mm_pixel);
         mm_pixel = _mm_add_ps(mm_pixel, mm_minusb);
         mm_pixel = _mm_mul_ps(mm_pixel, mm_minv);
 
@@ -488,13 +519,15 @@ void Log2LinRenderer::apply(const void * inImg, void * outImg, long numPixels) c
 }
 
 // Renderer for Lin2Log operations
-Lin2LogRenderer::Lin2LogRenderer(ConstLogOpDataRcPtr & log)
+template<MathAccuracy accuracy>
+Lin2LogRenderer<accuracy>::Lin2LogRenderer(ConstLogOpDataRcPtr & log)
     : L2LBaseRenderer(log)
 {
     updateData(log);
 }
 
-void Lin2LogRenderer::updateData(ConstLogOpDataRcPtr & log)
+template<MathAccuracy accuracy>
+void Lin2LogRenderer<accuracy>::updateData(ConstLogOpDataRcPtr & log)
 {
     L2LBaseRenderer::updateData(log);
 
@@ -512,7 +545,8 @@ void Lin2LogRenderer::updateData(ConstLogOpDataRcPtr & log)
     m_kb[2] = (float)m_paramsB[LOG_SIDE_OFFSET];
 }
 
-void Lin2LogRenderer::apply(const void * inImg, void * outImg, long numPixels) const
+template<MathAccuracy accuracy>
+void Lin2LogRenderer<accuracy>::apply(const void * inImg, void * outImg, long numPixels) const
 {
     // out = ( logSlope * log( base, max( minValue, (in*linSlope + linOffset) ) ) + logOffset )
     //
@@ -539,7 +573,7 @@ void Lin2LogRenderer::apply(const void * inImg, void * outImg, long numPixels) c
         mm_pixel = _mm_mul_ps(mm_pixel, mm_m);
         mm_pixel = _mm_add_ps(mm_pixel, mm_b);
         mm_pixel = _mm_max_ps(mm_pixel, mm_minValue);
-        mm_pixel = sseLog2(mm_pixel);
+        mm_pixel = SSEMath<accuracy>::Log2(mm_pixel);
         mm_pixel = _mm_mul_ps(mm_pixel, mm_klog);
         mm_pixel = _mm_add_ps(mm_pixel, mm_kb);
 
@@ -595,13 +629,15 @@ void CameraL2LBaseRenderer::updateData(ConstLogOpDataRcPtr & log)
     m_log2_base = log2((float)m_base);
 }
 
-CameraLog2LinRenderer::CameraLog2LinRenderer(ConstLogOpDataRcPtr & log)
+template<MathAccuracy accuracy>
+CameraLog2LinRenderer<accuracy>::CameraLog2LinRenderer(ConstLogOpDataRcPtr & log)
     : CameraL2LBaseRenderer(log)
 {
     updateData(log);
 }
 
-void CameraLog2LinRenderer::updateData(ConstLogOpDataRcPtr & log)
+template<MathAccuracy accuracy>
+void CameraLog2LinRenderer<accuracy>::updateData(ConstLogOpDataRcPtr & log)
 {
     CameraL2LBaseRenderer::updateData(log);
 
@@ -625,7 +661,8 @@ void CameraLog2LinRenderer::updateData(ConstLogOpDataRcPtr & log)
     m_minuslino[2] = -m_linearOffset[2];
 }
 
-void CameraLog2LinRenderer::apply(const void * inImg, void * outImg, long numPixels) const
+template<MathAccuracy accuracy>
+void CameraLog2LinRenderer<accuracy>::apply(const void * inImg, void * outImg, long numPixels) const
 {
     // if in <= logBreak
     //  out = ( in - linearOffset ) / linearSlope
@@ -660,7 +697,7 @@ void CameraLog2LinRenderer::apply(const void * inImg, void * outImg, long numPix
 
         mm_pixel = _mm_add_ps(mm_pixel, mm_minuskb);
         mm_pixel = _mm_mul_ps(mm_pixel, mm_kinv);
-        mm_pixel = sseExp2(mm_pixel);
+        mm_pixel = SSEMath<accuracy>::Exp2(mm_pixel);
         mm_pixel = _mm_add_ps(mm_pixel, mm_minusb);
         mm_pixel = _mm_mul_ps(mm_pixel, mm_minv);
 
@@ -702,13 +739,15 @@ void CameraLog2LinRenderer::apply(const void * inImg, void * outImg, long numPix
 #endif
 }
 
-CameraLin2LogRenderer::CameraLin2LogRenderer(ConstLogOpDataRcPtr & log)
+template<MathAccuracy accuracy>
+CameraLin2LogRenderer<accuracy>::CameraLin2LogRenderer(ConstLogOpDataRcPtr & log)
     : CameraL2LBaseRenderer(log)
 {
     updateData(log);
 }
 
-void CameraLin2LogRenderer::updateData(ConstLogOpDataRcPtr & log)
+template<MathAccuracy accuracy>
+void CameraLin2LogRenderer<accuracy>::updateData(ConstLogOpDataRcPtr & log)
 {
     CameraL2LBaseRenderer::updateData(log);
 
@@ -729,7 +768,8 @@ void CameraLin2LogRenderer::updateData(ConstLogOpDataRcPtr & log)
     m_linb[2] = (float)m_paramsB[LIN_SIDE_BREAK];
 }
 
-void CameraLin2LogRenderer::apply(const void * inImg, void * outImg, long numPixels) const
+template<MathAccuracy accuracy>
+void CameraLin2LogRenderer<accuracy>::apply(const void * inImg, void * outImg, long numPixels) const
 {
     // if in <= linBreak
     //  out = linearSlope * in + linearOffset 
@@ -768,7 +808,7 @@ void CameraLin2LogRenderer::apply(const void * inImg, void * outImg, long numPix
         mm_pixel = _mm_mul_ps(mm_pixel, mm_m);
         mm_pixel = _mm_add_ps(mm_pixel, mm_b);
         mm_pixel = _mm_max_ps(mm_pixel, mm_minValue);
-        mm_pixel = sseLog2(mm_pixel);
+        mm_pixel = SSEMath<accuracy>::Log2(mm_pixel);
         mm_pixel = _mm_mul_ps(mm_pixel, mm_klog);
         mm_pixel = _mm_add_ps(mm_pixel, mm_kb);
 
@@ -11,6 +11,7 @@
 #include "ops/log/LogOpData.h"
 #include "ops/log/LogUtils.h"
 #include "ops/matrix/MatrixOpData.h"
+#include "ops/OpTools.h"
 #include "ops/range/RangeOpData.h"
 #include "Platform.h"
 
@@ -341,6 +342,7 @@ void LogOpData::finalize()
             cacheIDStream << " LinearSlope " << getLinearSlopeString(DefaultValues::FLOAT_DECIMALS);
         }
     }
+    cacheIDStream << " MathAccuracy " << MathAccuracyToString(m_mathAccuracy);
     m_cacheID = cacheIDStream.str();
 }
 
@@ -354,7 +356,8 @@ bool LogOpData::operator==(const OpData& other) const
             && m_base == log->m_base
             && m_redParams == log->m_redParams
             && m_greenParams == log->m_greenParams
-            && m_blueParams == log->m_blueParams);
+            && m_blueParams == log->m_blueParams
+            && m_mathAccuracy == log->m_mathAccuracy);
 }
 
 LogOpDataRcPtr LogOpData::clone() const
@@ -365,6 +368,7 @@ LogOpDataRcPtr LogOpData::clone() const
                                              getGreenParams(),
                                              getBlueParams());
     clone->getFormatMetadata() = getFormatMetadata();
+    clone->setMathAccuracy(m_mathAccuracy);
     return clone;
 }
 
@@ -386,7 +390,8 @@ bool LogOpData::isInverse(ConstLogOpDataRcPtr & log) const
     if (GetInverseTransformDirection(m_direction) == log->m_direction
         && allComponentsEqual() && log->allComponentsEqual()
         && getRedParams() == log->getRedParams()
-        && getBase() == log->getBase())
+        && getBase() == log->getBase()
+        && m_mathAccuracy == log->m_mathAccuracy)
     {
         return true;
     }
@@ -8,6 +8,7 @@
 #include <OpenColorIO/OpenColorIO.h>
 
 #include "Op.h"
+#include "PrivateTypes.h"
 
 namespace OCIO_NAMESPACE
 {
@@ -98,6 +99,10 @@ public:
 
     void setDirection(TransformDirection dir) noexcept { m_direction = dir; }
 
+    // Accuracy of the log2/exp2/pow evaluations of the CPU renderer (set at finalization).
+    inline MathAccuracy getMathAccuracy() const { return m_mathAccuracy; }
+    inline void setMathAccuracy(MathAccuracy accuracy) { m_mathAccuracy = accuracy; }
+
     bool allComponentsEqual() const;
 
     std::string getLogSlopeString(std::streamsize precision) const;
@@ -152,6 +157,8 @@ private:
     double m_base = 2.0;
 
     TransformDirection m_direction = TRANSFORM_DIR_FORWARD;
+
+    MathAccuracy m_mathAccuracy = MATH_ACCURACY_HIGH;
 };
 
 } // namespace OCIO_NAMESPACE
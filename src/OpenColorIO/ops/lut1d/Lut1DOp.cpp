@@ -138,6 +138,9 @@ void Lut1DOp::finalize(OptimizationFlags oFlags)
     const bool invLutFast = (oFlags & OPTIMIZATION_LUT_INV_FAST) == OPTIMIZATION_LUT_INV_FAST;
     lutData->setInversionQuality(invLutFast ? LUT_INVERSION_FAST: LUT_INVERSION_EXACT);
 
+    lutData->setApproximationAllowed(
+        (oFlags & OPTIMIZATION_LUT1D_APPROX) == OPTIMIZATION_LUT1D_APPROX);
+
     lutData->finalize();
 
     // Rebuild the cache identifier.
@@ -2,9 +2,11 @@
 // Copyright Contributors to the OpenColorIO Project.
 
 #include <algorithm>
+#include <cmath>
 #include <math.h>
 #include <memory>
 #include <stdint.h>
+#include <vector>
 
 #include <OpenColorIO/OpenColorIO.h>
 
@@ -58,6 +60,31 @@ struct LookupLut
     }
 };
 
+// The LUTs are stored in a compact form when the interpolation of a subset of the entries
+// reproduces all of them within this relative error (i.e. well below the half float precision).
+constexpr float COMPACT_LUT_MAX_ERROR = 1e-5f;
+// Absolute error floor (relative to the output range) for the values close to zero.
+constexpr float COMPACT_LUT_MIN_VALUE = 1e-3f;
+
+inline bool IsCompactValueAccurate(float approx, float exact, float minValue)
+{
+    // Note: Fails on NaN & infinity.
+    return std::fabs(approx - exact)
+               <= COMPACT_LUT_MAX_ERROR * std::max(std::fabs(exact), minValue);
+}
+
+// Return true if the R, G and B curves of the (interleaved) LUT values are identical.
+bool HasIdenticalChannels(const Array::Values & values, unsigned long dim)
+{
+    for (unsigned long idx = 0; idx < dim; ++idx)
+    {
+        if (values[idx * 3] != values[idx * 3 + 1] || values[idx * 3] != values[idx * 3 + 2])
+        {
+            return false;
+        }
+    }
+    return true;
+}
 
 template<BitDepth inBD, BitDepth outBD>
 class BaseLut1DRenderer : public OpCPU
@@ -71,6 +98,12 @@ public:
     //     that having a way to test it is critical.
     constexpr bool isLookup() const noexcept { return inBD != BIT_DEPTH_F32; }
 
+    // Only one LUT is stored when the R, G and B curves are identical.
+    bool hasSingleLut() const noexcept
+    {
+        return m_tmpLutR && m_tmpLutR == m_tmpLutG && m_tmpLutR == m_tmpLutB;
+    }
+
 protected:
 
     virtual void update(ConstLut1DOpDataRcPtr & lut);
@@ -121,6 +154,160 @@ struct IndexPair
     static IndexPair GetEdgeFloatValues(float fIn);
 };
 
+// Compact representation of a half domain LUT (for one channel) to reduce the cache footprint
+// of the float input processing.  The 65536 half codes are split into 64 segments of 1024 codes
+// (i.e. one per sign & exponent) where the codes are evenly spaced so, where the curve is
+// smooth, a segment only keeps one entry out of 'stride' and interpolates the others.  Each
+// segment uses the largest power of two stride that reproduces all its entries within the max
+// error.
+class HalfSegmentedLut
+{
+public:
+    HalfSegmentedLut() = default;
+
+    // Build from the 65536 LUT values.  Return false if the compact form would not be at least
+    // twice smaller than the complete LUT.
+    bool build(const float * lut, float minValue);
+
+    // Same result as the interpolation of the complete LUT using IndexPair::GetEdgeFloatValues()
+    // for a stride of 1 but the half code and the fraction come directly from the float bits
+    // (i.e. no half conversion).
+    inline float evaluate(float in) const
+    {
+        const unsigned bits = FloatAsInt(in);
+        const unsigned sign = (bits >> 16) & 0x8000;
+        const unsigned absBits = bits & 0x7FFFFFFF;
+
+        unsigned code = 0;
+        float fraction = 0.0f;
+
+        if (absBits < 0x38800000)
+        {
+            // Zero & half denormals (i.e. below 2^-14) evenly spaced by 2^-24.
+            const float pos = IntAsFloat(absBits) * 16777216.0f;
+            code = (unsigned)pos;
+            fraction = pos - (float)code;
+        }
+        else if (absBits < 0x477FE000)
+        {
+            // Half normals i.e. rebias the exponent and keep the 10 highest mantissa bits.
+            const unsigned halfBits = absBits - 0x38000000;
+            code = halfBits >> 13;
+            fraction = (float)(halfBits & 0x1FFF) * (1.0f / 8192.0f);
+        }
+        else if (absBits <= 0x7F800000)
+        {
+            // Infinity and values above HALF_MAX are clamped to HALF_MAX.
+            code = 0x7BFF;
+        }
+        else
+        {
+            // NaN codes as per the half conversion.
+            const unsigned mantissa = (absBits & 0x7FFFFF) >> 13;
+            code = 0x7C00 | mantissa | (mantissa == 0);
+        }
+
+        code |= sign;
+
+        const Segment & segment = m_segments[code >> NUM_SEGMENT_BITS];
+        const unsigned segCode = code & SEGMENT_MASK;
+
+        const float * values = &m_values[segment.offset + (segCode >> segment.shift)];
+        fraction = (float(segCode & segment.mask) + fraction) * segment.invStride;
+
+        return lerpf(values[1], values[0], 1.0f - fraction);
+    }
+
+    size_t getNumValues() const { return m_values.size(); }
+
+private:
+    static constexpr unsigned NUM_CODES        = 65536;
+    static constexpr unsigned NUM_SEGMENT_BITS = 10;
+    static constexpr unsigned SEGMENT_SIZE     = 1 << NUM_SEGMENT_BITS;
+    static constexpr unsigned SEGMENT_MASK     = SEGMENT_SIZE - 1;
+    static constexpr unsigned NUM_SEGMENTS     = NUM_CODES / SEGMENT_SIZE;
+
+    struct Segment
+    {
+        unsigned offset    = 0;
+        unsigned shift     = 0;
+        unsigned mask      = 0;
+        float    invStride = 1.0f;
+    };
+
+    Segment m_segments[NUM_SEGMENTS];
+    std::vector<float> m_values;
+};
+
+typedef std::shared_ptr<HalfSegmentedLut> HalfSegmentedLutRcPtr;
+
+bool HalfSegmentedLut::build(const float * lut, float minValue)
+{
+    m_values.clear();
+
+    for (unsigned seg = 0; seg < NUM_SEGMENTS; ++seg)
+    {
+        const unsigned start = seg * SEGMENT_SIZE;
+
+        // The segments of the largest exponent end on the infinity codes, however
+        // IndexPair::GetEdgeFloatValues() clamps them to HALF_MAX.
+        const bool isLastFinite = (start + SEGMENT_SIZE) % 0x8000 == 0x7C00;
+        // Infinity & NaN codes.
+        const bool isInfNan = (start % 0x8000) == 0x7C00;
+
+        // Segment entries and the first entry of the next one (with the wrap around from
+        // the last NaN code to 0 of IndexPair::GetEdgeFloatValues()).
+        auto value = [&](unsigned code) -> float
+        {
+            if (code == SEGMENT_SIZE && isLastFinite)
+            {
+                return lut[start + SEGMENT_MASK];
+            }
+            return lut[(start + code) % NUM_CODES];
+        };
+
+        // The stride of the segments containing the edge cases is always 1.
+        unsigned shift = (isLastFinite || isInfNan) ? 0 : NUM_SEGMENT_BITS;
+        for (; shift > 0; --shift)
+        {
+            const unsigned stride = 1 << shift;
+            const float invStride = 1.0f / float(stride);
+
+            bool accurate = true;
+            for (unsigned code = 1; code < SEGMENT_SIZE && accurate; ++code)
+            {
+                const unsigned lo = code & ~(stride - 1);
+                if (lo != code)
+                {
+                    const float fraction = float(code - lo) * invStride;
+                    const float approx = lerpf(value(lo + stride), value(lo), 1.0f - fraction);
+                    accurate = IsCompactValueAccurate(approx, value(code), minValue);
+                }
+            }
+
+            if (accurate)
+            {
+                break;
+            }
+        }
+
+        Segment & segment = m_segments[seg];
+        segment.offset    = (unsigned)m_values.size();
+        segment.shift     = shift;
+        segment.mask      = (1 << shift) - 1;
+        segment.invStride = 1.0f / float(1 << shift);
+
+        for (unsigned code = 0; code <= SEGMENT_SIZE; code += (1 << shift))
+        {
+            m_values.push_back(value(code));
+        }
+    }
+
+    m_values.shrink_to_fit();
+
+    return m_values.size() * 2 <= NUM_CODES;
+}
+
 template<BitDepth inBD, BitDepth outBD>
 class Lut1DRendererHalfCode : public BaseLut1DRenderer<inBD, outBD>
 {
@@ -128,12 +315,29 @@ public:
     Lut1DRendererHalfCode() = delete;
 
     explicit Lut1DRendererHalfCode(ConstLut1DOpDataRcPtr & lut)
-        : BaseLut1DRenderer<inBD, outBD>(lut) {}
+        : BaseLut1DRenderer<inBD, outBD>(lut)
+    {
+        // Note: The hue adjust renderer needs the complete LUTs.
+        if (lut->isApproximationAllowed())
+        {
+            compact();
+        }
+    }
 
     Lut1DRendererHalfCode(ConstLut1DOpDataRcPtr & lut, BitDepth outBitDepth)
         : BaseLut1DRenderer<inBD, outBD>(lut, outBitDepth) {}
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
+
+    bool isSegmented() const noexcept { return (bool)m_segmentedR; }
+
+protected:
+    // Replace the complete LUTs by their segmented form when the curves are smooth.
+    void compact();
+
+    HalfSegmentedLutRcPtr m_segmentedR;
+    HalfSegmentedLutRcPtr m_segmentedG;
+    HalfSegmentedLutRcPtr m_segmentedB;
 };
 
 template<BitDepth inBD, BitDepth outBD>
@@ -175,6 +379,52 @@ public:
     void apply(const void * inImg, void * outImg, long numPixels) const override;
 };
 
+// Acceleration structure for the exact inverse evaluation of a 1D LUT.
+// The value range of an increasing LUT segment is split into buckets of equal
+// width and each bucket stores the lower_bound of its left edge. A search then
+// only has to bisect the few entries spanned by the bucket of the value rather
+// than the whole segment (4096 or 32768 entries), and returns exactly the same
+// entry as std::lower_bound over the full segment.
+class InvLutSearchIndex
+{
+public:
+    InvLutSearchIndex() = default;
+
+    void build(const float * start, const float * end);
+    void reset();
+
+    // Equivalent to std::lower_bound(start, end, val) with start & end being
+    // the pointers used to build the index.
+    inline const float * lowerBound(const float * start,
+                                    const float * end,
+                                    float val) const
+    {
+        if (m_numBuckets == 0)
+        {
+            return std::lower_bound(start, end, val);
+        }
+
+        // Note: NaNs go to the first bucket, where lower_bound returns start
+        // as it does for the full range.
+        const float f = (val - m_minValue) * m_invBucketWidth;
+        const long bucket
+            = (f > 0.f) ? (f < (float)m_numBuckets ? (long)f : m_numBuckets - 1) : 0;
+
+        // The bucket computation may be off by one due to float rounding,
+        // so the search is widened by one bucket on each side.
+        const long first = m_bucketStart[bucket > 0 ? bucket - 1 : 0];
+        const long last  = m_bucketStart[std::min(bucket + 2, m_numBuckets)];
+
+        return std::lower_bound(start + first, start + last, val);
+    }
+
+private:
+    std::vector<long> m_bucketStart;   // Size is m_numBuckets + 1.
+    float m_minValue = 0.f;
+    float m_invBucketWidth = 0.f;
+    long m_numBuckets = 0;
+};
+
 // Holds the parameters of a color component.
 // Note: The structure does not own any of the pointers.
 struct ComponentParams
@@ -198,11 +448,16 @@ struct ComponentParams
     const float * negLutEnd;  // lutEnd for negative part of half domain LUT.
     float flipSign;           // Flip the sign of value to handle decreasing luts.
     float bisectPoint;        // Point of switching from pos to neg of half domain.
+    InvLutSearchIndex index;  // Search index for [lutStart, lutEnd].
+    InvLutSearchIndex negIndex; // Search index for [negLutStart, negLutEnd].
 
     static void setComponentParams(ComponentParams & params,
                                    const Lut1DOpData::ComponentProperties & properties,
                                    const float * lutPtr,
                                    float lutZeroEntry);
+
+    // Build the search indexes once the LUT values are available.
+    static void buildSearchIndexes(ComponentParams & params, bool halfDomain);
 };
 
 template<BitDepth inBD, BitDepth outBD>
@@ -356,33 +611,63 @@ void BaseLut1DRenderer<inBD, outBD>::updateData(ConstLut1DOpDataRcPtr & lut)
 
         m_dim = newLut->getArray().getLength();
 
-        m_tmpLutR = new T[m_dim];
-        m_tmpLutG = new T[m_dim];
-        m_tmpLutB = new T[m_dim];
-
         const Array::Values & lutValues = newLut->getArray().getValues();
 
-        // TODO: Would be faster if R, G, B were adjacent in memory?
-        for(unsigned long i=0; i<m_dim; ++i)
+        // Only store one LUT when the three curves are identical.
+        if (HasIdenticalChannels(lutValues, m_dim))
         {
-            ((T*)m_tmpLutR)[i] = L_ADJUST(lutValues[i*3+0] * outMax);
-            ((T*)m_tmpLutG)[i] = L_ADJUST(lutValues[i*3+1] * outMax);
-            ((T*)m_tmpLutB)[i] = L_ADJUST(lutValues[i*3+2] * outMax);
+            m_tmpLutR = new T[m_dim];
+            m_tmpLutG = m_tmpLutR;
+            m_tmpLutB = m_tmpLutR;
+
+            for(unsigned long i=0; i<m_dim; ++i)
+            {
+                ((T*)m_tmpLutR)[i] = L_ADJUST(lutValues[i*3+0] * outMax);
+            }
+        }
+        else
+        {
+            m_tmpLutR = new T[m_dim];
+            m_tmpLutG = new T[m_dim];
+            m_tmpLutB = new T[m_dim];
+
+            // TODO: Would be faster if R, G, B were adjacent in memory?
+            for(unsigned long i=0; i<m_dim; ++i)
+            {
+                ((T*)m_tmpLutR)[i] = L_ADJUST(lutValues[i*3+0] * outMax);
+                ((T*)m_tmpLutG)[i] = L_ADJUST(lutValues[i*3+1] * outMax);
+                ((T*)m_tmpLutB)[i] = L_ADJUST(lutValues[i*3+2] * outMax);
+            }
         }
     }
     else
     {
         const Array::Values & lutValues = lut->getArray().getValues();
 
-        m_tmpLutR = new float[m_dim];
-        m_tmpLutG = new float[m_dim];
-        m_tmpLutB = new float[m_dim];
+        // Only store one LUT when the three curves are identical.
+        if (HasIdenticalChannels(lutValues, m_dim))
+        {
+            m_tmpLutR = new float[m_dim];
+            m_tmpLutG = m_tmpLutR;
+            m_tmpLutB = m_tmpLutR;
 
-        for(unsigned long i=0; i<m_dim; ++i)
+            for(unsigned long i=0; i<m_dim; ++i)
+            {
+                ((float*)m_tmpLutR)[i] = SanitizeFloat(lutValues[i*3+0] * outMax);
+            }
+        }
+        else
         {
-            ((float*)m_tmpLutR)[i] = SanitizeFloat(lutValues[i*3+0] * outMax);
-            ((float*)m_tmpLutG)[i] = SanitizeFloat(lutValues[i*3+1] * outMax);
-            ((float*)m_tmpLutB)[i] = SanitizeFloat(lutValues[i*3+2] * outMax);
+            m_tmpLutR = new float[m_dim];
+            m_tmpLutG = new float[m_dim];
+            m_tmpLutB = new float[m_dim];
+
+            for(unsigned long i=0; i<m_dim; ++i)
+            {
+                ((float*)m_tmpLutR)[i] = SanitizeFloat(lutValues[i*3+0] * outMax);
+                ((float*)m_tmpLutG)[i] = SanitizeFloat(lutValues[i*3+1] * outMax);
+                ((float*)m_tmpLutB)[i] = SanitizeFloat(lutValues[i*3+2] * outMax);
+            }
         }
     }
 
@@ -439,9 +724,20 @@ template<BitDepth inBD, BitDepth outBD>
 template<typename T>
 void BaseLut1DRenderer<inBD, outBD>::resetData()
 {
-    delete [](T*)m_tmpLutR; m_tmpLutR = nullptr;
-    delete [](T*)m_tmpLutG; m_tmpLutG = nullptr;
-    delete [](T*)m_tmpLutB; m_tmpLutB = nullptr;
+    // The three pointers are identical when the curves are identical.
+    if (m_tmpLutB != m_tmpLutR && m_tmpLutB != m_tmpLutG)
+    {
+        delete [](T*)m_tmpLutB;
+    }
+    if (m_tmpLutG != m_tmpLutR)
+    {
+        delete [](T*)m_tmpLutG;
+    }
+    delete [](T*)m_tmpLutR;
+
+    m_tmpLutR = nullptr;
+    m_tmpLutG = nullptr;
+    m_tmpLutB = nullptr;
 }
 
 template<BitDepth inBD, BitDepth outBD>
@@ -450,6 +746,43 @@ BaseLut1DRenderer<inBD, outBD>::~BaseLut1DRenderer()
     reset();
 }
 
+template<BitDepth inBD, BitDepth outBD>
+void Lut1DRendererHalfCode<inBD, outBD>::compact()
+{
+    // The lookups do not interpolate.
+    if (this->isLookup() || this->m_dim != 65536)
+    {
+        return;
+    }
+
+    const float minValue = COMPACT_LUT_MIN_VALUE * (float)GetBitDepthMaxValue(outBD);
+
+    HalfSegmentedLutRcPtr segmented[3];
+    const void * luts[3] = { this->m_tmpLutR, this->m_tmpLutG, this->m_tmpLutB };
+
+    for (int c = 0; c < 3; ++c)
+    {
+        // Identical curves share the same LUT.
+        if (c > 0 && luts[c] == luts[c - 1])
+        {
+            segmented[c] = segmented[c - 1];
+            continue;
+        }
+
+        segmented[c] = std::make_shared<HalfSegmentedLut>();
+        if (!segmented[c]->build((const float *)luts[c], minValue))
+        {
+            return;
+        }
+    }
+
+    m_segmentedR = segmented[0];
+    m_segmentedG = segmented[1];
+    m_segmentedB = segmented[2];
+
+    this->reset();
+}
+
 template<BitDepth inBD, BitDepth outBD>
 void Lut1DRendererHalfCode<inBD, outBD>::apply(const void * inImg, void * outImg, long numPixels) const
 {
@@ -480,6 +813,23 @@ void Lut1DRendererHalfCode<inBD, outBD>::apply(const void * inImg, void * outImg
             out += 4;
         }
     }
+    else if (m_segmentedR)
+    {
+        const HalfSegmentedLut & lutR = *m_segmentedR;
+        const HalfSegmentedLut & lutG = *m_segmentedG;
+        const HalfSegmentedLut & lutB = *m_segmentedB;
+
+        for(long idx=0; idx<numPixels; ++idx)
+        {
+            out[0] = Converter<outBD>::CastValue(lutR.evaluate(in[0]));
+            out[1] = Converter<outBD>::CastValue(lutG.evaluate(in[1]));
+            out[2] = Converter<outBD>::CastValue(lutB.evaluate(in[2]));
+            out[3] = Converter<outBD>::CastValue(in[3] * this->m_alphaScaling);
+
+            in  += 4;
+            out += 4;
+        }
+    }
     else  // Need to interpolate rather than simply lookup.
     {
         const float * lutR = (const float *)this->m_tmpLutR;
@@ -973,13 +1323,69 @@ void Lut1DRendererHueAdjust<inBD, outBD>::apply(const void * inImg, void * outIm
 
 namespace
 {
-// TODO: Use SSE intrinsics to speed this up.
+
+// Segments smaller than this are searched directly.
+static constexpr long MinIndexedLength = 64;
+// Upper bound of the number of buckets of a search index.
+static constexpr long MaxIndexBuckets = 4096;
+
+}
+
+void InvLutSearchIndex::reset()
+{
+    m_bucketStart.clear();
+    m_minValue = 0.f;
+    m_invBucketWidth = 0.f;
+    m_numBuckets = 0;
+}
+
+void InvLutSearchIndex::build(const float * start, const float * end)
+{
+    reset();
+
+    const long length = (long)(end - start);
+
+    const float minValue = *start;
+    const float maxValue = *end;
+    const float range    = maxValue - minValue;
+
+    // Note: Also rejects NaN & infinite values.
+    if (length < MinIndexedLength || !(range > 0.f) || !std::isfinite(range))
+    {
+        return;
+    }
+
+    const long numBuckets = std::min(length, MaxIndexBuckets);
+    const float width = range / (float)numBuckets;
+    const float invWidth = 1.f / width;
+    if (!std::isfinite(invWidth))
+    {
+        return;
+    }
+
+    m_bucketStart.resize(numBuckets + 1);
+    m_bucketStart[0] = 0;
+    for (long b = 1; b < numBuckets; ++b)
+    {
+        const float edge = minValue + (float)b * width;
+        m_bucketStart[b] = (long)(std::lower_bound(start + m_bucketStart[b-1], end, edge) - start);
+    }
+    m_bucketStart[numBuckets] = length;
+
+    m_minValue = minValue;
+    m_invBucketWidth = invWidth;
+    m_numBuckets = numBuckets;
+}
+
+namespace
+{
 
 // Calculate the inverse of a value resulting from linear interpolation
 // in a 1d LUT.
 // start:       Pointer to the first effective LUT entry (end of flat spot).
 // startOffset: Distance between first LUT entry and start.
 // end:         Pointer to the last effective LUT entry (start of flat spot).
+// index:       Search index built for [start, end].
 // flipSign:    Flips val if we're working with the negative of the orig LUT.
 // scale:       From LUT index units to outDepth units.
 // val:         The value to invert.
@@ -988,6 +1394,7 @@ namespace
 float FindLutInv(const float * start,
                  const float   startOffset,
                  const float * end,
+                 const InvLutSearchIndex & index,
                  const float   flipSign,
                  const float   scale,
                  const float   val)
@@ -1005,7 +1412,8 @@ float FindLutInv(const float * start,
     // (NB: This is correct using either end or end+1 since lower_bound will return a
     //  value one greater than the second argument if no values in the array are >= cv.)
     // http://www.sgi.com/tech/stl/lower_bound.html
-    const float* lowbound = std::lower_bound(start, end, cv);
+    // (NB: The index only narrows the range to search, the result is identical.)
+    const float* lowbound = index.lowerBound(start, end, cv);
 
     // lower_bound() returns first entry >= val so decrement it unless val == *start.
     if (lowbound > start) {
@@ -1042,6 +1450,7 @@ float FindLutInv(const float * start,
 // start:       Pointer to the first effective LUT entry (end of flat spot).
 // startOffset: Distance between first LUT entry and start.
 // end:         Pointer to the last effective LUT entry (start of flat spot).
+// index:       Search index built for [start, end].
 // flipSign:    Flips val if we're working with the negative of the orig LUT.
 // scale:       From LUT index units to outDepth units.
 // val:         The value to invert.
@@ -1050,6 +1459,7 @@ float FindLutInv(const float * start,
 float FindLutInvHalf(const float * start,
                      const float   startOffset,
                      const float * end,
+                     const InvLutSearchIndex & index,
                      const float   flipSign,
                      const float   scale,
                      const float   val)
@@ -1061,7 +1471,7 @@ float FindLutInvHalf(const float * start,
     // Clamp the value to the range of the LUT.
     const float cv = std::min( std::max( val * flipSign, *start ), *end );
 
-    const float* lowbound = std::lower_bound(start, end, cv);
+    const float* lowbound = index.lowerBound(start, end, cv);
 
     // lower_bound() returns first entry >= val so decrement it unless val == *start.
     if (lowbound > start) {
@@ -1134,6 +1544,20 @@ void ComponentParams::setComponentParams(ComponentParams & params,
     params.negLutEnd   = lutPtr + properties.negEndDomain;
 }
 
+void ComponentParams::buildSearchIndexes(ComponentParams & params, bool halfDomain)
+{
+    params.index.build(params.lutStart, params.lutEnd);
+
+    if (halfDomain)
+    {
+        params.negIndex.build(params.negLutStart, params.negLutEnd);
+    }
+    else
+    {
+        params.negIndex.reset();
+    }
+}
+
 template<BitDepth inBD, BitDepth outBD>
 void InvLut1DRenderer<inBD, outBD>::resetData()
 {
@@ -1203,6 +1627,17 @@ void InvLut1DRenderer<inBD, outBD>::updateData(ConstLut1DOpDataRcPtr & lut)
         }
     }
 
+    ComponentParams::buildSearchIndexes(this->m_paramsR, false);
+    if( hasSingleLut )
+    {
+        this->m_paramsB = this->m_paramsG = this->m_paramsR;
+    }
+    else
+    {
+        ComponentParams::buildSearchIndexes(this->m_paramsG, false);
+        ComponentParams::buildSearchIndexes(this->m_paramsB, false);
+    }
+
     const float outMax = (float)GetBitDepthMaxValue(outBD);
 
     m_alphaScaling = outMax / (float)GetBitDepthMaxValue(inBD);
@@ -1228,6 +1663,7 @@ void InvLut1DRenderer<inBD, outBD>::apply(const void * inImg, void * outImg, lon
                     FindLutInv(this->m_paramsR.lutStart,
                                this->m_paramsR.startOffset,
                                this->m_paramsR.lutEnd,
+                               this->m_paramsR.index,
                                this->m_paramsR.flipSign,
                                m_scale,
                                (float)in[0]));
@@ -1237,6 +1673,7 @@ void InvLut1DRenderer<inBD, outBD>::apply(const void * inImg, void * outImg, lon
                     FindLutInv(this->m_paramsG.lutStart,
                                this->m_paramsG.startOffset,
                                this->m_paramsG.lutEnd,
+                               this->m_paramsG.index,
                                this->m_paramsG.flipSign,
                                m_scale,
                                (float)in[1]));
@@ -1246,6 +1683,7 @@ void InvLut1DRenderer<inBD, outBD>::apply(const void * inImg, void * outImg, lon
                     FindLutInv(this->m_paramsB.lutStart,
                                this->m_paramsB.startOffset,
                                this->m_paramsB.lutEnd,
+                               this->m_paramsB.index,
                                this->m_paramsB.flipSign,
                                m_scale,
                                (float)in[2]));
@@ -1291,6 +1729,7 @@ void InvLut1DRendererHueAdjust<inBD, outBD>::apply(const void * inImg, void * ou
             FindLutInv(this->m_paramsR.lutStart,
                        this->m_paramsR.startOffset,
                        this->m_paramsR.lutEnd,
+                       this->m_paramsR.index,
                        this->m_paramsR.flipSign,
                        this->m_scale,
                        RGB[0]),
@@ -1298,6 +1737,7 @@ void InvLut1DRendererHueAdjust<inBD, outBD>::apply(const void * inImg, void * ou
             FindLutInv(this->m_paramsG.lutStart,
                        this->m_paramsG.startOffset,
                        this->m_paramsG.lutEnd,
+                       this->m_paramsG.index,
                        this->m_paramsG.flipSign,
                        this->m_scale,
                        RGB[1]),
@@ -1305,6 +1745,7 @@ void InvLut1DRendererHueAdjust<inBD, outBD>::apply(const void * inImg, void * ou
             FindLutInv(this->m_paramsB.lutStart,
                        this->m_paramsB.startOffset,
                        this->m_paramsB.lutEnd,
+                       this->m_paramsB.index,
                        this->m_paramsB.flipSign,
                        this->m_scale,
                        RGB[2])
@@ -1413,6 +1854,17 @@ void InvLut1DRendererHalfCode<inBD, outBD>::updateData(ConstLut1DOpDataRcPtr & l
         }
     }
 
+    ComponentParams::buildSearchIndexes(this->m_paramsR, true);
+    if( hasSingleLut )
+    {
+        this->m_paramsB = this->m_paramsG = this->m_paramsR;
+    }
+    else
+    {
+        ComponentParams::buildSearchIndexes(this->m_paramsG, true);
+        ComponentParams::buildSearchIndexes(this->m_paramsB, true);
+    }
+
     const float outMax = (float)GetBitDepthMaxValue(outBD);
 
     this->m_alphaScaling = outMax / (float)GetBitDepthMaxValue(inBD);
@@ -1453,12 +1905,14 @@ void InvLut1DRendererHalfCode<inBD, outBD>::apply(const void * inImg, void * out
                 ? FindLutInvHalf(this->m_paramsR.lutStart,
                                  this->m_paramsR.startOffset,
                                  this->m_paramsR.lutEnd,
+                                 this->m_paramsR.index,
                                  this->m_paramsR.flipSign,
                                  this->m_scale,
                                  redIn) 
                 : FindLutInvHalf(this->m_paramsR.negLutStart,
                                  this->m_paramsR.negStartOffset,
                                  this->m_paramsR.negLutEnd,
+                                 this->m_paramsR.negIndex,
                                  -this->m_paramsR.flipSign,
                                  this->m_scale,
                                  redIn);
@@ -1469,12 +1923,14 @@ void InvLut1DRendererHalfCode<inBD, outBD>::apply(const void * inImg, void * out
                 ? FindLutInvHalf(this->m_paramsG.lutStart,
                                  this->m_paramsG.startOffset,
                                  this->m_paramsG.lutEnd,
+                                 this->m_paramsG.index,
                                  this->m_paramsG.flipSign,
                                  this->m_scale,
                                  grnIn) 
                 : FindLutInvHalf(this->m_paramsG.negLutStart,
                                  this->m_paramsG.negStartOffset,
                                  this->m_paramsG.negLutEnd,
+                                 this->m_paramsG.negIndex,
                                  -this->m_paramsG.flipSign,
                                  this->m_scale,
                                  grnIn);
@@ -1485,12 +1941,14 @@ void InvLut1DRendererHalfCode<inBD, outBD>::apply(const void * inImg, void * out
                 ? FindLutInvHalf(this->m_paramsB.lutStart,
                                  this->m_paramsB.startOffset,
                                  this->m_paramsB.lutEnd,
+                                 this->m_paramsB.index,
                                  this->m_paramsB.flipSign,
                                  this->m_scale,
                                  bluIn)
                 : FindLutInvHalf(this->m_paramsB.negLutStart,
                                  this->m_paramsB.negStartOffset,
                                  this->m_paramsB.negLutEnd,
+                                 this->m_paramsB.negIndex,
                                  -this->m_paramsR.flipSign,
                                  this->m_scale,
                                  bluIn);
@@ -1542,12 +2000,14 @@ void InvLut1DRendererHalfCodeHueAdjust<inBD, outBD>::apply(const void * inImg, v
                 ? FindLutInvHalf(this->m_paramsR.lutStart,
                                  this->m_paramsR.startOffset,
                                  this->m_paramsR.lutEnd,
+                                 this->m_paramsR.index,
                                  this->m_paramsR.flipSign,
                                  this->m_scale,
                                  RGB[0])
                 : FindLutInvHalf(this->m_paramsR.negLutStart,
                                  this->m_paramsR.negStartOffset,
                                  this->m_paramsR.negLutEnd,
+                                 this->m_paramsR.negIndex,
                                  -this->m_paramsR.flipSign,
                                  this->m_scale,
                                  RGB[0]);
@@ -1557,12 +2017,14 @@ void InvLut1DRendererHalfCodeHueAdjust<inBD, outBD>::apply(const void * inImg, v
                 ? FindLutInvHalf(this->m_paramsG.lutStart,
                                  this->m_paramsG.startOffset,
                                  this->m_paramsG.lutEnd,
+                                 this->m_paramsG.index,
                                  this->m_paramsG.flipSign,
                                  this->m_scale,
                                  RGB[1]) 
                 : FindLutInvHalf(this->m_paramsG.negLutStart,
                                  this->m_paramsG.negStartOffset,
                                  this->m_paramsG.negLutEnd,
+                                 this->m_paramsG.negIndex,
                                  -this->m_paramsG.flipSign,
                                  this->m_scale,
                                  RGB[1]);
@@ -1572,12 +2034,14 @@ void InvLut1DRendererHalfCodeHueAdjust<inBD, outBD>::apply(const void * inImg, v
                 ? FindLutInvHalf(this->m_paramsB.lutStart,
                                  this->m_paramsB.startOffset,
                                  this->m_paramsB.lutEnd,
+                                 this->m_paramsB.index,
                                  this->m_paramsB.flipSign,
                                  this->m_scale,
                                  RGB[2]) 
                 : FindLutInvHalf(this->m_paramsB.negLutStart,
                                  this->m_paramsB.negStartOffset,
                                  this->m_paramsB.negLutEnd,
+                                 this->m_paramsB.negIndex,
                                  -this->m_paramsR.flipSign,
                                  this->m_scale,
                                  RGB[2]);
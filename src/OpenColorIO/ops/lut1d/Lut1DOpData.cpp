@@ -9,7 +9,6 @@
 #include "BitDepthUtils.h"
 #include "HashUtils.h"
 #include "MathUtils.h"
-#include "md5/md5.h"
 #include "ops/lut1d/Lut1DOp.h"
 #include "ops/lut1d/Lut1DOpData.h"
 #include "ops/matrix/MatrixOp.h"
@@ -456,7 +455,8 @@ bool Lut1DOpData::operator==(const OpData & other) const
 
     // NB: The m_invQuality is not currently included.
     if (m_direction != lop->m_direction ||
-        getConcreteInterpolation() != lop->getConcreteInterpolation())
+        getConcreteInterpolation() != lop->getConcreteInterpolation() ||
+        m_approximationAllowed != lop->m_approximationAllowed)
     {
         return false;
     }
@@ -547,25 +547,24 @@ void Lut1DOpData::finalize()
 
     validate();
 
-    md5_state_t state;
-    md5_byte_t digest[16];
-
-    md5_init(&state);
-    md5_append(&state,
-        (const md5_byte_t *)&(getArray().getValues()[0]),
-        (int)(getArray().getValues().size() * sizeof(float)));
-    md5_finish(&state, digest);
+    // The hash also speeds up the comparison of the arrays.
+    getArray().updateContentHash();
+    InternArray(getArray());
 
     std::ostringstream cacheIDStream;
     if (!getID().empty())
     {
         cacheIDStream << getID() << " ";
     }
-    cacheIDStream << GetPrintableHash(digest)                                  << " ";
+    cacheIDStream << getArray().getContentHash()                               << " ";
     cacheIDStream << TransformDirectionToString(m_direction)                   << " ";
     cacheIDStream << InterpolationToString(m_interpolation)                    << " ";
     cacheIDStream << (isInputHalfDomain() ? "half domain" : "standard domain") << " ";
     cacheIDStream << GetHueAdjustName(m_hueAdjust);
+    if (m_approximationAllowed)
+    {
+        cacheIDStream << " approximation";
+    }
 
     // NB: The m_invQuality is not currently included.
 
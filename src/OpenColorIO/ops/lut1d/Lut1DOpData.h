@@ -109,6 +109,11 @@ public:
 
     void setInversionQuality(LutInversionQuality style);
 
+    // The CPU renderer may use a compact approximation of the LUT (i.e. the segmented form of
+    // a half domain LUT) only when allowed (refer to OPTIMIZATION_LUT1D_APPROX).
+    inline bool isApproximationAllowed() const { return m_approximationAllowed; }
+    inline void setApproximationAllowed(bool allowed) { m_approximationAllowed = allowed; }
+
     Type getType() const override { return Lut1DType; }
 
     bool isNoOp() const override;
@@ -267,6 +272,8 @@ private:
     // Members for inverse LUT.
     LutInversionQuality m_invQuality;
 
+    bool m_approximationAllowed = false;
+
     ComponentProperties m_componentProperties[3];
 
     // The LUT scaling for/from the file.
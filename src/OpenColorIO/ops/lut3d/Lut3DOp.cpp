@@ -286,6 +286,9 @@ void Lut3DOp::finalize(OptimizationFlags oFlags)
     const bool invLutFast = (oFlags & OPTIMIZATION_LUT_INV_FAST) == OPTIMIZATION_LUT_INV_FAST;
     lutData->setInversionQuality(invLutFast ? LUT_INVERSION_FAST: LUT_INVERSION_EXACT);
 
+    const bool approxLut3D = (oFlags & OPTIMIZATION_LUT3D_APPROX) == OPTIMIZATION_LUT3D_APPROX;
+    lutData->setApproximationTolerance(approxLut3D ? LUT3D_APPROXIMATION_TOLERANCE : 0.0f);
+
     lutData->finalize();
 
     std::ostringstream cacheIDStream;
@@ -3,6 +3,7 @@
 
 #include <algorithm>
 #include <math.h>
+#include <memory>
 #include <stdint.h>
 #include <vector>
 
@@ -185,6 +186,8 @@ private:
 };
 
 
+constexpr long LUT3D_ADAPTIVE_MIN_GRID_SIZE = 33;
+
 int GetLut3DIndexBlueFast(int indexR, int indexG, int indexB, long dim)
 {
     return 3 * (indexB + (int)dim * (indexG + (int)dim * indexR));
@@ -979,6 +982,376 @@ void Lut3DRenderer::apply(const void * inImg, void * outImg, long numPixels) con
 #endif
 }
 
+// Adaptive representation of a 3D LUT.  The lattice is split into blocks of 8x8x8 intervals
+// and each block only keeps the resolution (i.e. 1, 2, 4 or 8 intervals per side) needed to
+// reproduce all its lattice entries within the max error.  Large LUTs often spend most of
+// their entries in regions where the function is nearly linear so the adaptive form saves
+// memory and improves the cache residency.
+//
+// Note: The max error is only enforced on the lattice entries.  Between them, the difference
+// with the uniform LUT is not guaranteed to be below the max error (e.g. the error allowed at
+// the cell corners may exceed the one allowed at the point, and the indices are rounded
+// differently), for both the trilinear and the tetrahedral interpolations, so the unit tests
+// measure it on random inputs.
+class AdaptiveLut3D
+{
+public:
+    static constexpr unsigned BLOCK_SIZE = 8;
+
+    AdaptiveLut3D() = default;
+
+    // The LUT dimension must be a multiple of the block size (plus one).  Return false if the
+    // adaptive form would not be at least twice smaller than the uniform one.
+    bool build(const Array::Values & values,
+               unsigned long dim,
+               bool tetrahedral,
+               float maxError);
+
+    template<bool tetrahedral>
+    inline void evaluate(const float * in, float * out) const;
+
+    size_t getMemorySize() const
+    {
+        return m_values.size() * sizeof(float) + m_blocks.size() * sizeof(Block);
+    }
+
+private:
+    struct Block
+    {
+        unsigned offset = 0; // Offset of the block lattice (in floats).
+        unsigned res    = 0; // Number of intervals per side.
+        float    scale  = 1.0f;
+    };
+
+    static inline void Interpolate(const float * lut, unsigned dim, bool tetrahedral,
+                                   const float idx[3], float out[4]);
+
+    std::vector<Block> m_blocks;
+    // RGB & 0 for each entry of the block lattices.
+    std::vector<float> m_values;
+
+    unsigned m_numBlocks = 0;
+    float m_step = 0.0f;
+    float m_maxIdx = 0.0f;
+};
+
+// Interpolate the lattice of dimension dim (i.e. RGB & 0 entries where the blue changes
+// fastest) at the index position idx.  The 4 output values are RGB & 0.
+void AdaptiveLut3D::Interpolate(const float * lut, unsigned dim, bool tetrahedral,
+                                const float idx[3], float out[4])
+{
+    const unsigned maxLow = dim - 2;
+
+    unsigned low[3];
+    float delta[3];
+    for (int c = 0; c < 3; ++c)
+    {
+        low[c] = std::min((unsigned)idx[c], maxLow);
+        delta[c] = idx[c] - (float)low[c];
+    }
+
+    const unsigned strideR = dim * dim * 4;
+    const unsigned strideG = dim * 4;
+    const unsigned strideB = 4;
+
+    const float * v000 = lut + low[0] * strideR + low[1] * strideG + low[2] * strideB;
+
+    if (tetrahedral)
+    {
+        // Walk from the lowest to the highest corner along the axes ordered by their deltas.
+        // The order is looked up from { delta[0] >= delta[1], delta[1] >= delta[2],
+        // delta[2] >= delta[0] } to avoid unpredictable branches.
+        static const unsigned orders[8][3] = { { 2, 1, 0 }, { 0, 2, 1 }, { 1, 0, 2 }, { 0, 1, 2 },
+                                               { 2, 1, 0 }, { 2, 0, 1 }, { 1, 2, 0 }, { 0, 1, 2 } };
+        const unsigned * order = orders[  (unsigned)(delta[0] >= delta[1])
+                                        | (unsigned)(delta[1] >= delta[2]) << 1
+                                        | (unsigned)(delta[2] >= delta[0]) << 2];
+
+        const unsigned strides[3] = { strideR, strideG, strideB };
+
+        const float * v1 = v000 + strides[order[0]];
+        const float * v2 = v1 + strides[order[1]];
+        const float * v3 = v2 + strides[order[2]];
+
+#ifdef USE_SSE
+        const __m128 p0 = _mm_loadu_ps(v000);
+        const __m128 p1 = _mm_loadu_ps(v1);
+        const __m128 p2 = _mm_loadu_ps(v2);
+        const __m128 p3 = _mm_loadu_ps(v3);
+
+        const __m128 res
+            = _mm_add_ps(_mm_add_ps(p0, _mm_mul_ps(_mm_set1_ps(delta[order[0]]),
+                                                   _mm_sub_ps(p1, p0))),
+                         _mm_add_ps(_mm_mul_ps(_mm_set1_ps(delta[order[1]]), _mm_sub_ps(p2, p1)),
+                                    _mm_mul_ps(_mm_set1_ps(delta[order[2]]), _mm_sub_ps(p3, p2))));
+        _mm_storeu_ps(out, res);
+#else
+        for (int c = 0; c < 4; ++c)
+        {
+            out[c] = (v000[c] + delta[order[0]] * (v1[c] - v000[c]))
+                     + (delta[order[1]] * (v2[c] - v1[c]) + delta[order[2]] * (v3[c] - v2[c]));
+        }
+#endif
+    }
+    else
+    {
+#ifdef USE_SSE
+        const float * v = v000;
+
+        const __m128 dB = _mm_set1_ps(delta[2]);
+        const __m128 dG = _mm_set1_ps(delta[1]);
+        const __m128 dR = _mm_set1_ps(delta[0]);
+
+        // Same operations as lerpf(a, b, z) = (b - a) * z + a.
+        auto lerp = [](__m128 a, __m128 b, __m128 z)
+        {
+            return _mm_add_ps(_mm_mul_ps(_mm_sub_ps(b, a), z), a);
+        };
+
+        const __m128 b00 = lerp(_mm_loadu_ps(v),
+                                _mm_loadu_ps(v + strideB), dB);
+        const __m128 b01 = lerp(_mm_loadu_ps(v + strideG),
+                                _mm_loadu_ps(v + strideG + strideB), dB);
+        const __m128 b10 = lerp(_mm_loadu_ps(v + strideR),
+                                _mm_loadu_ps(v + strideR + strideB), dB);
+        const __m128 b11 = lerp(_mm_loadu_ps(v + strideR + strideG),
+                                _mm_loadu_ps(v + strideR + strideG + strideB), dB);
+
+        _mm_storeu_ps(out, lerp(lerp(b00, b01, dG), lerp(b10, b11, dG), dR));
+#else
+        for (int c = 0; c < 4; ++c)
+        {
+            const float * v = v000 + c;
+
+            const float b00 = lerpf(v[0],                 v[strideB],                     delta[2]);
+            const float b01 = lerpf(v[strideG],           v[strideG + strideB],           delta[2]);
+            const float b10 = lerpf(v[strideR],           v[strideR + strideB],           delta[2]);
+            const float b11 = lerpf(v[strideR + strideG], v[strideR + strideG + strideB], delta[2]);
+
+            out[c] = lerpf(lerpf(b00, b01, delta[1]), lerpf(b10, b11, delta[1]), delta[0]);
+        }
+#endif
+    }
+}
+
+bool AdaptiveLut3D::build(const Array::Values & values,
+                          unsigned long dim,
+                          bool tetrahedral,
+                          float maxError)
+{
+    if (dim < 2 || (dim - 1) % BLOCK_SIZE != 0)
+    {
+        return false;
+    }
+
+    m_numBlocks = (unsigned)(dim - 1) / BLOCK_SIZE;
+    m_step      = (float)dim - 1.0f;
+    m_maxIdx    = (float)dim - 1.0f;
+
+    m_blocks.resize(m_numBlocks * m_numBlocks * m_numBlocks);
+    m_values.clear();
+
+    const size_t uniformSize = dim * dim * dim * 4 * sizeof(float);
+
+    auto getValue = [&values, dim](unsigned r, unsigned g, unsigned b, unsigned c) -> float
+    {
+        return SanitizeFloat(values[((r * dim + g) * dim + b) * 3 + c]);
+    };
+
+    constexpr unsigned blockDim = BLOCK_SIZE + 1;
+
+    std::vector<float> coarse;
+
+    for (unsigned br = 0; br < m_numBlocks; ++br)
+    {
+        for (unsigned bg = 0; bg < m_numBlocks; ++bg)
+        {
+            for (unsigned bb = 0; bb < m_numBlocks; ++bb)
+            {
+                const unsigned r0 = br * BLOCK_SIZE;
+                const unsigned g0 = bg * BLOCK_SIZE;
+                const unsigned b0 = bb * BLOCK_SIZE;
+
+                // Use the coarsest resolution reproducing all the block entries.
+                unsigned res = 1;
+                for (; res < BLOCK_SIZE; res *= 2)
+                {
+                    const unsigned stride = BLOCK_SIZE / res;
+                    const unsigned coarseDim = res + 1;
+
+                    coarse.resize(coarseDim * coarseDim * coarseDim * 4);
+                    float * entry = coarse.data();
+                    for (unsigned r = 0; r < coarseDim; ++r)
+                    {
+                        for (unsigned g = 0; g < coarseDim; ++g)
+                        {
+                            for (unsigned b = 0; b < coarseDim; ++b)
+                            {
+                                for (unsigned c = 0; c < 3; ++c)
+                                {
+                                    entry[c] = getValue(r0 + r * stride,
+                                                        g0 + g * stride,
+                                                        b0 + b * stride, c);
+                                }
+                                entry[3] = 0.0f;
+                                entry += 4;
+                            }
+                        }
+                    }
+
+                    const float invStride = 1.0f / (float)stride;
+
+                    bool accurate = true;
+                    for (unsigned r = 0; r < blockDim && accurate; ++r)
+                    {
+                        for (unsigned g = 0; g < blockDim && accurate; ++g)
+                        {
+                            for (unsigned b = 0; b < blockDim && accurate; ++b)
+                            {
+                                const float idx[3] = { r * invStride, g * invStride, b * invStride };
+
+                                float approx[4];
+                                Interpolate(coarse.data(), coarseDim, tetrahedral, idx, approx);
+
+                                for (unsigned c = 0; c < 3; ++c)
+                                {
+                                    const float exact = getValue(r0 + r, g0 + g, b0 + b, c);
+                                    // Note: Also fails when the interpolation overflows.
+                                    if (!(std::fabs(approx[c] - exact)
+                                              <= maxError * std::max(std::fabs(exact), 1.0f)))
+                                    {
+                                        accurate = false;
+                                    }
+                                }
+                            }
+                        }
+                    }
+
+                    if (accurate)
+                    {
+                        break;
+                    }
+                }
+
+                Block & block = m_blocks[(br * m_numBlocks + bg) * m_numBlocks + bb];
+                block.offset = (unsigned)m_values.size();
+                block.res    = res;
+                block.scale  = (float)res / (float)BLOCK_SIZE;
+
+                const unsigned stride = BLOCK_SIZE / res;
+                for (unsigned r = 0; r <= res; ++r)
+                {
+                    for (unsigned g = 0; g <= res; ++g)
+                    {
+                        for (unsigned b = 0; b <= res; ++b)
+                        {
+                            for (unsigned c = 0; c < 3; ++c)
+                            {
+                                m_values.push_back(getValue(r0 + r * stride,
+                                                            g0 + g * stride,
+                                                            b0 + b * stride, c));
+                            }
+                            m_values.push_back(0.0f);
+                        }
+                    }
+                }
+
+                if (getMemorySize() * 2 > uniformSize)
+                {
+                    m_blocks.clear();
+                    m_values.clear();
+                    return false;
+                }
+            }
+        }
+    }
+
+    m_values.shrink_to_fit();
+
+    return true;
+}
+
+template<bool tetrahedral>
+void AdaptiveLut3D::evaluate(const float * in, float * out) const
+{
+#ifdef USE_SSE
+    OCIO_ALIGN(float idx[4]);
+    OCIO_ALIGN(int blockIdx[4]);
+
+    __m128 data = _mm_set_ps(0.0f, in[2], in[1], in[0]);
+
+    __m128 index = _mm_mul_ps(data, _mm_set1_ps(m_step));
+    index = _mm_max_ps(index, EZERO);  // NaNs become 0
+    index = _mm_min_ps(index, _mm_set1_ps(m_maxIdx));
+
+    // blocks = min(floor(index) / BLOCK_SIZE, numBlocks - 1) as the last block also includes
+    // the last lattice entry.
+    static_assert(BLOCK_SIZE == 8, "The block index computation expects 8x8x8 blocks.");
+    __m128i blocks = _mm_srli_epi32(_mm_cvttps_epi32(index), 3);
+    __m128i lastBlock = _mm_set1_epi32((int)m_numBlocks - 1);
+    blocks = _mm_sub_epi32(blocks, _mm_and_si128(_mm_cmpgt_epi32(blocks, lastBlock),
+                                                 _mm_set1_epi32(1)));
+
+    index = _mm_sub_ps(index, _mm_mul_ps(_mm_cvtepi32_ps(blocks), _mm_set1_ps((float)BLOCK_SIZE)));
+
+    _mm_store_si128((__m128i *)blockIdx, blocks);
+    _mm_store_ps(idx, index);
+#else
+    float idx[3];
+    unsigned blockIdx[3];
+    for (int c = 0; c < 3; ++c)
+    {
+        // NaNs become 0.
+        idx[c] = Clamp(in[c] * m_step, 0.0f, m_maxIdx);
+        blockIdx[c] = std::min((unsigned)idx[c] / BLOCK_SIZE, m_numBlocks - 1);
+        idx[c] -= (float)(blockIdx[c] * BLOCK_SIZE);
+    }
+#endif
+
+    const Block & block
+        = m_blocks[(blockIdx[0] * m_numBlocks + blockIdx[1]) * m_numBlocks + blockIdx[2]];
+
+    for (int c = 0; c < 3; ++c)
+    {
+        idx[c] *= block.scale;
+    }
+
+    Interpolate(&m_values[block.offset], block.res + 1, tetrahedral, idx, out);
+}
+
+template<bool tetrahedral>
+class Lut3DAdaptiveRenderer : public OpCPU
+{
+public:
+    explicit Lut3DAdaptiveRenderer(std::unique_ptr<AdaptiveLut3D> & lut)
+        : OpCPU()
+        , m_lut(std::move(lut))
+    {
+    }
+
+    void apply(const void * inImg, void * outImg, long numPixels) const override
+    {
+        const float * in = (const float *)inImg;
+        float * out = (float *)outImg;
+
+        for (long i = 0; i < numPixels; ++i)
+        {
+            const float newAlpha = in[3];
+
+            m_lut->evaluate<tetrahedral>(in, out);
+            out[3] = newAlpha;
+
+            in  += 4;
+            out += 4;
+        }
+    }
+
+    size_t getMemorySize() const { return m_lut->getMemorySize(); }
+
+private:
+    std::unique_ptr<AdaptiveLut3D> m_lut;
+};
+
 // The inversion code is based on an algorithm in "Numerical Linear Algebra
 // and Optimization, vol. 1," by Gill, Murray, and Wright.
 
@@ -1897,6 +2270,28 @@ void InvLut3DRenderer::apply(const void * inImg, void * outImg, long numPixels)
 ConstOpCPURcPtr GetForwardLut3DRenderer(ConstLut3DOpDataRcPtr & lut)
 {
     const Interpolation interp = lut->getConcreteInterpolation();
+    const float tolerance = lut->getApproximationTolerance();
+
+    // Only the large LUTs benefit from the adaptive form.
+    if (tolerance > 0.0f && lut->getGridSize() >= LUT3D_ADAPTIVE_MIN_GRID_SIZE)
+    {
+        std::unique_ptr<AdaptiveLut3D> adaptiveLut(new AdaptiveLut3D);
+        if (adaptiveLut->build(lut->getArray().getValues(),
+                               lut->getGridSize(),
+                               interp == INTERP_TETRAHEDRAL,
+                               tolerance))
+        {
+            if (interp == INTERP_TETRAHEDRAL)
+            {
+                return std::make_shared<Lut3DAdaptiveRenderer<true>>(adaptiveLut);
+            }
+            else
+            {
+                return std::make_shared<Lut3DAdaptiveRenderer<false>>(adaptiveLut);
+            }
+        }
+    }
+
     if (interp == INTERP_TETRAHEDRAL)
     {
         return std::make_shared<Lut3DTetrahedralRenderer>(lut);
@@ -12,6 +12,10 @@
 namespace OCIO_NAMESPACE
 {
 
+// Tolerance of the adaptive form of the 3D LUTs for OPTIMIZATION_LUT3D_APPROX
+// (refer to Lut3DOpData::setApproximationTolerance).
+constexpr float LUT3D_APPROXIMATION_TOLERANCE = 1e-5f;
+
 ConstOpCPURcPtr GetLut3DRenderer(ConstLut3DOpDataRcPtr & lut);
 
 } // namespace OCIO_NAMESPACE
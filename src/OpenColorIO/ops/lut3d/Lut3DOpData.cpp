@@ -8,7 +8,6 @@
 #include "BitDepthUtils.h"
 #include "HashUtils.h"
 #include "MathUtils.h"
-#include "md5/md5.h"
 #include "ops/lut3d/Lut3DOp.h"
 #include "ops/lut3d/Lut3DOpData.h"
 #include "ops/OpTools.h"
@@ -416,7 +415,8 @@ bool Lut3DOpData::operator==(const OpData & other) const
 
     // NB: The m_invQuality is not currently included.
     if (m_direction != lop->m_direction
-        || m_interpolation != lop->m_interpolation)
+        || m_interpolation != lop->m_interpolation
+        || m_approximationTolerance != lop->m_approximationTolerance)
     {
         return false;
     }
@@ -460,14 +460,9 @@ void Lut3DOpData::finalize()
 
     validate();
 
-    md5_state_t state;
-    md5_byte_t digest[16];
-
-    md5_init(&state);
-    md5_append(&state,
-               (const md5_byte_t *)&(getArray().getValues()[0]),
-               (int)(getArray().getValues().size() * sizeof(float)));
-    md5_finish(&state, digest);
+    // The hash also speeds up the comparison of the arrays.
+    getArray().updateContentHash();
+    InternArray(getArray());
 
     std::ostringstream cacheIDStream;
     if (!getID().empty())
@@ -475,9 +470,13 @@ void Lut3DOpData::finalize()
         cacheIDStream << getID() << " ";
     }
 
-    cacheIDStream << GetPrintableHash(digest)                << " ";
+    cacheIDStream << getArray().getContentHash()             << " ";
     cacheIDStream << InterpolationToString(m_interpolation)  << " ";
     cacheIDStream << TransformDirectionToString(m_direction) << " ";
+    if (m_approximationTolerance > 0.0f)
+    {
+        cacheIDStream << "approximation " << m_approximationTolerance << " ";
+    }
 
     // NB: The m_invQuality is not currently included.
 
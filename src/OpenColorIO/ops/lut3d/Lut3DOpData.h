@@ -63,6 +63,12 @@ public:
 
     void setInversionQuality(LutInversionQuality style);
 
+    // The CPU renderer may use an adaptive approximation of the LUT whose max relative error
+    // (with an absolute floor of 1) on the LUT entries is below the tolerance.  The default
+    // null tolerance requires the exact LUT.
+    inline float getApproximationTolerance() const { return m_approximationTolerance; }
+    inline void setApproximationTolerance(float tolerance) { m_approximationTolerance = tolerance; }
+
     // Note: The Lut3DOpData Array stores the values in blue-fastest order.
     inline const Array & getArray() const { return m_array; }
     inline Array & getArray() { return m_array; }
@@ -143,6 +149,8 @@ private:
     TransformDirection  m_direction;
     LutInversionQuality m_invQuality;
 
+    float m_approximationTolerance = 0.0f;
+
     // Out bit-depth to be used for file I/O.
     BitDepth m_fileOutBitDepth = BIT_DEPTH_UNKNOWN;
 
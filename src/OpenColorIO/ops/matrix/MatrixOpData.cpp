@@ -813,20 +813,12 @@ void MatrixOpData::finalize()
         cacheIDStream << getID() << " ";
     }
 
-    md5_state_t state;
-    md5_byte_t digest[16];
-
     // TODO: array and offset do not require double precision in cache.
-    md5_init(&state);
-    md5_append(&state,
-        (const md5_byte_t *)&(getArray().getValues()[0]),
-        (int)(16 * sizeof(double)));
-    md5_append(&state,
-        (const md5_byte_t *)getOffsets().getValues(),
-        (int)(4 * sizeof(double)));
-    md5_finish(&state, digest);
-
-    cacheIDStream << GetPrintableHash(digest);
+    CacheIDHasher hasher;
+    hasher.append(getArray().getValues());
+    hasher.append(getOffsets().getValues(), 4 * sizeof(double));
+
+    cacheIDStream << hasher.getPrintableHash();
 
     m_cacheID = cacheIDStream.str();
 }
@@ -9,6 +9,7 @@
 #include "MathUtils.h"
 #include "ops/matrix/MatrixOpCPU.h"
 #include "ops/range/RangeOpCPU.h"
+#include "SSE.h"
 
 namespace OCIO_NAMESPACE
 {
@@ -29,6 +30,11 @@ private:
     RangeOpCPU() = delete;
 };
 
+#ifdef USE_SSE
+// Only the RGB channels are modified, the alpha channel is always preserved.
+static const __m128 RGB_MASK = _mm_castsi128_ps(_mm_setr_epi32(-1, -1, -1, 0));
+#endif
+
 class RangeScaleMinMaxRenderer : public RangeOpCPU
 {
 public:
@@ -61,6 +67,27 @@ public:
     virtual void apply(const void * inImg, void * outImg, long numPixels) const override;
 };
 
+// Renderer applying an op followed by a range. The pixels are processed by small blocks
+// so the range clamps the op results while they are still in the cache, instead of doing
+// another pass over the complete buffer.
+class RangeFusedRenderer : public OpCPU
+{
+public:
+    RangeFusedRenderer(ConstOpCPURcPtr & op, ConstRangeOpDataRcPtr & range);
+
+    virtual void apply(const void * inImg, void * outImg, long numPixels) const override;
+
+    bool hasDynamicProperty(DynamicPropertyType type) const override;
+    DynamicPropertyRcPtr getDynamicProperty(DynamicPropertyType type) const override;
+
+protected:
+    ConstOpCPURcPtr m_op;
+    ConstOpCPURcPtr m_range;
+
+private:
+    RangeFusedRenderer() = delete;
+};
+
 
 RangeOpCPU::RangeOpCPU(ConstRangeOpDataRcPtr & range)
     :   OpCPU()
@@ -85,6 +112,27 @@ void RangeScaleMinMaxRenderer::apply(const void * inImg, void * outImg, long num
     const float * in = (const float *)inImg;
     float * out = (float *)outImg;
 
+#ifdef USE_SSE
+    const __m128 scale      = _mm_set1_ps(m_scale);
+    const __m128 offset     = _mm_set1_ps(m_offset);
+    const __m128 lowerBound = _mm_set1_ps(m_lowerBound);
+    const __m128 upperBound = _mm_set1_ps(m_upperBound);
+
+    for(long idx=0; idx<numPixels; ++idx)
+    {
+        const __m128 pix = _mm_loadu_ps(in);
+
+        const __m128 t = _mm_add_ps(_mm_mul_ps(pix, scale), offset);
+
+        // NaNs become m_lowerBound.
+        const __m128 res = _mm_min_ps(_mm_max_ps(t, lowerBound), upperBound);
+
+        _mm_storeu_ps(out, sseSelect(RGB_MASK, res, pix));
+
+        in  += 4;
+        out += 4;
+    }
+#else
     for(long idx=0; idx<numPixels; ++idx)
     {
         const float t[3] = { in[0] * m_scale + m_offset,
@@ -100,6 +148,7 @@ void RangeScaleMinMaxRenderer::apply(const void * inImg, void * outImg, long num
         in  += 4;
         out += 4;
     }
+#endif
 }
 
 RangeMinMaxRenderer::RangeMinMaxRenderer(ConstRangeOpDataRcPtr & range)
@@ -112,6 +161,23 @@ void RangeMinMaxRenderer::apply(const void * inImg, void * outImg, long numPixel
     const float * in = (const float *)inImg;
     float * out = (float *)outImg;
 
+#ifdef USE_SSE
+    const __m128 lowerBound = _mm_set1_ps(m_lowerBound);
+    const __m128 upperBound = _mm_set1_ps(m_upperBound);
+
+    for(long idx=0; idx<numPixels; ++idx)
+    {
+        const __m128 pix = _mm_loadu_ps(in);
+
+        // NaNs become m_lowerBound.
+        const __m128 res = _mm_min_ps(_mm_max_ps(pix, lowerBound), upperBound);
+
+        _mm_storeu_ps(out, sseSelect(RGB_MASK, res, pix));
+
+        in  += 4;
+        out += 4;
+    }
+#else
     for(long idx=0; idx<numPixels; ++idx)
     {
         // NaNs become m_lowerBound.
@@ -123,6 +189,7 @@ void RangeMinMaxRenderer::apply(const void * inImg, void * outImg, long numPixel
         in  += 4;
         out += 4;
     }
+#endif
 }
 
 RangeMinRenderer::RangeMinRenderer(ConstRangeOpDataRcPtr & range)
@@ -135,6 +202,22 @@ void RangeMinRenderer::apply(const void * inImg, void * outImg, long numPixels)
     const float * in = (const float *)inImg;
     float * out = (float *)outImg;
 
+#ifdef USE_SSE
+    const __m128 lowerBound = _mm_set1_ps(m_lowerBound);
+
+    for(long idx=0; idx<numPixels; ++idx)
+    {
+        const __m128 pix = _mm_loadu_ps(in);
+
+        // NaNs become m_lowerBound.
+        const __m128 res = _mm_max_ps(pix, lowerBound);
+
+        _mm_storeu_ps(out, sseSelect(RGB_MASK, res, pix));
+
+        in  += 4;
+        out += 4;
+    }
+#else
     for(long idx=0; idx<numPixels; ++idx)
     {
         // NaNs become m_lowerBound.
@@ -146,6 +229,7 @@ void RangeMinRenderer::apply(const void * inImg, void * outImg, long numPixels)
         in  += 4;
         out += 4;
     }
+#endif
 }
 
 RangeMaxRenderer::RangeMaxRenderer(ConstRangeOpDataRcPtr & range)
@@ -158,6 +242,22 @@ void RangeMaxRenderer::apply(const void * inImg, void * outImg, long numPixels)
     const float * in = (const float *)inImg;
     float * out = (float *)outImg;
 
+#ifdef USE_SSE
+    const __m128 upperBound = _mm_set1_ps(m_upperBound);
+
+    for(long idx=0; idx<numPixels; ++idx)
+    {
+        const __m128 pix = _mm_loadu_ps(in);
+
+        // NaNs become m_upperBound.
+        const __m128 res = _mm_min_ps(pix, upperBound);
+
+        _mm_storeu_ps(out, sseSelect(RGB_MASK, res, pix));
+
+        in  += 4;
+        out += 4;
+    }
+#else
     for(long idx=0; idx<numPixels; ++idx)
     {
         // NaNs become m_upperBound.
@@ -169,6 +269,44 @@ void RangeMaxRenderer::apply(const void * inImg, void * outImg, long numPixels)
         in  += 4;
         out += 4;
     }
+#endif
+}
+
+RangeFusedRenderer::RangeFusedRenderer(ConstOpCPURcPtr & op, ConstRangeOpDataRcPtr & range)
+    :   OpCPU()
+    ,   m_op(op)
+    ,   m_range(GetRangeRenderer(range))
+{
+}
+
+void RangeFusedRenderer::apply(const void * inImg, void * outImg, long numPixels) const
+{
+    // 4 KB of RGBA float pixels.
+    constexpr long PixelsPerBlock = 256;
+
+    const float * in = (const float *)inImg;
+    float * out = (float *)outImg;
+
+    for(long idx=0; idx<numPixels; idx+=PixelsPerBlock)
+    {
+        const long num = std::min(PixelsPerBlock, numPixels - idx);
+
+        m_op->apply(in, out, num);
+        m_range->apply(out, out, num);
+
+        in  += 4 * num;
+        out += 4 * num;
+    }
+}
+
+bool RangeFusedRenderer::hasDynamicProperty(DynamicPropertyType type) const
+{
+    return m_op->hasDynamicProperty(type);
+}
+
+DynamicPropertyRcPtr RangeFusedRenderer::getDynamicProperty(DynamicPropertyType type) const
+{
+    return m_op->getDynamicProperty(type);
 }
 
 
@@ -192,5 +330,9 @@ ConstOpCPURcPtr GetRangeRenderer(ConstRangeOpDataRcPtr & range)
     return std::make_shared<RangeScaleMinMaxRenderer>(range);
 }
 
-} // namespace OCIO_NAMESPACE
+ConstOpCPURcPtr GetRangeFusedRenderer(ConstOpCPURcPtr & op, ConstRangeOpDataRcPtr & range)
+{
+    return std::make_shared<RangeFusedRenderer>(op, range);
+}
 
+} // namespace OCIO_NAMESPACE
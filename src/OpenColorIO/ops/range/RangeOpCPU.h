@@ -16,6 +16,10 @@ namespace OCIO_NAMESPACE
 
 ConstOpCPURcPtr GetRangeRenderer(ConstRangeOpDataRcPtr & range);
 
+// Renderer applying the op renderer followed by the range, without an extra pass
+// over the pixel buffer.
+ConstOpCPURcPtr GetRangeFusedRenderer(ConstOpCPURcPtr & op, ConstRangeOpDataRcPtr & range);
+
 } // namespace OCIO_NAMESPACE
 
 
@@ -15,6 +15,7 @@
 #include "ParseUtils.h"
 #include "Platform.h"
 #include "transforms/CDLTransform.h"
+#include "utils/StringUtils.h"
 
 
 namespace OCIO_NAMESPACE
@@ -197,6 +198,22 @@ void ClearCDLTransformFileCache()
     g_cacheSrcIsCC.clear();
 }
 
+void ClearCDLTransformFileCache(const std::string & src)
+{
+    AutoMutex lock(g_cacheMutex);
+
+    if (g_cacheSrcIsCC.erase(src) != 0)
+    {
+        // Remove all the keys built by GetCDLLocalCacheKey() for the file.
+        const std::string prefix = src + " : ";
+        auto iter = g_cache.lower_bound(prefix);
+        while (iter != g_cache.end() && StringUtils::StartsWith(iter->first, prefix))
+        {
+            iter = g_cache.erase(iter);
+        }
+    }
+}
+
 // TODO: Expose functions for introspecting in ccc file
 // TODO: Share caching with normal cdl pathway
 
@@ -24,6 +24,9 @@ typedef std::vector<CDLTransformRcPtr> CDLTransformVec;
 
 void ClearCDLTransformFileCache();
 
+// Only remove the CDLs of the file.
+void ClearCDLTransformFileCache(const std::string & src);
+
 void LoadCDL(CDLTransform * cdl, const char * xml);
 
 class CDLTransformImpl : public CDLTransform
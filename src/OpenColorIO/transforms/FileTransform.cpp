@@ -2,15 +2,22 @@
 // Copyright Contributors to the OpenColorIO Project.
 
 #include <algorithm>
+#include <atomic>
 #include <fstream>
+#include <functional>
+#include <list>
 #include <map>
 #include <sstream>
+#include <unordered_map>
 
 #include <OpenColorIO/OpenColorIO.h>
 
+#include "ConfigSnapshot.h"
 #include "FileTransform.h"
 #include "Logging.h"
 #include "Mutex.h"
+#include "ops/lut1d/Lut1DOpData.h"
+#include "ops/lut3d/Lut3DOpData.h"
 #include "ops/noop/NoOps.h"
 #include "PathUtils.h"
 #include "Platform.h"
@@ -655,61 +662,228 @@ struct FileCacheResult
 };
 
 typedef OCIO_SHARED_PTR<FileCacheResult> FileCacheResultPtr;
-typedef std::map<std::string, FileCacheResultPtr> FileCacheMap;
 
-FileCacheMap g_fileCache;
-Mutex g_fileCacheLock;
+struct FileCacheEntry
+{
+    FileCacheResultPtr m_result;
+    // Estimated memory, only known once the file is loaded.
+    size_t m_memory = 0;
+    // Position in the least recently used list.
+    std::list<std::string>::iterator m_lruPos;
+};
+
+typedef std::unordered_map<std::string, FileCacheEntry> FileCacheMap;
+
+// The cache is split in shards (selected by the file path hash) to limit the contention
+// between the threads using different files. Each shard has its own least recently used list
+// but the memory limit applies to all the shards.
+
+struct FileCacheShard
+{
+    Mutex m_mutex;
+    FileCacheMap m_entries;
+    // The most recently used file is at the front.
+    std::list<std::string> m_lru;
+    size_t m_memory = 0;
+};
+
+constexpr size_t NumFileCacheShards = 16;
+FileCacheShard g_fileCacheShards[NumFileCacheShards];
+
+// The memory of all the shards.
+std::atomic<size_t> g_fileCacheMemory{ 0 };
+
+std::atomic<size_t> g_fileCacheHits{ 0 };
+std::atomic<size_t> g_fileCacheMisses{ 0 };
+
+constexpr static const char * OCIO_FILE_CACHE_MAX_MEMORY_ENVVAR = "OCIO_FILE_CACHE_MAX_MEMORY";
+
+// The limit (in bytes) for all the shards, 1 GB by default.
+std::atomic<size_t> & FileCacheMaxMemory()
+{
+    static std::atomic<size_t> maxMemory{ []()
+    {
+        size_t maxMemoryMB = 1024;
+
+        std::string value;
+        Platform::Getenv(OCIO_FILE_CACHE_MAX_MEMORY_ENVVAR, value);
+        if (!value.empty())
+        {
+            std::istringstream is(value);
+            size_t envMaxMemoryMB = 0;
+            if (is >> envMaxMemoryMB)
+            {
+                maxMemoryMB = envMaxMemoryMB;
+            }
+            else
+            {
+                std::ostringstream os;
+                os << "Invalid value '" << value << "' for the env. variable "
+                   << OCIO_FILE_CACHE_MAX_MEMORY_ENVVAR << ". Using the default value.";
+                LogWarning(os.str());
+            }
+        }
+
+        return maxMemoryMB * 1024 * 1024;
+    }() };
+
+    return maxMemory;
+}
+
+size_t GetFileCacheShardIndex(const std::string & filepath)
+{
+    return std::hash<std::string>()(filepath) % NumFileCacheShards;
+}
+
+// You must manually acquire the shard mutex before calling this.
+void EraseFile(FileCacheShard & shard, FileCacheMap::iterator iter)
+{
+    shard.m_memory -= iter->second.m_memory;
+    g_fileCacheMemory -= iter->second.m_memory;
+    shard.m_lru.erase(iter->second.m_lruPos);
+    shard.m_entries.erase(iter);
+}
+
+// Evict the least recently used files of the shard, except the kept one, until all the shards
+// fit in the memory limit.
+// You must manually acquire the shard mutex before calling this.
+void EvictShardFiles(FileCacheShard & shard, const std::string & keptFilepath)
+{
+    const size_t maxMemory = FileCacheMaxMemory();
+
+    auto lruIter = shard.m_lru.end();
+    while (g_fileCacheMemory > maxMemory && lruIter != shard.m_lru.begin())
+    {
+        --lruIter;
+        if (*lruIter != keptFilepath)
+        {
+            const auto nextIter = std::next(lruIter);
+            EraseFile(shard, shard.m_entries.find(*lruIter));
+            lruIter = nextIter;
+        }
+    }
+}
+
+// Evict the least recently used files, starting with the given shard, until all the shards fit
+// in the memory limit.  The kept file (i.e. the one being inserted) is never evicted.
+// Note: The shards are locked one at a time.
+void EvictFiles(size_t firstShardIndex, const std::string & keptFilepath)
+{
+    for (size_t idx = 0;
+         idx < NumFileCacheShards && g_fileCacheMemory > FileCacheMaxMemory(); ++idx)
+    {
+        FileCacheShard & shard = g_fileCacheShards[(firstShardIndex + idx) % NumFileCacheShards];
+
+        AutoMutex lock(shard.m_mutex);
+        EvictShardFiles(shard, keptFilepath);
+    }
+}
 
 } // namespace
 
+size_t GetLutMemorySize(const ConstOpDataRcPtr & lut)
+{
+    if (!lut)
+    {
+        return 0;
+    }
+    else if (lut->getType() == OpData::Lut1DType)
+    {
+        auto lut1D = OCIO_DYNAMIC_POINTER_CAST<const Lut1DOpData>(lut);
+        return lut1D->getArray().getNumValues() * sizeof(float);
+    }
+    else if (lut->getType() == OpData::Lut3DType)
+    {
+        auto lut3D = OCIO_DYNAMIC_POINTER_CAST<const Lut3DOpData>(lut);
+        return lut3D->getArray().getNumValues() * sizeof(float);
+    }
+
+    return 0;
+}
+
 void GetCachedFileAndFormat(FileFormat * & format,
                             CachedFileRcPtr & cachedFile,
                             const std::string & filepath)
 {
+    const size_t shardIndex = GetFileCacheShardIndex(filepath);
+    FileCacheShard & shard = g_fileCacheShards[shardIndex];
+
     // Load the file cache ptr from the global map
     FileCacheResultPtr result;
     {
-        AutoMutex lock(g_fileCacheLock);
-        FileCacheMap::iterator iter = g_fileCache.find(filepath);
-        if (iter != g_fileCache.end())
+        AutoMutex lock(shard.m_mutex);
+        FileCacheMap::iterator iter = shard.m_entries.find(filepath);
+        if (iter != shard.m_entries.end())
         {
-            result = iter->second;
+            result = iter->second.m_result;
+            shard.m_lru.splice(shard.m_lru.begin(), shard.m_lru, iter->second.m_lruPos);
+            ++g_fileCacheHits;
         }
         else
         {
             result = FileCacheResultPtr(new FileCacheResult);
-            g_fileCache[filepath] = result;
+            FileCacheEntry & entry = shard.m_entries[filepath];
+            entry.m_result = result;
+            shard.m_lru.push_front(filepath);
+            entry.m_lruPos = shard.m_lru.begin();
+            ++g_fileCacheMisses;
         }
     }
 
     // If this file has already been loaded, return
     // the result immediately
 
-    AutoMutex lock(result->mutex);
-    if (!result->ready)
+    bool loaded = false;
     {
-        result->ready = true;
-        result->error = false;
-
-        try
-        {
-            LoadFileUncached(result->format,
-                result->cachedFile,
-                filepath);
-        }
-        catch (std::exception & e)
+        AutoMutex lock(result->mutex);
+        if (!result->ready)
         {
-            result->error = true;
-            result->exceptionText = e.what();
+            result->ready = true;
+            result->error = false;
+            loaded = true;
+
+            try
+            {
+                LoadFileUncached(result->format,
+                    result->cachedFile,
+                    filepath);
+            }
+            catch (std::exception & e)
+            {
+                result->error = true;
+                result->exceptionText = e.what();
+            }
+            catch (...)
+            {
+                result->error = true;
+                std::ostringstream os;
+                os << "An unknown error occurred in LoadFileUncached, ";
+                os << filepath;
+                result->exceptionText = os.str();
+            }
         }
-        catch (...)
+    }
+
+    if (loaded)
+    {
+        const size_t memory = sizeof(FileCacheResult) + 2 * filepath.size()
+                              + result->exceptionText.size()
+                              + (result->cachedFile ? result->cachedFile->getMemorySize() : 0);
+
         {
-            result->error = true;
-            std::ostringstream os;
-            os << "An unknown error occurred in LoadFileUncached, ";
-            os << filepath;
-            result->exceptionText = os.str();
+            AutoMutex lock(shard.m_mutex);
+
+            // The file may have been evicted meanwhile.
+            FileCacheMap::iterator iter = shard.m_entries.find(filepath);
+            if (iter != shard.m_entries.end() && iter->second.m_result == result)
+            {
+                iter->second.m_memory = memory;
+                shard.m_memory += memory;
+                g_fileCacheMemory += memory;
+            }
         }
+
+        EvictFiles(shardIndex, filepath);
     }
 
     if (result->error)
@@ -743,8 +917,54 @@ void GetCachedFileAndFormat(FileFormat * & format,
 
 void ClearFileTransformCaches()
 {
-    AutoMutex lock(g_fileCacheLock);
-    g_fileCache.clear();
+    for (auto & shard : g_fileCacheShards)
+    {
+        AutoMutex lock(shard.m_mutex);
+        shard.m_entries.clear();
+        shard.m_lru.clear();
+        g_fileCacheMemory -= shard.m_memory;
+        shard.m_memory = 0;
+    }
+
+    g_fileCacheHits = 0;
+    g_fileCacheMisses = 0;
+}
+
+void ClearFileTransformCaches(const std::string & filepath)
+{
+    FileCacheShard & shard = g_fileCacheShards[GetFileCacheShardIndex(filepath)];
+
+    AutoMutex lock(shard.m_mutex);
+    FileCacheMap::iterator iter = shard.m_entries.find(filepath);
+    if (iter != shard.m_entries.end())
+    {
+        EraseFile(shard, iter);
+    }
+}
+
+size_t SetFileCacheMaxMemory(size_t maxMemory)
+{
+    const size_t prevMaxMemory = FileCacheMaxMemory().exchange(maxMemory);
+
+    EvictFiles(0, std::string());
+
+    return prevMaxMemory;
+}
+
+void GetFileCacheStats(size_t & numFiles, size_t & memory, size_t & numHits, size_t & numMisses)
+{
+    numFiles = 0;
+    memory   = 0;
+
+    for (auto & shard : g_fileCacheShards)
+    {
+        AutoMutex lock(shard.m_mutex);
+        numFiles += shard.m_entries.size();
+        memory   += shard.m_memory;
+    }
+
+    numHits   = g_fileCacheHits;
+    numMisses = g_fileCacheMisses;
 }
 
 void BuildFileTransformOps(OpRcPtrVec & ops,
@@ -785,6 +1005,19 @@ void BuildFileTransformOps(OpRcPtrVec & ops,
         }
     }
 
+    // A loaded config snapshot or the LUT store may already hold the ops of the file.
+    OpRcPtrVec snapshotOps;
+    if (BuildConfigSnapshotFileOps(snapshotOps, filepath, context, fileTransform, dir))
+    {
+        CreateFileNoOp(ops, filepath);
+        ConstOpRcPtr fileNoOpConst = ops.back();
+        auto fileData = DynamicPtrCast<const FileNoOpData>(fileNoOpConst->data());
+        fileData->setComplete();
+
+        ops += snapshotOps;
+        return;
+    }
+
     FileFormat* format = NULL;
     CachedFileRcPtr cachedFile;
 
@@ -820,5 +1053,8 @@ void BuildFileTransformOps(OpRcPtrVec & ops,
         err << e.what();
         throw Exception(err.str().c_str());
     }
+
+    // Let the other processes reuse the ops instead of parsing the file again.
+    SaveLutStoreFileOps(config, context, fileTransform, filepath);
 }
 } // namespace OCIO_NAMESPACE
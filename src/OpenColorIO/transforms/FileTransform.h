@@ -21,13 +21,23 @@ namespace OCIO_NAMESPACE
 {
 void ClearFileTransformCaches();
 
+// Remove the file from the cache so that it is read again on next use.
+void ClearFileTransformCaches(const std::string & filepath);
+
 class CachedFile
 {
 public:
     CachedFile() {};
     virtual ~CachedFile() {};
+
+    // Estimate of the memory used by the file content (for the file cache memory limit).
+    // Only the formats holding large data such as LUTs need to override it.
+    virtual size_t getMemorySize() const { return 1024; }
 };
 
+// Memory used by the values of a LUT op data (zero for null or other op data).
+size_t GetLutMemorySize(const ConstOpDataRcPtr & lut);
+
 typedef OCIO_SHARED_PTR<CachedFile> CachedFileRcPtr;
 
 const int FORMAT_CAPABILITY_NONE = 0;
@@ -90,6 +100,12 @@ private:
     FileFormat& operator= (const FileFormat &);
 };
 
+// Return the format & the content of the file, reading it only when it is not in the file cache.
+// Note: Throws if the file cannot be read (the error is also cached).
+void GetCachedFileAndFormat(FileFormat * & format,
+                            CachedFileRcPtr & cachedFile,
+                            const std::string & filepath);
+
 typedef std::map<std::string, FileFormat*> FileFormatMap;
 typedef std::vector<FileFormat*> FileFormatVector;
 typedef std::map<std::string, FileFormatVector> FileFormatVectorMap;
@@ -1,7 +1,12 @@
 // SPDX-License-Identifier: BSD-3-Clause
 // Copyright Contributors to the OpenColorIO Project.
 
+#include <algorithm>
 #include <chrono>
+#include <cmath>
+#include <fstream>
+#include <sstream>
+#include <vector>
 
 #include <OpenColorIO/OpenColorIO.h>
 
@@ -247,33 +252,320 @@ void ProcessPixels(Measure & m, OCIO::ConstCPUProcessorRcPtr & cpuProcessor,
     m.pause();
 }
 
+// Build a transform whose op is representative of the op type to calibrate.
+OCIO::TransformRcPtr CreateCalibrationTransform(const std::string & opType, bool inverse)
+{
+    const OCIO::TransformDirection dir = inverse ? OCIO::TRANSFORM_DIR_INVERSE
+                                                 : OCIO::TRANSFORM_DIR_FORWARD;
+
+    if(opType=="CDL")
+    {
+        OCIO::CDLTransformRcPtr cdl = OCIO::CDLTransform::Create();
+        const double slope[3]  = { 1.10, 1.05, 0.95 };
+        const double offset[3] = { 0.01, -0.02, 0.03 };
+        const double power[3]  = { 1.20, 1.10, 0.90 };
+        cdl->setSlope(slope);
+        cdl->setOffset(offset);
+        cdl->setPower(power);
+        cdl->setSat(1.2);
+        cdl->setDirection(dir);
+        return cdl;
+    }
+    else if(opType=="Exponent" || opType=="Gamma")
+    {
+        OCIO::ExponentTransformRcPtr exp = OCIO::ExponentTransform::Create();
+        const double values[4] = { 2.2, 2.4, 2.6, 1.0 };
+        exp->setValue(values);
+        exp->setDirection(dir);
+        return exp;
+    }
+    else if(opType=="ExposureContrast")
+    {
+        OCIO::ExposureContrastTransformRcPtr ec = OCIO::ExposureContrastTransform::Create();
+        ec->setExposure(0.5);
+        ec->setContrast(1.2);
+        ec->setGamma(1.1);
+        ec->setDirection(dir);
+        return ec;
+    }
+    else if(opType=="FixedFunction")
+    {
+        OCIO::FixedFunctionTransformRcPtr ff = OCIO::FixedFunctionTransform::Create();
+        ff->setStyle(OCIO::FIXED_FUNCTION_ACES_RED_MOD_10);
+        ff->setDirection(dir);
+        return ff;
+    }
+    else if(opType=="Log")
+    {
+        OCIO::LogCameraTransformRcPtr log = OCIO::LogCameraTransform::Create();
+        const double linBreak[3] = { 0.01, 0.01, 0.01 };
+        log->setLinSideBreakValue(linBreak);
+        log->setDirection(dir);
+        return log;
+    }
+    else if(opType=="Lut1D" || opType=="Lut1DInverse")
+    {
+        const unsigned long length = 4096;
+        OCIO::Lut1DTransformRcPtr lut = OCIO::Lut1DTransform::Create(length, false);
+        for(unsigned long idx=0; idx<length; ++idx)
+        {
+            const float v = std::pow(float(idx) / float(length - 1), 1.0f / 2.2f);
+            lut->setValue(idx, v, v, v);
+        }
+        lut->setDirection(opType=="Lut1DInverse" ? OCIO::TRANSFORM_DIR_INVERSE
+                                                 : OCIO::TRANSFORM_DIR_FORWARD);
+        return lut;
+    }
+    else if(opType=="Lut3D" || opType=="Lut3DInverse")
+    {
+        const unsigned long gridSize = opType=="Lut3DInverse" ? 17 : 33;
+        OCIO::Lut3DTransformRcPtr lut = OCIO::Lut3DTransform::Create(gridSize);
+        const float scale = 1.0f / float(gridSize - 1);
+        for(unsigned long r=0; r<gridSize; ++r)
+        {
+            for(unsigned long g=0; g<gridSize; ++g)
+            {
+                for(unsigned long b=0; b<gridSize; ++b)
+                {
+                    const float R = r * scale, G = g * scale, B = b * scale;
+                    lut->setValue(r, g, b,
+                                  std::pow(0.80f * R + 0.15f * G + 0.05f * B, 0.8f),
+                                  std::pow(0.10f * R + 0.80f * G + 0.10f * B, 0.8f),
+                                  std::pow(0.05f * R + 0.15f * G + 0.80f * B, 0.8f));
+                }
+            }
+        }
+        lut->setInterpolation(OCIO::INTERP_TETRAHEDRAL);
+        lut->setDirection(opType=="Lut3DInverse" ? OCIO::TRANSFORM_DIR_INVERSE
+                                                 : OCIO::TRANSFORM_DIR_FORWARD);
+        return lut;
+    }
+    else if(opType=="Matrix")
+    {
+        OCIO::MatrixTransformRcPtr mat = OCIO::MatrixTransform::Create();
+        const double m44[16] = { 0.80, 0.15, 0.05, 0.0,
+                                 0.10, 0.80, 0.10, 0.0,
+                                 0.05, 0.15, 0.80, 0.0,
+                                 0.00, 0.00, 0.00, 1.0 };
+        const double offset4[4] = { 0.01, 0.02, 0.03, 0.0 };
+        mat->setMatrix(m44);
+        mat->setOffset(offset4);
+        mat->setDirection(dir);
+        return mat;
+    }
+    else if(opType=="Range")
+    {
+        OCIO::RangeTransformRcPtr range = OCIO::RangeTransform::Create();
+        range->setMinInValue(0.0);
+        range->setMinOutValue(0.0);
+        range->setMaxInValue(1.0);
+        range->setMaxOutValue(1.0);
+        return range;
+    }
+
+    throw OCIO::Exception("Unsupported op type for the calibration.");
+}
+
+// Measure the processing time (in ms) of a 1024x1024 RGBA image from the input bit-depth
+// to a 32-bit float output buffer.
+float MeasureProcessor(OCIO::ConstCPUProcessorRcPtr & cpuProcessor, OCIO::BitDepth inBitDepth,
+                       unsigned iterations)
+{
+    static constexpr long Width  = 1024;
+    static constexpr long Height = 1024;
+
+    // Values are in [0, 1] for the float image.
+    std::vector<float> srcImg(Width * Height * 4);
+    std::vector<uint16_t> srcImg16(srcImg.size());
+    for(size_t idx=0; idx<srcImg.size(); ++idx)
+    {
+        const uint32_t val = uint32_t(idx * 2654435761u) % 65536u;
+        srcImg[idx]   = float(val) / 65535.0f;
+        srcImg16[idx] = uint16_t(val);
+    }
+
+    std::vector<float> dstImg(srcImg.size());
+
+    const bool isFloat = inBitDepth==OCIO::BIT_DEPTH_F32;
+    void * srcData = isFloat ? (void *)&srcImg[0] : (void *)&srcImg16[0];
+    const ptrdiff_t chanStrideBytes = isFloat ? sizeof(float) : sizeof(uint16_t);
+
+    OCIO::PackedImageDesc srcImgDesc(srcData, Width, Height, 4, inBitDepth,
+                                     chanStrideBytes, 4 * chanStrideBytes,
+                                     4 * chanStrideBytes * Width);
+    OCIO::PackedImageDesc dstImgDesc(&dstImg[0], Width, Height, 4);
+
+    // Warm up.
+    cpuProcessor->apply(srcImgDesc, dstImgDesc);
+
+    std::chrono::duration<float, std::milli> duration(0);
+    for(unsigned iter=0; iter<iterations; ++iter)
+    {
+        const auto start = std::chrono::high_resolution_clock::now();
+        cpuProcessor->apply(srcImgDesc, dstImgDesc);
+        duration += std::chrono::high_resolution_clock::now() - start;
+    }
+
+    return duration.count() / float(iterations);
+}
+
+OCIO::ConstCPUProcessorRcPtr GetCalibrationProcessor(const OCIO::ConstConfigRcPtr & config,
+                                                     const OCIO::ConstTransformRcPtr & transform,
+                                                     OCIO::BitDepth inBitDepth,
+                                                     OCIO::OptimizationFlags oFlags)
+{
+    return config->getProcessor(transform)->getOptimizedCPUProcessor(inBitDepth,
+                                                                     OCIO::BIT_DEPTH_F32,
+                                                                     oFlags);
+}
+
+// Measure the cost of one op (in ms per 1024x1024 image). The ops of a chain are not combined
+// (i.e. no optimization flags) and alternate between the forward and inverse directions when
+// possible to keep the values in a meaningful range. The measure of a chain of one op is
+// subtracted to exclude the unpacking & packing times.
+float MeasureOpCost(const std::string & opType, unsigned iterations)
+{
+    static constexpr unsigned NumOps = 9;
+
+    const bool lut = StringUtils::StartsWith(opType, "Lut");
+
+    // A v1 config creates an Exponent op from an ExponentTransform, a v2 config a Gamma op.
+    OCIO::ConfigRcPtr config = OCIO::Config::Create();
+    config->setMajorVersion(opType=="Exponent" ? 1 : 2);
+
+    OCIO::GroupTransformRcPtr oneOp = OCIO::GroupTransform::Create();
+    OCIO::GroupTransformRcPtr allOps = OCIO::GroupTransform::Create();
+    for(unsigned op=0; op<NumOps; ++op)
+    {
+        OCIO::TransformRcPtr transform
+            = CreateCalibrationTransform(opType, !lut && (op % 2)==1);
+        if(op==0)
+        {
+            oneOp->appendTransform(transform);
+        }
+        allOps->appendTransform(transform);
+    }
+
+    OCIO::ConstCPUProcessorRcPtr oneOpProcessor
+        = GetCalibrationProcessor(config, oneOp, OCIO::BIT_DEPTH_F32,
+                                  OCIO::OPTIMIZATION_NONE);
+    OCIO::ConstCPUProcessorRcPtr allOpsProcessor
+        = GetCalibrationProcessor(config, allOps, OCIO::BIT_DEPTH_F32,
+                                  OCIO::OPTIMIZATION_NONE);
+
+    const float duration = MeasureProcessor(allOpsProcessor, OCIO::BIT_DEPTH_F32, iterations)
+                           - MeasureProcessor(oneOpProcessor, OCIO::BIT_DEPTH_F32, iterations);
+
+    return std::max(0.0f, duration) / float(NumOps - 1);
+}
+
+// Measure the cost of the look-up 1D LUT replacing the separable ops of an integer input image.
+// As the look-up also replaces the unpacking of the integer values, its measure is relative to
+// a matrix op processing the same image.
+float MeasureLookupCost(float matrixCost, unsigned iterations)
+{
+    OCIO::ConstConfigRcPtr config = OCIO::Config::Create();
+
+    // An inverse 1D LUT is always replaced by a look-up.
+    OCIO::ConstCPUProcessorRcPtr lookupProcessor
+        = GetCalibrationProcessor(config, CreateCalibrationTransform("Lut1DInverse", false),
+                                  OCIO::BIT_DEPTH_UINT16,
+                                  OCIO::OPTIMIZATION_COMP_SEPARABLE_PREFIX);
+    OCIO::ConstCPUProcessorRcPtr matrixProcessor
+        = GetCalibrationProcessor(config, CreateCalibrationTransform("Matrix", false),
+                                  OCIO::BIT_DEPTH_UINT16,
+                                  OCIO::OPTIMIZATION_NONE);
+
+    const float duration = MeasureProcessor(lookupProcessor, OCIO::BIT_DEPTH_UINT16, iterations)
+                           - MeasureProcessor(matrixProcessor, OCIO::BIT_DEPTH_UINT16, iterations);
+
+    // The look-up is at least as fast as an unpacking so it should be close to free.
+    return std::max(0.05f * matrixCost, matrixCost + duration);
+}
+
+// Measure the op costs on the current computer and save them as an optimizer cost table.
+void CalibrateOptimizerCosts(const std::string & filepath, unsigned iterations)
+{
+    static const char * opTypes[] = { "Matrix", "Range", "CDL", "Exponent", "ExposureContrast",
+                                      "FixedFunction", "Gamma", "Log", "Lut1D", "Lut1DInverse",
+                                      "Lut3D", "Lut3DInverse" };
+
+    std::cout << std::endl;
+    std::cout << "Calibrating the optimizer costs (in ms per 1024x1024 image):" << std::endl;
+
+    std::ostringstream oss;
+    oss << "# OpenColorIO optimizer cost table generated by 'ocioperf --calibrate'." << std::endl;
+    oss << "# The costs are relative to the Matrix cost." << std::endl;
+
+    float matrixCost = 0.0f;
+    for(const char * opType : opTypes)
+    {
+        const float cost = MeasureOpCost(opType, iterations);
+        std::cout << "  " << opType << ": " << cost << std::endl;
+
+        if(matrixCost==0.0f)
+        {
+            matrixCost = std::max(cost, 1e-3f);
+        }
+
+        oss << opType << " " << (cost / matrixCost) << std::endl;
+    }
+
+    const float lookupCost = MeasureLookupCost(matrixCost, iterations);
+    std::cout << "  Lut1DLookup: " << lookupCost << std::endl;
+    oss << "Lut1DLookup " << (lookupCost / matrixCost) << std::endl;
+
+    std::ofstream ofs(filepath.c_str(), std::ios_base::out);
+    if(!ofs.good())
+    {
+        std::string err("Could not write the optimizer cost table: ");
+        err += filepath;
+        throw OCIO::Exception(err.c_str());
+    }
+    ofs << oss.str();
+
+    std::cout << std::endl;
+    std::cout << "Set $OCIO_OPTIMIZER_COSTS to '" << filepath << "' to use the cost table."
+              << std::endl;
+}
+
 int main(int argc, const char **argv)
 {
     bool verbose = false;
     signed int testType = 0;
     std::string transformFile;
+    std::string fixedFunctionStyle;
+    bool inverse = false;
     std::string inputColorSpace, outputColorSpace;
     std::string filepath;
     unsigned iterations = 10;
     std::string outBitDepthStr("auto");
+    std::string calibrationFile;
 
     bool help = false;
 
     ArgParse ap;
     ap.options("ocioperf -- apply and measure a color transformation processing\n\n"
-               "usage: ocioperf [options] --image inputimage\n\n",
+               "usage: ocioperf [options] --image inputimage\n"
+               "       ocioperf [--iter n] --calibrate costfile\n\n",
                "--h", &help, "Display the help and exit",
                "--v", &verbose, "Display some general information",
                "--test %d", &testType, "Define the type of processing to measure: "\
                                        "0 means on the complete image (the default), 1 is line-by-line, "\
                                        "2 is pixel-per-pixel and -1 performs all the test types",
                "--transform %s", &transformFile, "Provide the transform file to apply on the image",
+               "--fixedfunction %s", &fixedFunctionStyle, "Provide the fixed function style to apply on "\
+                                                      "the image (e.g. aces_glow10, rgb_to_hsv)",
+               "--inverse", &inverse, "Apply the inverse of the fixed function",
                "--colorspaces %s %s", &inputColorSpace, &outputColorSpace,
                                       "Provide the input and output color spaces to apply on the image",
                "--image %s", &filepath, "Provide the filepath of the image to process",
                "--iter %d", &iterations, "Provide the number of iterations on the processing. Default is 10",
                "--out %s", &outBitDepthStr, "Provide an output bit-depth (auto, ui16, f32)"\
                                             " where auto preserves the input bit-depth",
+               "--calibrate %s", &calibrationFile, "Measure the op costs used by the optimizer "\
+                                                   "and save them in the cost table file "\
+                                                   "(no image is needed)",
                NULL);
 
     if(ap.parse (argc, argv) < 0) {
@@ -312,6 +604,21 @@ int main(int argc, const char **argv)
         }
     }
 
+    if(!calibrationFile.empty())
+    {
+        try
+        {
+            CalibrateOptimizerCosts(calibrationFile, iterations);
+        }
+        catch(OCIO::Exception & exception)
+        {
+            std::cerr << "OCIO Error: " << exception.what() << std::endl;
+            exit(1);
+        }
+
+        return 0;
+    }
+
     OIIO::ImageSpec spec;
     OCIO::ImgBuffer img;
     LoadImage(filepath, verbose, spec, img);
@@ -338,6 +645,30 @@ int main(int argc, const char **argv)
             // Get the processor
             processor = config->getProcessor(transform);
         }
+        else if(!fixedFunctionStyle.empty())
+        {
+            OCIO::ConstConfigRcPtr config  = OCIO::Config::Create();
+
+            std::cout << std::endl;
+            std::cout << "Processing using the fixed function '" << fixedFunctionStyle << "'"
+                      << (inverse ? " (inverse)" : "") << std::endl;
+
+            // Get the transform.
+            OCIO::FixedFunctionTransformRcPtr transform = OCIO::FixedFunctionTransform::Create();
+            transform->setStyle(OCIO::FixedFunctionStyleFromString(fixedFunctionStyle.c_str()));
+            transform->setDirection(inverse ? OCIO::TRANSFORM_DIR_INVERSE
+                                            : OCIO::TRANSFORM_DIR_FORWARD);
+
+            if(transform->getStyle()==OCIO::FIXED_FUNCTION_REC2100_SURROUND)
+            {
+                // Use the minimum HLG gamma.
+                const double gamma = 0.78;
+                transform->setParams(&gamma, 1);
+            }
+
+            // Get the processor
+            processor = config->getProcessor(transform);
+        }
         else if(!inputColorSpace.empty() && !outputColorSpace.empty())
         {
             if(verbose)
@@ -6,9 +6,12 @@
 
 #include "ops/lut1d/Lut1DOp.h"
 #include "ops/lut1d/Lut1DOpData.h"
+#include "ops/matrix/MatrixOp.h"
+#include "ops/range/RangeOp.h"
 #include "ScanlineHelper.h"
 #include "testutils/UnitTest.h"
 #include "UnitTestUtils.h"
+#include "utils/StringUtils.h"
 
 namespace OCIO = OCIO_NAMESPACE;
 
@@ -818,7 +821,7 @@ OCIO_ADD_TEST(CPUProcessor, with_several_ops)
             const std::string cacheID{ cpuProcessor->getCacheID() };
 
             const std::string expectedID("CPU Processor: from 16ui to 32f oFlags 122879 ops"
-                ": <Lut1D $a57d7444e629d796d2234c18a0539c74 forward default standard domain none>");
+                ": <Lut1D $f20f5bba9e9d80a06f5ddf764bf912b0 forward default standard domain none>");
 
             // Test integer optimization. The ops should be optimized into a single LUT
             // when finalizing with an integer input bit-depth.
@@ -2199,3 +2202,113 @@ OCIO_ADD_TEST(CPUProcessor, optimizations)
     }
 }
 
+
+OCIO_ADD_TEST(CPUProcessor, range_fusion)
+{
+    // A range following a matrix is folded into the matrix renderer.
+
+    OCIO::OpRcPtrVec ops;
+
+    const double m44[16] = {  1.10, -0.05,  0.02, 0.0,
+                             -0.10,  0.95,  0.15, 0.0,
+                              0.03,  0.12,  0.85, 0.0,
+                              0.00,  0.00,  0.00, 1.0 };
+    const double offset4[4] = { 0.01, -0.02, 0.03, 0.0 };
+    OCIO::CreateMatrixOffsetOp(ops, m44, offset4, OCIO::TRANSFORM_DIR_FORWARD);
+    OCIO::CreateRangeOp(ops, 0., 1., 0.1, 0.9, OCIO::TRANSFORM_DIR_FORWARD);
+    OCIO::CreateRangeOp(ops, 0., 1., 0., 1., OCIO::TRANSFORM_DIR_FORWARD);
+    OCIO_REQUIRE_EQUAL(ops.size(), 3);
+    OCIO_CHECK_NO_THROW(ops.finalize(OCIO::OPTIMIZATION_NONE));
+
+    OCIO::ConstOpCPURcPtr inBitDepthOp, outBitDepthOp;
+    OCIO::ConstOpCPURcPtrVec cpuOps;
+    OCIO_CHECK_NO_THROW(OCIO::CreateCPUEngine(ops, OCIO::BIT_DEPTH_F32, OCIO::BIT_DEPTH_F32,
+                                              inBitDepthOp, cpuOps, outBitDepthOp));
+
+    // Only the first range is fused.
+    OCIO_CHECK_EQUAL(cpuOps.size(), 0);
+    {
+        const OCIO::OpCPU & c = *inBitDepthOp;
+        const std::string typeName(typeid(c).name());
+        OCIO_CHECK_NE(std::string::npos, StringUtils::Find(typeName, "RangeFusedRenderer"));
+    }
+    {
+        const OCIO::OpCPU & c = *outBitDepthOp;
+        const std::string typeName(typeid(c).name());
+        OCIO_CHECK_NE(std::string::npos, StringUtils::Find(typeName, "RangeMinMaxRenderer"));
+    }
+
+    // The fused renderer processes the pixels by blocks so use more pixels than a block.
+    constexpr long NB_PIXELS = 1000;
+
+    std::vector<float> inImg(NB_PIXELS * 4);
+    for (size_t idx = 0; idx < inImg.size(); ++idx)
+    {
+        inImg[idx] = float(idx % 97) / 48.f - 0.5f;
+    }
+
+    std::vector<float> expected(inImg);
+    ops[0]->apply(&expected[0], NB_PIXELS);
+    ops[1]->apply(&expected[0], NB_PIXELS);
+
+    std::vector<float> outImg(NB_PIXELS * 4);
+    inBitDepthOp->apply(&inImg[0], &outImg[0], NB_PIXELS);
+
+    for (size_t idx = 0; idx < outImg.size(); ++idx)
+    {
+        OCIO_CHECK_EQUAL(outImg[idx], expected[idx]);
+    }
+}
+
+OCIO_ADD_TEST(CPUProcessor, renderer_cache)
+{
+    OCIO::OpRcPtrVec ops;
+
+    const double m44[16] = {  1.10, -0.05,  0.02, 0.0,
+                             -0.10,  0.95,  0.15, 0.0,
+                              0.03,  0.12,  0.85, 0.0,
+                              0.00,  0.00,  0.00, 1.0 };
+    const double offset4[4] = { 0.01, -0.02, 0.03, 0.0 };
+    OCIO::CreateMatrixOffsetOp(ops, m44, offset4, OCIO::TRANSFORM_DIR_FORWARD);
+    OCIO::CreateRangeOp(ops, 0., 1., 0.1, 0.9, OCIO::TRANSFORM_DIR_FORWARD);
+    OCIO::CreateMatrixOffsetOp(ops, m44, offset4, OCIO::TRANSFORM_DIR_INVERSE);
+    OCIO::CreateRangeOp(ops, 0., 1., 0., 1., OCIO::TRANSFORM_DIR_FORWARD);
+    OCIO_CHECK_NO_THROW(ops.finalize(OCIO::OPTIMIZATION_NONE));
+
+    OCIO::CPURendererCache renderers;
+
+    OCIO::ConstOpCPURcPtr inBitDepthOp1, outBitDepthOp1;
+    OCIO::ConstOpCPURcPtrVec cpuOps1;
+    OCIO_CHECK_NO_THROW(OCIO::CreateCPUEngine(ops, OCIO::BIT_DEPTH_F32, OCIO::BIT_DEPTH_F32,
+                                              inBitDepthOp1, cpuOps1, outBitDepthOp1,
+                                              OCIO::OPTIMIZATION_NONE, &renderers));
+    OCIO_CHECK_EQUAL(renderers.getNumRenderers(), 2);
+
+    // The renderers are reused.
+
+    OCIO::ConstOpCPURcPtr inBitDepthOp2, outBitDepthOp2;
+    OCIO::ConstOpCPURcPtrVec cpuOps2;
+    OCIO_CHECK_NO_THROW(OCIO::CreateCPUEngine(ops, OCIO::BIT_DEPTH_F32, OCIO::BIT_DEPTH_F32,
+                                              inBitDepthOp2, cpuOps2, outBitDepthOp2,
+                                              OCIO::OPTIMIZATION_NONE, &renderers));
+    OCIO_CHECK_EQUAL(renderers.getNumRenderers(), 2);
+    OCIO_CHECK_EQUAL(inBitDepthOp1, inBitDepthOp2);
+    OCIO_CHECK_EQUAL(outBitDepthOp1, outBitDepthOp2);
+
+    // But not for other finalization flags.
+
+    OCIO::ConstOpCPURcPtr inBitDepthOp3, outBitDepthOp3;
+    OCIO::ConstOpCPURcPtrVec cpuOps3;
+    OCIO_CHECK_NO_THROW(OCIO::CreateCPUEngine(ops, OCIO::BIT_DEPTH_F32, OCIO::BIT_DEPTH_F32,
+                                              inBitDepthOp3, cpuOps3, outBitDepthOp3,
+                                              OCIO::OPTIMIZATION_DRAFT, &renderers));
+    OCIO_CHECK_EQUAL(renderers.getNumRenderers(), 4);
+    OCIO_CHECK_NE(inBitDepthOp1, inBitDepthOp3);
+
+    // The cache does not keep the renderers alive.
+
+    inBitDepthOp1.reset();
+    inBitDepthOp2.reset();
+    OCIO_CHECK_EQUAL(renderers.getNumRenderers(), 3);
+    OCIO_CHECK_ASSERT(!renderers.get("unknown"));
+}
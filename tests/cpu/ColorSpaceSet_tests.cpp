@@ -314,3 +314,57 @@ OCIO_ADD_TEST(ColorSpaceSet, operations_on_set)
 
     OCIO_CHECK_EQUAL(css4->getNumColorSpaces(), 0);
 }
+
+OCIO_ADD_TEST(ColorSpaceSet, name_index)
+{
+    // The lookup by name is case-insensitive and stays in sync with the list.
+
+    OCIO::ColorSpaceSetRcPtr css = OCIO::ColorSpaceSet::Create();
+
+    for (int idx = 0; idx < 5; ++idx)
+    {
+        OCIO::ColorSpaceRcPtr cs = OCIO::ColorSpace::Create();
+        cs->setName(("Cs" + std::to_string(idx)).c_str());
+        OCIO_CHECK_NO_THROW(css->addColorSpace(cs));
+    }
+    OCIO_REQUIRE_EQUAL(css->getNumColorSpaces(), 5);
+
+    OCIO_CHECK_EQUAL(css->getColorSpaceIndex("cs3"), 3);
+    OCIO_CHECK_EQUAL(css->getColorSpaceIndex("CS3"), 3);
+    OCIO_CHECK_ASSERT(css->hasColorSpace("cS4"));
+    OCIO_CHECK_ASSERT(!css->hasColorSpace("cs5"));
+    OCIO_CHECK_ASSERT(!css->hasColorSpace(""));
+    OCIO_CHECK_ASSERT(!css->hasColorSpace(nullptr));
+
+    // Replacing a color space keeps its position.
+
+    OCIO::ColorSpaceRcPtr cs = OCIO::ColorSpace::Create();
+    cs->setName("CS1");
+    cs->setFamily("replaced");
+    OCIO_CHECK_NO_THROW(css->addColorSpace(cs));
+    OCIO_REQUIRE_EQUAL(css->getNumColorSpaces(), 5);
+    OCIO_CHECK_EQUAL(css->getColorSpaceIndex("cs1"), 1);
+    OCIO_CHECK_EQUAL(std::string(css->getColorSpace("cs1")->getFamily()), "replaced");
+
+    // Removing a color space moves down the following ones.
+
+    OCIO_CHECK_NO_THROW(css->removeColorSpace("CS2"));
+    OCIO_REQUIRE_EQUAL(css->getNumColorSpaces(), 4);
+    OCIO_CHECK_EQUAL(css->getColorSpaceIndex("cs2"), -1);
+    OCIO_CHECK_EQUAL(css->getColorSpaceIndex("cs1"), 1);
+    OCIO_CHECK_EQUAL(css->getColorSpaceIndex("cs3"), 2);
+    OCIO_CHECK_EQUAL(css->getColorSpaceIndex("cs4"), 3);
+    OCIO_CHECK_EQUAL(std::string(css->getColorSpace("Cs4")->getName()), "Cs4");
+
+    // The copy has its own index.
+
+    OCIO::ColorSpaceSetRcPtr copy = css->createEditableCopy();
+    OCIO_CHECK_NO_THROW(css->clearColorSpaces());
+    OCIO_CHECK_ASSERT(!css->hasColorSpace("cs0"));
+    OCIO_CHECK_EQUAL(copy->getColorSpaceIndex("cs4"), 3);
+
+    OCIO_CHECK_NO_THROW(copy->addColorSpace(cs));
+    OCIO_CHECK_NO_THROW(copy->removeColorSpace("cs0"));
+    OCIO_CHECK_EQUAL(copy->getColorSpaceIndex("cs1"), 0);
+    OCIO_CHECK_EQUAL(copy->getColorSpaceIndex("cs4"), 2);
+}
@@ -0,0 +1,378 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+
+#include <fstream>
+
+#include "ConfigSnapshot.cpp"
+
+#include "testutils/UnitTest.h"
+#include "UnitTestUtils.h"
+
+namespace OCIO = OCIO_NAMESPACE;
+
+
+namespace
+{
+
+OCIO::ConstConfigRcPtr CreateConfig()
+{
+    const std::string PROFILE =
+        "ocio_profile_version: 2\n"
+        "search_path: " + std::string(OCIO::getTestFilesDir()) + "\n"
+        "roles:\n"
+        "  default: raw\n"
+        "displays:\n"
+        "  sRGB:\n"
+        "  - !<View> {name: Raw, colorspace: raw}\n"
+        "colorspaces:\n"
+        "  - !<ColorSpace>\n"
+        "    name: raw\n"
+        "  - !<ColorSpace>\n"
+        "    name: lut1d\n"
+        "    to_reference: !<FileTransform> {src: lut1d_1.spi1d, interpolation: linear}\n"
+        "  - !<ColorSpace>\n"
+        "    name: lut3d\n"
+        "    to_reference: !<GroupTransform>\n"
+        "      children:\n"
+        "        - !<FileTransform> {src: camera_to_aces.spimtx}\n"
+        "        - !<FileTransform> {src: lut3d_1.spi3d, interpolation: tetrahedral}\n"
+        "  - !<ColorSpace>\n"
+        "    name: cdl\n"
+        "    to_reference: !<FileTransform> {src: cdl_test1.ccc, cccid: cc0003}\n"
+        "  - !<ColorSpace>\n"
+        "    name: clf\n"
+        "    to_reference: !<FileTransform> {src: lut1d_example.clf}\n"
+        "  - !<ColorSpace>\n"
+        "    name: reference\n"
+        "    to_reference: !<FileTransform> {src: reference_one_matrix.ctf}\n";
+
+    std::istringstream is(PROFILE);
+    return OCIO::Config::CreateFromStream(is);
+}
+
+void CheckSameProcessing(const OCIO::ConstConfigRcPtr & config,
+                         const OCIO::ConstConfigRcPtr & snapshotConfig,
+                         const char * srcName,
+                         const char * dstName)
+{
+    OCIO::ConstProcessorRcPtr proc;
+    OCIO_CHECK_NO_THROW(proc = config->getProcessor(srcName, dstName));
+    OCIO::ConstProcessorRcPtr snapshotProc;
+    OCIO_CHECK_NO_THROW(snapshotProc = snapshotConfig->getProcessor(srcName, dstName));
+    OCIO_REQUIRE_ASSERT(proc && snapshotProc);
+
+    OCIO::ConstCPUProcessorRcPtr cpu = proc->getDefaultCPUProcessor();
+    OCIO::ConstCPUProcessorRcPtr snapshotCpu = snapshotProc->getDefaultCPUProcessor();
+    OCIO_CHECK_EQUAL(std::string(cpu->getCacheID()), std::string(snapshotCpu->getCacheID()));
+
+    float pixel[4] = { 0.1f, 0.5f, 0.8f, 1.0f };
+    float snapshotPixel[4] = { 0.1f, 0.5f, 0.8f, 1.0f };
+    cpu->applyRGBA(pixel);
+    snapshotCpu->applyRGBA(snapshotPixel);
+    OCIO_CHECK_EQUAL(pixel[0], snapshotPixel[0]);
+    OCIO_CHECK_EQUAL(pixel[1], snapshotPixel[1]);
+    OCIO_CHECK_EQUAL(pixel[2], snapshotPixel[2]);
+}
+
+} // anon.
+
+OCIO_ADD_TEST(ConfigSnapshot, file_ops)
+{
+    OCIO::ClearAllCaches();
+
+    OCIO::ConstConfigRcPtr config = CreateConfig();
+
+    std::stringstream snapshot;
+    OCIO_CHECK_NO_THROW(config->writeSnapshot(snapshot, OCIO::SNAPSHOT_FILE_OPS));
+
+    OCIO::ClearAllCaches();
+    OCIO_CHECK_EQUAL(OCIO::GetConfigSnapshotCacheSize(), 0);
+
+    OCIO::ConstConfigRcPtr snapshotConfig;
+    OCIO_CHECK_NO_THROW(snapshotConfig = OCIO::Config::CreateFromSnapshot(snapshot));
+    OCIO_REQUIRE_ASSERT(snapshotConfig);
+
+    // All the files except the one referencing another file are saved.
+    OCIO_CHECK_EQUAL(OCIO::GetConfigSnapshotCacheSize(), 5);
+
+    OCIO_CHECK_EQUAL(snapshotConfig->getNumColorSpaces(), config->getNumColorSpaces());
+    OCIO_CHECK_EQUAL(std::string(snapshotConfig->getWorkingDir()),
+                     std::string(config->getWorkingDir()));
+    OCIO_CHECK_EQUAL(std::string(snapshotConfig->getCacheID()),
+                     std::string(config->getCacheID()));
+    OCIO_CHECK_NO_THROW(snapshotConfig->sanityCheck());
+
+    for (const char * name : { "lut1d", "lut3d", "cdl", "clf", "reference" })
+    {
+        CheckSameProcessing(config, snapshotConfig, name, "raw");
+        CheckSameProcessing(config, snapshotConfig, "raw", name);
+    }
+
+    // The snapshot is ignored for a file that changed since it was written.
+
+    OCIO::ConstContextRcPtr context = snapshotConfig->getCurrentContext();
+    const std::string filepath = context->resolveFileLocation("lut1d_1.spi1d");
+
+    OCIO::FileTransformRcPtr file = OCIO::FileTransform::Create();
+    file->setSrc("lut1d_1.spi1d");
+    file->setInterpolation(OCIO::INTERP_LINEAR);
+
+    OCIO::OpRcPtrVec ops;
+    OCIO_CHECK_ASSERT(OCIO::BuildConfigSnapshotFileOps(ops, filepath, context, *file,
+                                                       OCIO::TRANSFORM_DIR_FORWARD));
+    OCIO_CHECK_EQUAL(ops.size(), 1);
+
+    // Another interpolation is another entry.
+    file->setInterpolation(OCIO::INTERP_NEAREST);
+    OCIO_CHECK_ASSERT(!OCIO::BuildConfigSnapshotFileOps(ops, filepath, context, *file,
+                                                        OCIO::TRANSFORM_DIR_FORWARD));
+    file->setInterpolation(OCIO::INTERP_LINEAR);
+
+    OCIO::SetFastFileHash(filepath, "changed");
+    OCIO_CHECK_ASSERT(!OCIO::BuildConfigSnapshotFileOps(ops, filepath, context, *file,
+                                                        OCIO::TRANSFORM_DIR_FORWARD));
+    OCIO_CHECK_EQUAL(ops.size(), 1);
+    CheckSameProcessing(config, snapshotConfig, "lut1d", "raw");
+
+    OCIO::ClearAllCaches();
+    OCIO_CHECK_EQUAL(OCIO::GetConfigSnapshotCacheSize(), 0);
+    CheckSameProcessing(config, snapshotConfig, "lut3d", "raw");
+}
+
+OCIO_ADD_TEST(ConfigSnapshot, file_hashes)
+{
+    OCIO::ClearAllCaches();
+
+    OCIO::ConstConfigRcPtr config = CreateConfig();
+
+    std::stringstream configOnly;
+    OCIO_CHECK_NO_THROW(config->writeSnapshot(configOnly, OCIO::SNAPSHOT_CONFIG_ONLY));
+    std::stringstream all;
+    OCIO_CHECK_NO_THROW(config->writeSnapshot(all, OCIO::SNAPSHOT_ALL));
+    OCIO_CHECK_ASSERT(all.str().size() > configOnly.str().size());
+
+    OCIO::ClearAllCaches();
+
+    OCIO::ConstConfigRcPtr snapshotConfig;
+    OCIO_CHECK_NO_THROW(snapshotConfig = OCIO::Config::CreateFromSnapshot(configOnly));
+    OCIO_CHECK_EQUAL(OCIO::GetConfigSnapshotCacheSize(), 0);
+    CheckSameProcessing(config, snapshotConfig, "lut3d", "raw");
+
+    OCIO::ClearAllCaches();
+
+    OCIO_CHECK_NO_THROW(snapshotConfig = OCIO::Config::CreateFromSnapshot(all));
+    OCIO_CHECK_EQUAL(OCIO::GetConfigSnapshotCacheSize(), 5);
+
+    // The file hashes of the snapshot are trusted.
+
+    const std::string filepath
+        = snapshotConfig->getCurrentContext()->resolveFileLocation("lut3d_1.spi3d");
+    std::string hash;
+    OCIO_CHECK_NO_THROW(hash = OCIO::GetFastFileHash(filepath));
+    OCIO_CHECK_ASSERT(!hash.empty());
+
+    OCIO_CHECK_EQUAL(std::string(snapshotConfig->getCacheID()),
+                     std::string(config->getCacheID()));
+    CheckSameProcessing(config, snapshotConfig, "lut3d", "raw");
+    CheckSameProcessing(config, snapshotConfig, "raw", "cdl");
+}
+
+OCIO_ADD_TEST(ConfigSnapshot, errors)
+{
+    std::istringstream yaml("ocio_profile_version: 2\n");
+    OCIO_CHECK_THROW_WHAT(OCIO::Config::CreateFromSnapshot(yaml), OCIO::Exception,
+                          "Error: Loading the OCIO config snapshot failed. The stream is not "
+                          "a config snapshot.");
+
+    OCIO::ConstConfigRcPtr config = CreateConfig();
+    std::stringstream snapshot;
+    OCIO_CHECK_NO_THROW(config->writeSnapshot(snapshot, OCIO::SNAPSHOT_ALL));
+
+    const std::string data = snapshot.str();
+    std::istringstream truncated(data.substr(0, data.size() - 10));
+    OCIO_CHECK_THROW_WHAT(OCIO::Config::CreateFromSnapshot(truncated), OCIO::Exception,
+                          "The config snapshot is truncated or corrupted.");
+
+    OCIO_CHECK_THROW_WHAT(OCIO::Config::CreateFromSnapshotFile("missing.ocio.snap"),
+                          OCIO::Exception,
+                          "Error could not read 'missing.ocio.snap' OCIO config snapshot.");
+}
+
+OCIO_ADD_TEST(ConfigSnapshot, invalid_lut_sizes)
+{
+    // The LUT sizes are checked against the snapshot size before allocating the values.
+
+    auto readLut = [](OCIO::OpData::Type type, std::initializer_list<uint32_t> values)
+    {
+        std::ostringstream os;
+        OCIO::SnapshotWriter writer(os);
+        writer.writeUInt(type);
+        OCIO::WriteMetadata(writer, OCIO::FormatMetadataImpl("ROOT", ""));
+        for (const uint32_t value : values)
+        {
+            writer.writeUInt(value);
+        }
+        // The values of a Lut1D of length 8 or of a Lut3D of grid size 2.
+        const std::vector<float> lutValues(24, 0.5f);
+        writer.writeValues(lutValues);
+
+        const std::string data = os.str();
+        OCIO::SnapshotReader reader(data.c_str(), data.size());
+        return OCIO::ReadOpData(reader);
+    };
+
+    OCIO::OpDataRcPtr data;
+    OCIO_CHECK_NO_THROW(data = readLut(OCIO::OpData::Lut1DType,
+                                       { 0, 8, 3, OCIO::INTERP_LINEAR, OCIO::TRANSFORM_DIR_FORWARD,
+                                         OCIO::LUT_INVERSION_FAST, OCIO::HUE_NONE,
+                                         OCIO::BIT_DEPTH_F32 }));
+    OCIO_CHECK_ASSERT(data && data->getType() == OCIO::OpData::Lut1DType);
+    OCIO_CHECK_NO_THROW(data = readLut(OCIO::OpData::Lut3DType,
+                                       { 2, OCIO::INTERP_LINEAR, OCIO::TRANSFORM_DIR_FORWARD,
+                                         OCIO::LUT_INVERSION_FAST, OCIO::BIT_DEPTH_F32 }));
+    OCIO_CHECK_ASSERT(data && data->getType() == OCIO::OpData::Lut3DType);
+
+    // Lut1D: half flags, length and number of color components.
+    OCIO_CHECK_THROW_WHAT(readLut(OCIO::OpData::Lut1DType, { 0, 1u << 28, 3 }), OCIO::Exception,
+                          "The config snapshot is truncated or corrupted.");
+    OCIO_CHECK_THROW_WHAT(readLut(OCIO::OpData::Lut1DType, { 0, 0xFFFFFFFF, 0xFFFFFFFF }),
+                          OCIO::Exception, "The config snapshot is truncated or corrupted.");
+
+    // Lut3D: grid size and interpolation.
+    OCIO_CHECK_THROW_WHAT(readLut(OCIO::OpData::Lut3DType, { 1024, OCIO::INTERP_LINEAR }),
+                          OCIO::Exception, "The config snapshot is truncated or corrupted.");
+    OCIO_CHECK_THROW_WHAT(readLut(OCIO::OpData::Lut3DType, { 0xFFFFFFFF, OCIO::INTERP_LINEAR }),
+                          OCIO::Exception, "The config snapshot is truncated or corrupted.");
+}
+
+OCIO_ADD_TEST(ConfigSnapshot, lut_store)
+{
+    const std::string dirname
+        = pystring::os::path::dirname(OCIO::Platform::CreateTempFilename(""));
+
+    OCIO::ClearAllCaches();
+    OCIO::SetLutStoreDirectory(dirname.c_str());
+    OCIO_CHECK_EQUAL(OCIO::GetLutStoreDirectory(), dirname);
+
+    OCIO::ConstConfigRcPtr config = CreateConfig();
+    OCIO::ConstContextRcPtr context = config->getCurrentContext();
+
+    OCIO::FileTransformRcPtr file = OCIO::FileTransform::Create();
+    file->setSrc("lut3d_1.spi3d");
+    file->setInterpolation(OCIO::INTERP_TETRAHEDRAL);
+
+    const std::string filepath = context->resolveFileLocation(file->getSrc());
+    const std::string storeFilepath
+        = OCIO::GetLutStoreFilepath(dirname,
+                                    OCIO::CreateKey(filepath, context, *file),
+                                    OCIO::GetFastFileHash(filepath));
+    std::remove(storeFilepath.c_str());
+
+    auto applyLut = [&config, &file]()
+    {
+        float pixel[3] = { 0.1f, 0.5f, 0.8f };
+        config->getProcessor(file)->getDefaultCPUProcessor()->applyRGB(pixel);
+        return std::vector<float>(pixel, pixel + 3);
+    };
+
+    auto getNumFileCacheMisses = []()
+    {
+        size_t numFiles = 0, memory = 0, numHits = 0, numMisses = 0;
+        OCIO::GetFileCacheStats(numFiles, memory, numHits, numMisses);
+        return numMisses;
+    };
+
+    // The first process parses the file and saves its ops in the LUT store.
+
+    std::vector<float> pixel;
+    OCIO_CHECK_NO_THROW(pixel = applyLut());
+    OCIO_CHECK_EQUAL(getNumFileCacheMisses(), 1);
+    OCIO_CHECK_ASSERT(std::ifstream(storeFilepath.c_str()).good());
+    // The LUT store entries are not kept in memory.
+    OCIO_CHECK_EQUAL(OCIO::GetConfigSnapshotCacheSize(), 0);
+
+    // Another process reads the ops from the LUT store instead of parsing the file.
+
+    OCIO::ClearAllCaches();
+    OCIO_CHECK_EQUAL(OCIO::GetConfigSnapshotCacheSize(), 0);
+
+    OCIO_CHECK_ASSERT(applyLut() == pixel);
+    OCIO_CHECK_EQUAL(getNumFileCacheMisses(), 0);
+    OCIO_CHECK_EQUAL(OCIO::GetConfigSnapshotCacheSize(), 0);
+
+    file->setDirection(OCIO::TRANSFORM_DIR_INVERSE);
+    OCIO_CHECK_NO_THROW(applyLut());
+    OCIO_CHECK_EQUAL(getNumFileCacheMisses(), 0);
+    file->setDirection(OCIO::TRANSFORM_DIR_FORWARD);
+
+    // An invalid LUT store file is ignored, and then replaced.
+
+    {
+        std::ofstream os(storeFilepath.c_str(), std::ios_base::out | std::ios_base::binary);
+        os << "OCIOLUTS is not valid";
+    }
+
+    OCIO::ClearAllCaches();
+    OCIO_CHECK_ASSERT(applyLut() == pixel);
+    OCIO_CHECK_EQUAL(getNumFileCacheMisses(), 1);
+
+    OCIO::ClearAllCaches();
+    OCIO_CHECK_ASSERT(applyLut() == pixel);
+    OCIO_CHECK_EQUAL(getNumFileCacheMisses(), 0);
+
+    std::remove(storeFilepath.c_str());
+
+    // The LUT store is disabled.
+
+    OCIO::SetLutStoreDirectory("");
+    OCIO::ClearAllCaches();
+    OCIO_CHECK_ASSERT(applyLut() == pixel);
+    OCIO_CHECK_EQUAL(getNumFileCacheMisses(), 1);
+    OCIO_CHECK_EQUAL(OCIO::GetConfigSnapshotCacheSize(), 0);
+}
+
+OCIO_ADD_TEST(ConfigSnapshot, lut_store_preload)
+{
+    // Preloading the files of a config fills the LUT store and then reads it.
+
+    const std::string dirname
+        = pystring::os::path::dirname(OCIO::Platform::CreateTempFilename(""));
+
+    OCIO::ClearAllCaches();
+    OCIO::SetLutStoreDirectory(dirname.c_str());
+
+    OCIO::ConstConfigRcPtr config = CreateConfig();
+    OCIO::ConstContextRcPtr context = config->getCurrentContext();
+
+    // The FileTransform of the lut3d color space.
+    OCIO::FileTransformRcPtr file = OCIO::FileTransform::Create();
+    file->setSrc("lut3d_1.spi3d");
+    file->setInterpolation(OCIO::INTERP_TETRAHEDRAL);
+
+    const std::string filepath = context->resolveFileLocation(file->getSrc());
+    const std::string storeFilepath
+        = OCIO::GetLutStoreFilepath(dirname,
+                                    OCIO::CreateKey(filepath, context, *file),
+                                    OCIO::GetFastFileHash(filepath));
+    std::remove(storeFilepath.c_str());
+
+    auto getNumFileCacheMisses = []()
+    {
+        size_t numFiles = 0, memory = 0, numHits = 0, numMisses = 0;
+        OCIO::GetFileCacheStats(numFiles, memory, numHits, numMisses);
+        return numMisses;
+    };
+
+    OCIO_CHECK_NO_THROW(config->preloadFiles(nullptr, 2, false));
+    OCIO_CHECK_ASSERT(std::ifstream(storeFilepath.c_str()).good());
+    const size_t numMisses = getNumFileCacheMisses();
+
+    OCIO::ClearAllCaches();
+    OCIO_CHECK_NO_THROW(config->preloadFiles(nullptr, 2, false));
+    OCIO_CHECK_LT(getNumFileCacheMisses(), numMisses);
+
+    std::remove(storeFilepath.c_str());
+    OCIO::SetLutStoreDirectory("");
+    OCIO::ClearAllCaches();
+}
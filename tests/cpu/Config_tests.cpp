@@ -2,9 +2,13 @@
 // Copyright Contributors to the OpenColorIO Project.
 
 
+#include <atomic>
+#include <chrono>
 #include <sys/stat.h>
+#include <thread>
 
 #include "Config.cpp"
+#include "OpVecCache.h"
 #include "utils/StringUtils.h"
 
 #include <pystring/pystring.h>
@@ -2604,6 +2608,182 @@ OCIO_ADD_TEST(Config, key_value_error)
 namespace
 {
 
+// Enable the lazy loading of the configs for the guard lifetime.
+class LazyLoadingGuard
+{
+public:
+    LazyLoadingGuard()
+    {
+        OCIO::Platform::Setenv(OCIO::OCIO_LAZY_LOADING_ENVVAR, "1");
+    }
+    ~LazyLoadingGuard()
+    {
+        OCIO::Platform::Setenv(OCIO::OCIO_LAZY_LOADING_ENVVAR, "");
+    }
+};
+
+OCIO::ConstConfigRcPtr CreateConfig(const std::string & content)
+{
+    std::istringstream is(content);
+    return OCIO::Config::CreateFromStream(is);
+}
+
+} // anon.
+
+OCIO_ADD_TEST(Config, lazy_loading)
+{
+    const std::string PROFILE =
+        "ocio_profile_version: 2\n"
+        "strictparsing: false\n"
+        "roles:\n"
+        "  default: raw\n"
+        "displays:\n"
+        "  sRGB:\n"
+        "  - !<View> {name: Raw, colorspace: raw}\n"
+        "  - !<View> {name: Film, view_transform: vt, display_colorspace: dcs, looks: look}\n"
+        "looks:\n"
+        "  - !<Look>\n"
+        "    name: look\n"
+        "    process_space: lin\n"
+        "    transform: !<ExponentTransform> {value: [1.1, 1.2, 1.3, 1]}\n"
+        "view_transforms:\n"
+        "  - !<ViewTransform>\n"
+        "    name: vt\n"
+        "    from_reference: !<MatrixTransform> {offset: [0.1, 0.2, 0.3, 0]}\n"
+        "display_colorspaces:\n"
+        "  - !<ColorSpace>\n"
+        "    name: dcs\n"
+        "    from_display_reference: !<ExponentTransform> {value: [2.4, 2.4, 2.4, 1]}\n"
+        "colorspaces:\n"
+        "  - !<ColorSpace>\n"
+        "    name: raw\n"
+        "  - !<ColorSpace>\n"
+        "    name: lin\n"
+        "    to_reference: !<GroupTransform>\n"
+        "      children:\n"
+        "        - !<MatrixTransform> {offset: [0.1, 0.2, 0.3, 0]}\n"
+        "        - !<ExponentTransform> {value: [2.2, 2.2, 2.2, 1]}\n"
+        "  - !<ColorSpace>\n"
+        "    name: broken\n"
+        "    to_reference: !<MatrixTransform> {matrix: [1, 0, 0, 0, 0, 1]}\n";
+
+    static const std::string ERROR = "Error: Loading the OCIO profile failed. At line 33, the "
+                                     "value parsing of the key 'matrix' from 'MatrixTransform' "
+                                     "failed: 'matrix' values must be 16 numbers. Found '6'.";
+
+    OCIO_CHECK_THROW_WHAT(CreateConfig(PROFILE), OCIO::Exception, ERROR);
+
+    {
+        LazyLoadingGuard guard;
+
+        // The broken transform is only reported when used.
+
+        OCIO::ConstConfigRcPtr config;
+        OCIO_CHECK_NO_THROW(config = CreateConfig(PROFILE));
+        OCIO_REQUIRE_ASSERT(config);
+        OCIO_CHECK_EQUAL(config->getNumColorSpaces(), 4);
+
+        OCIO_CHECK_NO_THROW(config->getProcessor("lin", "raw"));
+        OCIO_CHECK_NO_THROW(config->getProcessor("lin", "sRGB", "Film"));
+
+        OCIO::ConstColorSpaceRcPtr cs = config->getColorSpace("broken");
+        OCIO_REQUIRE_ASSERT(cs);
+        OCIO_CHECK_THROW_WHAT(cs->getTransform(OCIO::COLORSPACE_DIR_TO_REFERENCE),
+                              OCIO::Exception, ERROR);
+        OCIO_CHECK_THROW_WHAT(config->getProcessor("broken", "raw"), OCIO::Exception, ERROR);
+        OCIO_CHECK_THROW_WHAT(config->sanityCheck(), OCIO::Exception, ERROR);
+        OCIO_CHECK_THROW_WHAT(config->getCacheID(), OCIO::Exception, ERROR);
+    }
+
+    // Without the broken color space, the lazily loaded config is the same.
+
+    const std::string VALID_PROFILE = PROFILE.substr(0, PROFILE.find("  - !<ColorSpace>\n"
+                                                                     "    name: broken"));
+
+    OCIO::ConstConfigRcPtr config;
+    OCIO_CHECK_NO_THROW(config = CreateConfig(VALID_PROFILE));
+
+    OCIO::ConstConfigRcPtr lazyConfig;
+    {
+        LazyLoadingGuard guard;
+        OCIO_CHECK_NO_THROW(lazyConfig = CreateConfig(VALID_PROFILE));
+    }
+
+    // A copy is also lazily loaded.
+    OCIO::ConstConfigRcPtr lazyCopy = lazyConfig->createEditableCopy();
+
+    OCIO_CHECK_NO_THROW(lazyConfig->sanityCheck());
+    OCIO_CHECK_EQUAL(std::string(lazyConfig->getCacheID()), std::string(config->getCacheID()));
+    OCIO_CHECK_EQUAL(std::string(lazyCopy->getCacheID()), std::string(config->getCacheID()));
+
+    std::ostringstream os, lazyOs;
+    OCIO_CHECK_NO_THROW(config->serialize(os));
+    OCIO_CHECK_NO_THROW(lazyConfig->serialize(lazyOs));
+    OCIO_CHECK_EQUAL(os.str(), lazyOs.str());
+
+    OCIO::ConstTransformRcPtr tr
+        = lazyCopy->getColorSpace("lin")->getTransform(OCIO::COLORSPACE_DIR_TO_REFERENCE);
+    OCIO_REQUIRE_ASSERT(OCIO_DYNAMIC_POINTER_CAST<const OCIO::GroupTransform>(tr));
+    OCIO_CHECK_EQUAL(OCIO_DYNAMIC_POINTER_CAST<const OCIO::GroupTransform>(tr)->getNumTransforms(),
+                     2);
+}
+
+OCIO_ADD_TEST(Config, lazy_loading_benchmark)
+{
+    // Loading of a config with many color spaces where only a few are used.
+
+    std::ostringstream oss;
+    oss << "ocio_profile_version: 2\n"
+        << "roles:\n"
+        << "  default: raw\n"
+        << "displays:\n"
+        << "  sRGB:\n"
+        << "  - !<View> {name: Raw, colorspace: raw}\n"
+        << "colorspaces:\n"
+        << "  - !<ColorSpace>\n"
+        << "    name: raw\n";
+    for (int idx = 0; idx < 1000; ++idx)
+    {
+        oss << "  - !<ColorSpace>\n"
+            << "    name: cs" << idx << "\n"
+            << "    to_reference: !<GroupTransform>\n"
+            << "      children:\n"
+            << "        - !<MatrixTransform> {matrix: [1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0,"
+            << " 1], offset: [0.1, 0.2, 0.3, 0]}\n"
+            << "        - !<LogAffineTransform> {base: 2, linSideSlope: [0.9, 0.9, 0.9]}\n"
+            << "        - !<ExponentTransform> {value: [2.2, 2.2, 2.2, 1]}\n"
+            << "        - !<CDLTransform> {slope: [1, 1.1, 1.2], power: [1.1, 1, 1], sat: 0.9}\n";
+    }
+    const std::string profile = oss.str();
+
+    const auto eagerStart = std::chrono::steady_clock::now();
+    OCIO::ConstConfigRcPtr config = CreateConfig(profile);
+    const auto eagerEnd = std::chrono::steady_clock::now();
+
+    OCIO::ConstConfigRcPtr lazyConfig;
+    {
+        LazyLoadingGuard guard;
+        lazyConfig = CreateConfig(profile);
+    }
+    OCIO_CHECK_NO_THROW(lazyConfig->getProcessor("cs10", "cs20"));
+    const auto lazyEnd = std::chrono::steady_clock::now();
+
+    OCIO_CHECK_EQUAL(lazyConfig->getNumColorSpaces(), 1001);
+
+    if (OCIO::GetLoggingLevel() >= OCIO::LOGGING_LEVEL_DEBUG)
+    {
+        std::ostringstream os;
+        os << "Config loading: eager "
+           << std::chrono::duration<double, std::milli>(eagerEnd - eagerStart).count()
+           << " ms, lazy (including one processor) "
+           << std::chrono::duration<double, std::milli>(lazyEnd - eagerEnd).count() << " ms";
+        OCIO::LogDebug(os.str());
+    }
+}
+
+namespace
+{
+
 // Redirect the std::cerr to catch the warning.
 class CerrGuard
 {
@@ -4238,6 +4418,94 @@ OCIO_ADD_TEST(Config, add_remove_display)
     OCIO_CHECK_EQUAL(std::string(config->getDisplay(0)), std::string("sRGB"));
 }
 
+OCIO_ADD_TEST(Config, name_indexes)
+{
+    // The lookups of looks, view transforms, displays and views are case-insensitive and
+    // follow the changes of the config.
+
+    OCIO::ConfigRcPtr config;
+    OCIO_CHECK_NO_THROW(config = OCIO::Config::CreateRaw()->createEditableCopy());
+
+    for (int idx = 0; idx < 3; ++idx)
+    {
+        const std::string name = "Item" + std::to_string(idx);
+
+        OCIO::LookRcPtr look = OCIO::Look::Create();
+        look->setName(name.c_str());
+        OCIO_CHECK_NO_THROW(config->addLook(look));
+
+        OCIO::ViewTransformRcPtr vt = OCIO::ViewTransform::Create(OCIO::REFERENCE_SPACE_SCENE);
+        vt->setName(name.c_str());
+        vt->setTransform(OCIO::MatrixTransform::Create(), OCIO::VIEWTRANSFORM_DIR_TO_REFERENCE);
+        OCIO_CHECK_NO_THROW(config->addViewTransform(vt));
+
+        OCIO_CHECK_NO_THROW(config->addDisplay("Disp", name.c_str(), "raw", name.c_str()));
+    }
+
+    OCIO_REQUIRE_EQUAL(config->getNumLooks(), 3);
+    OCIO_REQUIRE_ASSERT(config->getLook("ITEM1"));
+    OCIO_CHECK_EQUAL(std::string(config->getLook("ITEM1")->getName()), "Item1");
+    OCIO_CHECK_ASSERT(!config->getLook("Item3"));
+    OCIO_CHECK_ASSERT(!config->getLook(nullptr));
+
+    OCIO_REQUIRE_EQUAL(config->getNumViewTransforms(), 3);
+    OCIO_REQUIRE_ASSERT(config->getViewTransform("item2"));
+    OCIO_CHECK_EQUAL(std::string(config->getViewTransform("item2")->getName()), "Item2");
+    OCIO_CHECK_ASSERT(!config->getViewTransform("Item3"));
+    OCIO_CHECK_ASSERT(!config->getViewTransform(nullptr));
+
+    OCIO_CHECK_EQUAL(config->getNumViews("disp"), 3);
+    OCIO_CHECK_EQUAL(std::string(config->getDisplayLooks("DISP", "item1")), "Item1");
+    OCIO_CHECK_EQUAL(std::string(config->getDisplayColorSpaceName("disp", "ITEM2")), "raw");
+    OCIO_CHECK_EQUAL(std::string(config->getDisplayColorSpaceName("disp", "Item3")), "");
+    OCIO_CHECK_EQUAL(std::string(config->getDisplayColorSpaceName("Unknown", "Item1")), "");
+
+    // Replacing an element keeps its position.
+
+    OCIO::LookRcPtr look = OCIO::Look::Create();
+    look->setName("ITEM0");
+    look->setProcessSpace("raw");
+    OCIO_CHECK_NO_THROW(config->addLook(look));
+    OCIO_REQUIRE_EQUAL(config->getNumLooks(), 3);
+    OCIO_CHECK_EQUAL(std::string(config->getLookNameByIndex(0)), "ITEM0");
+    OCIO_CHECK_EQUAL(std::string(config->getLook("item0")->getProcessSpace()), "raw");
+
+    // Removing a view moves down the following ones.
+
+    OCIO_CHECK_NO_THROW(config->removeDisplay("Disp", "item0"));
+    OCIO_CHECK_EQUAL(config->getNumViews("Disp"), 2);
+    OCIO_CHECK_EQUAL(std::string(config->getDisplayLooks("Disp", "Item0")), "");
+    OCIO_CHECK_EQUAL(std::string(config->getDisplayLooks("Disp", "Item1")), "Item1");
+    OCIO_CHECK_EQUAL(std::string(config->getDisplayLooks("Disp", "Item2")), "Item2");
+
+    // Adding a display/view pair updates the indexes after a removal.
+
+    OCIO_CHECK_NO_THROW(config->addDisplay("Disp", "Item0", "raw", "Item2"));
+    OCIO_CHECK_NO_THROW(config->addDisplay("DISP", "ITEM2", "raw", "Item0"));
+    OCIO_CHECK_NO_THROW(config->addDisplay("Other", "Item1", "raw", "Item1"));
+    OCIO_REQUIRE_EQUAL(config->getNumViews("Disp"), 3);
+    OCIO_CHECK_EQUAL(std::string(config->getView("Disp", 1)), "Item2");
+    OCIO_CHECK_EQUAL(std::string(config->getView("Disp", 2)), "Item0");
+    OCIO_CHECK_EQUAL(std::string(config->getDisplayLooks("disp", "item0")), "Item2");
+    OCIO_CHECK_EQUAL(std::string(config->getDisplayLooks("disp", "item2")), "Item0");
+    OCIO_CHECK_EQUAL(std::string(config->getDisplayLooks("other", "item1")), "Item1");
+    OCIO_CHECK_EQUAL(std::string(config->getDisplayLooks("other", "item0")), "");
+
+    // A copy has its own indexes.
+
+    OCIO::ConfigRcPtr copy = config->createEditableCopy();
+    OCIO_CHECK_NO_THROW(config->clearLooks());
+    OCIO_CHECK_NO_THROW(config->clearViewTransforms());
+    OCIO_CHECK_NO_THROW(config->clearDisplays());
+    OCIO_CHECK_ASSERT(!config->getLook("Item1"));
+    OCIO_CHECK_ASSERT(!config->getViewTransform("Item1"));
+    OCIO_CHECK_EQUAL(std::string(config->getDisplayLooks("Disp", "Item1")), "");
+
+    OCIO_CHECK_ASSERT(copy->getLook("Item1"));
+    OCIO_CHECK_ASSERT(copy->getViewTransform("Item1"));
+    OCIO_CHECK_EQUAL(std::string(copy->getDisplayLooks("Disp", "Item1")), "Item1");
+}
+
 OCIO_ADD_TEST(Config, is_colorspace_used)
 {
     // Test Config::isColorSpaceUsed() i.e. a color space could be defined but not used.
@@ -4353,3 +4621,379 @@ OCIO_ADD_TEST(Config, is_colorspace_used)
     OCIO_CHECK_ASSERT(!config->isColorSpaceUsed(""));
     OCIO_CHECK_ASSERT(!config->isColorSpaceUsed("cs65")); // Unknown color spaces are not used.
 }
+
+OCIO_ADD_TEST(Config, cache_id_incremental)
+{
+    const std::string PROFILE =
+        "ocio_profile_version: 2\n"
+        "search_path: " + std::string(OCIO::getTestFilesDir()) + "\n"
+        "roles:\n"
+        "  default: raw\n"
+        "displays:\n"
+        "  sRGB:\n"
+        "  - !<View> {name: Raw, colorspace: raw}\n"
+        "looks:\n"
+        "  - !<Look>\n"
+        "    name: look\n"
+        "    process_space: raw\n"
+        "    transform: !<FileTransform> {src: lut3d_1.spi3d}\n"
+        "colorspaces:\n"
+        "  - !<ColorSpace>\n"
+        "    name: raw\n"
+        "  - !<ColorSpace>\n"
+        "    name: lut\n"
+        "    to_reference: !<FileTransform> {src: lut1d_1.spi1d}\n";
+
+    OCIO::ConfigRcPtr config = CreateConfig(PROFILE)->createEditableCopy();
+
+    const std::string cacheID = config->getCacheID();
+    const std::string noContextCacheID = config->getCacheID(OCIO::ConstContextRcPtr());
+    OCIO_CHECK_NE(cacheID, noContextCacheID);
+    OCIO_CHECK_EQUAL(noContextCacheID.back(), ':');
+    OCIO_CHECK_EQUAL(cacheID.substr(0, noContextCacheID.size()), noContextCacheID);
+
+    // The cache identifier is the same as the one of an identical config.
+    OCIO_CHECK_EQUAL(cacheID, std::string(CreateConfig(PROFILE)->getCacheID()));
+
+    // Adding then removing an element gives back the same cache identifier.
+
+    OCIO::ColorSpaceRcPtr cs = OCIO::ColorSpace::Create();
+    cs->setName("new");
+    OCIO::FileTransformRcPtr missingFile = OCIO::FileTransform::Create();
+    missingFile->setSrc("missing.spi1d");
+    cs->setTransform(missingFile, OCIO::COLORSPACE_DIR_FROM_REFERENCE);
+    config->addColorSpace(cs);
+
+    const std::string newCacheID = config->getCacheID();
+    OCIO_CHECK_NE(newCacheID, cacheID);
+
+    config->removeColorSpace("new");
+    OCIO_CHECK_EQUAL(std::string(config->getCacheID()), cacheID);
+
+    // Replacing an element by an identical one does not change the cache identifier but any
+    // change of the element does.
+
+    OCIO::ColorSpaceRcPtr lut = config->getColorSpace("lut")->createEditableCopy();
+    config->addColorSpace(lut);
+    OCIO_CHECK_EQUAL(std::string(config->getCacheID()), cacheID);
+
+    lut->setFamily("family");
+    config->addColorSpace(lut);
+    OCIO_CHECK_NE(std::string(config->getCacheID()), cacheID);
+    OCIO_CHECK_NE(std::string(config->getCacheID(OCIO::ConstContextRcPtr())), noContextCacheID);
+
+    lut->setFamily("");
+    config->addColorSpace(lut);
+    OCIO_CHECK_EQUAL(std::string(config->getCacheID()), cacheID);
+
+    // The file references depend on the context.
+
+    OCIO::ContextRcPtr context = config->getCurrentContext()->createEditableCopy();
+    context->setSearchPath(".");
+    const std::string contextCacheID = config->getCacheID(context);
+    OCIO_CHECK_NE(contextCacheID, cacheID);
+    OCIO_CHECK_EQUAL(contextCacheID.substr(0, noContextCacheID.size()), noContextCacheID);
+
+    // Many file references are hashed in parallel.
+
+    for (int idx = 0; idx < 100; ++idx)
+    {
+        const std::string name = "cs" + std::to_string(idx);
+        OCIO::ColorSpaceRcPtr fileCS = OCIO::ColorSpace::Create();
+        fileCS->setName(name.c_str());
+
+        OCIO::FileTransformRcPtr file = OCIO::FileTransform::Create();
+        file->setSrc(idx % 2 ? "lut1d_1.spi1d" : (name + ".spi1d").c_str());
+        fileCS->setTransform(file, OCIO::COLORSPACE_DIR_TO_REFERENCE);
+        config->addColorSpace(fileCS);
+    }
+
+    const std::string manyFilesCacheID = config->getCacheID();
+    OCIO_CHECK_NE(manyFilesCacheID, cacheID);
+
+    std::vector<std::thread> threads;
+    std::vector<std::string> cacheIDs(8);
+    OCIO::ConstConfigRcPtr constConfig = config->createEditableCopy();
+    for (size_t idx = 0; idx < cacheIDs.size(); ++idx)
+    {
+        threads.emplace_back([&constConfig, &cacheIDs, idx]()
+        {
+            cacheIDs[idx] = constConfig->getCacheID();
+        });
+    }
+    for (auto & thread : threads)
+    {
+        thread.join();
+    }
+    for (const auto & id : cacheIDs)
+    {
+        OCIO_CHECK_EQUAL(id, manyFilesCacheID);
+    }
+}
+
+OCIO_ADD_TEST(Config, cache_id_benchmark)
+{
+    // Cache identifier of a config with many color spaces after a small edit.
+
+    std::ostringstream oss;
+    oss << "ocio_profile_version: 2\n"
+        << "roles:\n"
+        << "  default: raw\n"
+        << "displays:\n"
+        << "  sRGB:\n"
+        << "  - !<View> {name: Raw, colorspace: raw}\n"
+        << "colorspaces:\n"
+        << "  - !<ColorSpace>\n"
+        << "    name: raw\n";
+    for (int idx = 0; idx < 1000; ++idx)
+    {
+        oss << "  - !<ColorSpace>\n"
+            << "    name: cs" << idx << "\n"
+            << "    to_reference: !<GroupTransform>\n"
+            << "      children:\n"
+            << "        - !<MatrixTransform> {offset: [0.1, 0.2, 0.3, 0]}\n"
+            << "        - !<FileTransform> {src: lut" << idx << ".spi1d}\n"
+            << "        - !<CDLTransform> {slope: [1, 1.1, 1.2], power: [1.1, 1, 1], sat: 0.9}\n";
+    }
+
+    OCIO::ConfigRcPtr config = CreateConfig(oss.str())->createEditableCopy();
+
+    const auto firstStart = std::chrono::steady_clock::now();
+    const std::string cacheID = config->getCacheID();
+    const auto firstEnd = std::chrono::steady_clock::now();
+
+    OCIO::ColorSpaceRcPtr cs = config->getColorSpace("cs10")->createEditableCopy();
+    cs->setDescription("edited");
+    config->addColorSpace(cs);
+
+    const auto editStart = std::chrono::steady_clock::now();
+    OCIO_CHECK_NE(std::string(config->getCacheID()), cacheID);
+    const auto editEnd = std::chrono::steady_clock::now();
+
+    if (OCIO::GetLoggingLevel() >= OCIO::LOGGING_LEVEL_DEBUG)
+    {
+        std::ostringstream os;
+        os << "Config cache identifier: first "
+           << std::chrono::duration<double, std::milli>(firstEnd - firstStart).count()
+           << " ms, after an edit "
+           << std::chrono::duration<double, std::milli>(editEnd - editStart).count() << " ms";
+        OCIO::LogDebug(os.str());
+    }
+}
+
+OCIO_ADD_TEST(Config, shared_mutex)
+{
+    OCIO::SharedMutex mutex;
+
+    // Several readers at the same time.
+    mutex.lock_shared();
+    mutex.lock_shared();
+    mutex.unlock_shared();
+    mutex.unlock_shared();
+
+    // A writer waits for the readers and excludes everyone else.
+    int value = 0;
+    // The unit test checks are not thread-safe so the errors are only counted by the threads.
+    std::atomic<unsigned> numErrors{ 0 };
+    std::vector<std::thread> threads;
+    for (int idx = 0; idx < 8; ++idx)
+    {
+        threads.emplace_back([&mutex, &value, &numErrors, idx]()
+        {
+            for (int iter = 0; iter < 1000; ++iter)
+            {
+                if (idx % 2)
+                {
+                    OCIO::AutoExclusiveMutex lock(mutex);
+                    const int current = value;
+                    std::this_thread::yield();
+                    value = current + 1;
+                }
+                else
+                {
+                    OCIO::AutoSharedMutex lock(mutex);
+                    const int current = value;
+                    std::this_thread::yield();
+                    // No writer could change the value meanwhile.
+                    if (current != value || current < 0 || current > 4000)
+                    {
+                        ++numErrors;
+                    }
+                }
+            }
+        });
+    }
+    for (auto & thread : threads)
+    {
+        thread.join();
+    }
+
+    OCIO_CHECK_EQUAL(numErrors.load(), 0U);
+    OCIO_CHECK_EQUAL(value, 4000);
+}
+
+namespace
+{
+
+// Query the config from several threads at the same time and return the elapsed time.
+double RunConcurrentQueries(const OCIO::ConstConfigRcPtr & config,
+                            unsigned numThreads,
+                            unsigned numQueries,
+                            const std::string & expectedCacheID)
+{
+    std::atomic<unsigned> numErrors{ 0 };
+
+    const auto start = std::chrono::steady_clock::now();
+
+    std::vector<std::thread> threads;
+    for (unsigned idx = 0; idx < numThreads; ++idx)
+    {
+        threads.emplace_back([&]()
+        {
+            for (unsigned iter = 0; iter < numQueries; ++iter)
+            {
+                if (expectedCacheID != config->getCacheID()
+                    || config->getNumDisplays() != 2
+                    || std::string("disp2") != config->getDisplay(1)
+                    || !OCIO::GetCurrentConfig())
+                {
+                    ++numErrors;
+                }
+            }
+        });
+    }
+    for (auto & thread : threads)
+    {
+        thread.join();
+    }
+
+    const auto end = std::chrono::steady_clock::now();
+
+    OCIO_CHECK_EQUAL(numErrors.load(), 0);
+
+    return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+} // anon.
+
+OCIO_ADD_TEST(Config, concurrent_queries)
+{
+    // The read-mostly queries of a config are thread-safe and scale with the number of threads.
+
+    static const std::string CONFIG =
+        "ocio_profile_version: 2\n"
+        "search_path: " + std::string(OCIO::getTestFilesDir()) + "\n"
+        "roles:\n"
+        "  default: raw\n"
+        "displays:\n"
+        "  disp1:\n"
+        "  - !<View> {name: Raw, colorspace: raw}\n"
+        "  disp2:\n"
+        "  - !<View> {name: Lut, colorspace: lut1d}\n"
+        "colorspaces:\n"
+        "  - !<ColorSpace>\n"
+        "    name: raw\n"
+        "  - !<ColorSpace>\n"
+        "    name: lut1d\n"
+        "    to_reference: !<FileTransform> {src: lut1d_1.spi1d}\n";
+
+    const OCIO::ConstConfigRcPtr previousConfig = OCIO::GetCurrentConfig();
+
+    OCIO::ConstConfigRcPtr config = CreateConfig(CONFIG);
+    const std::string cacheID = config->getCacheID();
+
+    // The display cache & the cache identifiers are computed by the concurrent queries.
+    config = config->createEditableCopy();
+    OCIO::SetCurrentConfig(config);
+    RunConcurrentQueries(config, 16, 100, cacheID);
+
+    const unsigned numThreads
+        = std::max(2u, std::min(16u, std::thread::hardware_concurrency()));
+    static constexpr unsigned NumQueries = 20000;
+
+    const double singleThread = RunConcurrentQueries(config, 1, NumQueries, cacheID);
+    const double multiThreads = RunConcurrentQueries(config, numThreads, NumQueries, cacheID);
+
+    if (OCIO::GetLoggingLevel() >= OCIO::LOGGING_LEVEL_DEBUG)
+    {
+        std::ostringstream os;
+        os << "Config concurrent queries: " << NumQueries << " queries by 1 thread in "
+           << singleThread << " ms, by each of " << numThreads << " threads in "
+           << multiThreads << " ms";
+        OCIO::LogDebug(os.str());
+    }
+
+    OCIO::SetCurrentConfig(previousConfig);
+}
+
+OCIO_ADD_TEST(Config, preload_files)
+{
+    static const std::string CONFIG =
+        "ocio_profile_version: 2\n"
+        "search_path: " + std::string(OCIO::getTestFilesDir()) + "\n"
+        "roles:\n"
+        "  default: raw\n"
+        "  scene_linear: lin\n"
+        "displays:\n"
+        "  disp1:\n"
+        "  - !<View> {name: Raw, colorspace: raw}\n"
+        "  - !<View> {name: Lut3D, colorspace: lut3d}\n"
+        "  disp2:\n"
+        "  - !<View> {name: Lut1D, colorspace: lut1d, looks: cdl}\n"
+        "  - !<View> {name: Missing, colorspace: missing}\n"
+        "looks:\n"
+        "  - !<Look>\n"
+        "    name: cdl\n"
+        "    process_space: lin\n"
+        "    transform: !<FileTransform> {src: cdl_test1.ccc, cccid: cc0003}\n"
+        "colorspaces:\n"
+        "  - !<ColorSpace>\n"
+        "    name: raw\n"
+        "  - !<ColorSpace>\n"
+        "    name: lin\n"
+        "    to_reference: !<FileTransform> {src: camera_to_aces.spimtx}\n"
+        "  - !<ColorSpace>\n"
+        "    name: lut1d\n"
+        "    from_reference: !<FileTransform> {src: lut1d_1.spi1d, interpolation: linear}\n"
+        "  - !<ColorSpace>\n"
+        "    name: lut3d\n"
+        "    from_reference: !<FileTransform> {src: lut3d_1.spi3d, interpolation: linear}\n"
+        "  - !<ColorSpace>\n"
+        "    name: missing\n"
+        "    from_reference: !<FileTransform> {src: missing.spi1d}\n";
+
+    OCIO::ConstConfigRcPtr config = CreateConfig(CONFIG);
+
+    OCIO::ClearAllCaches();
+
+    // All the files are read, the missing one (which cannot be resolved) is ignored.
+    OCIO_CHECK_NO_THROW(config->preloadFiles(config->getCurrentContext(), 4, false));
+
+    size_t numFiles = 0, memory = 0, numHits = 0, numMisses = 0;
+    OCIO::GetFileCacheStats(numFiles, memory, numHits, numMisses);
+    OCIO_CHECK_EQUAL(numFiles, 4);
+    OCIO_CHECK_EQUAL(numMisses, 4);
+    OCIO_CHECK_EQUAL(numHits, 0);
+    OCIO_CHECK_EQUAL(OCIO::GetOpVecCacheSize(), 0);
+
+    // The processors then only use the cached files.
+    OCIO::ConstProcessorRcPtr proc;
+    OCIO_CHECK_NO_THROW(proc = config->getProcessor("lin", "disp2", "Lut1D"));
+    OCIO::GetFileCacheStats(numFiles, memory, numHits, numMisses);
+    OCIO_CHECK_EQUAL(numMisses, 4);
+    // The matrix file is used three times (including twice by the look process space).
+    OCIO_CHECK_EQUAL(numHits, 5);
+
+    OCIO_CHECK_THROW_WHAT(config->getProcessor("lin", "disp2", "Missing"), OCIO::Exception,
+                          "missing.spi1d");
+
+    // The display/view processors are built too.
+    OCIO::ClearAllCaches();
+    OCIO_CHECK_NO_THROW(config->preloadFiles(nullptr, 0, true));
+
+    OCIO::GetFileCacheStats(numFiles, memory, numHits, numMisses);
+    OCIO_CHECK_EQUAL(numFiles, 4);
+    OCIO_CHECK_EQUAL(numMisses, 4);
+    // The processors of the three valid display/view pairs.
+    OCIO_CHECK_EQUAL(OCIO::GetOpVecCacheSize(), 3);
+}
@@ -3,6 +3,10 @@
 
 
 #include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <thread>
 
 #include "Context.cpp"
 
@@ -146,3 +150,135 @@ OCIO_ADD_TEST(Context, use_searchpaths_workingdir)
                              SanitizePath(res2.c_str()).c_str()) == 0);
 }
 
+
+OCIO_ADD_TEST(Context, file_location_cache)
+{
+    const std::string filepath = OCIO::Platform::CreateTempFilename(".spi1d");
+    const std::string dirname  = pystring::os::path::dirname(filepath);
+    const std::string basename = pystring::os::path::basename(filepath);
+
+    OCIO::ContextRcPtr context = OCIO::Context::Create();
+    context->addSearchPath(dirname.c_str());
+    OCIO_CHECK_EQUAL(context->getFileLocationCacheTimeout(), 0.);
+
+    OCIO_CHECK_THROW_WHAT(context->resolveFileLocation(basename.c_str()),
+                          OCIO::ExceptionMissingFile,
+                          "could not be located");
+
+    {
+        std::ofstream file(filepath.c_str());
+        file << "Version 1";
+    }
+    OCIO::ClearCachesForFile(filepath.c_str());
+
+    // The file not found is cached.
+    OCIO_CHECK_THROW_WHAT(context->resolveFileLocation(basename.c_str()),
+                          OCIO::ExceptionMissingFile,
+                          "could not be located");
+
+    context->clearFileLocationCache();
+
+    std::string resolved;
+    OCIO_CHECK_NO_THROW(resolved = context->resolveFileLocation(basename.c_str()));
+    OCIO_CHECK_EQUAL(SanitizePath(resolved.c_str()), SanitizePath(filepath.c_str()));
+
+    // A copy keeps the cached lookups.
+    OCIO::ContextRcPtr copy = context->createEditableCopy();
+    OCIO_CHECK_NO_THROW(resolved = copy->resolveFileLocation(basename.c_str()));
+    OCIO_CHECK_EQUAL(SanitizePath(resolved.c_str()), SanitizePath(filepath.c_str()));
+
+    std::remove(filepath.c_str());
+    OCIO::ClearCachesForFile(filepath.c_str());
+
+    // The found file is cached too, until the entry expires.
+    OCIO_CHECK_NO_THROW(context->resolveFileLocation(basename.c_str()));
+
+    context->setFileLocationCacheTimeout(0.01);
+    OCIO_CHECK_EQUAL(context->getFileLocationCacheTimeout(), 0.01);
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+
+    OCIO_CHECK_THROW_WHAT(context->resolveFileLocation(basename.c_str()),
+                          OCIO::ExceptionMissingFile,
+                          "could not be located");
+
+    // Modifying the context resets the cache.
+    OCIO_CHECK_NO_THROW(copy->resolveFileLocation(basename.c_str()));
+    copy->setWorkingDir(dirname.c_str());
+    OCIO_CHECK_THROW(copy->resolveFileLocation(basename.c_str()), OCIO::ExceptionMissingFile);
+
+    // Absolute paths are cached as well.
+    OCIO_CHECK_THROW_WHAT(context->resolveFileLocation(filepath.c_str()),
+                          OCIO::Exception,
+                          "The specified absolute file reference");
+}
+
+OCIO_ADD_TEST(Context, file_location_cache_generation)
+{
+    // ClearCachesForFile only invalidates the data derived from the file content, whereas
+    // ClearAllCaches also invalidates the cached file lookups.
+
+    const std::string filepath = OCIO::Platform::CreateTempFilename(".spi1d");
+    const std::string dirname  = pystring::os::path::dirname(filepath);
+    const std::string basename = pystring::os::path::basename(filepath);
+
+    OCIO::ContextRcPtr context = OCIO::Context::Create();
+    context->addSearchPath(dirname.c_str());
+
+    OCIO_CHECK_THROW(context->resolveFileLocation(basename.c_str()), OCIO::ExceptionMissingFile);
+
+    {
+        std::ofstream file(filepath.c_str());
+        file << "Version 1";
+    }
+
+    const unsigned cachesGeneration = OCIO::GetCachesGeneration();
+    const unsigned lookupsGeneration = OCIO::GetFileLookupsGeneration();
+
+    OCIO::ClearCachesForFile(filepath.c_str());
+    OCIO_CHECK_EQUAL(OCIO::GetCachesGeneration(), cachesGeneration + 1);
+    OCIO_CHECK_EQUAL(OCIO::GetFileLookupsGeneration(), lookupsGeneration);
+    OCIO_CHECK_THROW(context->resolveFileLocation(basename.c_str()), OCIO::ExceptionMissingFile);
+
+    OCIO::ClearAllCaches();
+    OCIO_CHECK_EQUAL(OCIO::GetCachesGeneration(), cachesGeneration + 2);
+    OCIO_CHECK_EQUAL(OCIO::GetFileLookupsGeneration(), lookupsGeneration + 1);
+
+    std::string resolved;
+    OCIO_CHECK_NO_THROW(resolved = context->resolveFileLocation(basename.c_str()));
+    OCIO_CHECK_EQUAL(SanitizePath(resolved.c_str()), SanitizePath(filepath.c_str()));
+
+    std::remove(filepath.c_str());
+}
+
+OCIO_ADD_TEST(Context, search_path_listing)
+{
+    OCIO::ContextRcPtr context = OCIO::Context::Create();
+    context->setSearchPathListing(true);
+    OCIO_CHECK_ASSERT(context->isSearchPathListingEnabled());
+
+    const std::string searchPath1 = ociodir + "/tests/gpu";
+    const std::string searchPath2 = ociodir + "/src";
+    const std::string searchPath3 = ociodir + "/missing";
+    context->addSearchPath(searchPath1.c_str());
+    context->addSearchPath(searchPath2.c_str());
+    context->addSearchPath(searchPath3.c_str());
+
+    std::string resolvedSource;
+    OCIO_CHECK_NO_THROW(resolvedSource = context->resolveFileLocation("GPUHelpers.h"));
+    const std::string res1 = searchPath1 + "/GPUHelpers.h";
+    OCIO_CHECK_EQUAL(SanitizePath(resolvedSource.c_str()), SanitizePath(res1.c_str()));
+
+    // A file in a sub-directory of a search path.
+    OCIO_CHECK_NO_THROW(resolvedSource = context->resolveFileLocation("OpenColorIO/Context.cpp"));
+    const std::string res2 = searchPath2 + "/OpenColorIO/Context.cpp";
+    OCIO_CHECK_EQUAL(SanitizePath(resolvedSource.c_str()), SanitizePath(res2.c_str()));
+
+    OCIO_CHECK_THROW_WHAT(context->resolveFileLocation("Missing.cpp"),
+                          OCIO::ExceptionMissingFile,
+                          "could not be located");
+
+    context->setSearchPathListing(false);
+    OCIO_CHECK_ASSERT(!context->isSearchPathListingEnabled());
+    OCIO_CHECK_NO_THROW(resolvedSource = context->resolveFileLocation("OpenColorIO/Context.cpp"));
+    OCIO_CHECK_EQUAL(SanitizePath(resolvedSource.c_str()), SanitizePath(res2.c_str()));
+}
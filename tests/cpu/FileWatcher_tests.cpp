@@ -0,0 +1,143 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <thread>
+
+#include "FileWatcher.cpp"
+
+#include "Caching.h"
+#include "testutils/UnitTest.h"
+
+namespace OCIO = OCIO_NAMESPACE;
+
+
+namespace
+{
+
+void WriteLut(const std::string & filepath, float maxValue)
+{
+    // Replace the file as most of the editors do.
+    const std::string tmpFilepath = filepath + ".tmp";
+    {
+        std::ofstream file(tmpFilepath.c_str());
+        file << "Version 1\nFrom 0.0 1.0\nLength 2\nComponents 1\n{\n0.0\n" << maxValue << "\n}\n";
+    }
+    std::rename(tmpFilepath.c_str(), filepath.c_str());
+}
+
+float ApplyLut(const OCIO::ConstConfigRcPtr & config, const std::string & filepath)
+{
+    OCIO::FileTransformRcPtr file = OCIO::FileTransform::Create();
+    file->setSrc(filepath.c_str());
+    file->setInterpolation(OCIO::INTERP_LINEAR);
+
+    float pixel[3] = { 1.0f, 1.0f, 1.0f };
+    config->getProcessor(file)->getDefaultCPUProcessor()->applyRGB(pixel);
+    return pixel[0];
+}
+
+size_t GetNumCachedFiles()
+{
+    size_t numFiles = 0, memory = 0, numHits = 0, numMisses = 0;
+    OCIO::GetFileCacheStats(numFiles, memory, numHits, numMisses);
+    return numFiles;
+}
+
+// Wait for the file cache to be cleared by the file watch.
+bool WaitForFileChange()
+{
+    for (int i = 0; i < 500; ++i)
+    {
+        OCIO::ProcessFileChanges();
+        if (GetNumCachedFiles() == 0)
+        {
+            return true;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    return false;
+}
+
+void ValidateFileWatch(OCIO::FileWatchMode mode)
+{
+    OCIO::ClearAllCaches();
+    OCIO::SetFileWatchMode(mode);
+    OCIO_CHECK_EQUAL(OCIO::GetFileWatchMode(), mode);
+
+    const std::string filepath = OCIO::Platform::CreateTempFilename(".spi1d");
+    WriteLut(filepath, 0.5f);
+
+    OCIO::ConstConfigRcPtr config = OCIO::Config::CreateRaw();
+    OCIO_CHECK_EQUAL(ApplyLut(config, filepath), 0.5f);
+    OCIO_CHECK_EQUAL(GetNumCachedFiles(), 1);
+    OCIO_CHECK_EQUAL(OCIO::GetNumWatchedFiles(), 1);
+
+    OCIO_CHECK_EQUAL(OCIO::ProcessFileChanges(), 0);
+    OCIO_CHECK_EQUAL(GetNumCachedFiles(), 1);
+
+    const unsigned generation = OCIO::GetCachesGeneration();
+
+    WriteLut(filepath, 0.25f);
+    OCIO_CHECK_ASSERT(WaitForFileChange());
+    OCIO_CHECK_NE(OCIO::GetCachesGeneration(), generation);
+
+    OCIO_CHECK_EQUAL(ApplyLut(config, filepath), 0.25f);
+
+#ifdef __linux__
+    if (mode == OCIO::FILE_WATCH_NOTIFY)
+    {
+        // The notifications do not depend on the file modification time.
+        {
+            std::ofstream file(filepath.c_str());
+            file << "Version 1\nFrom 0.0 1.0\nLength 2\nComponents 1\n{\n0.0\n0.75\n}\n";
+        }
+        OCIO_CHECK_ASSERT(WaitForFileChange());
+        OCIO_CHECK_EQUAL(ApplyLut(config, filepath), 0.75f);
+    }
+#endif
+
+    std::remove(filepath.c_str());
+    OCIO_CHECK_ASSERT(WaitForFileChange());
+
+    OCIO::ClearAllCaches();
+    OCIO_CHECK_EQUAL(OCIO::GetNumWatchedFiles(), 0);
+
+    OCIO::SetFileWatchMode(OCIO::FILE_WATCH_NONE);
+}
+
+} // anon.
+
+OCIO_ADD_TEST(FileWatcher, poll)
+{
+    ValidateFileWatch(OCIO::FILE_WATCH_POLL);
+}
+
+OCIO_ADD_TEST(FileWatcher, notify)
+{
+    ValidateFileWatch(OCIO::FILE_WATCH_NOTIFY);
+}
+
+OCIO_ADD_TEST(FileWatcher, enable)
+{
+    OCIO::SetFileWatchEnabled(false);
+    OCIO_CHECK_ASSERT(!OCIO::IsFileWatchEnabled());
+
+    OCIO::WatchFile("file.spi1d", "1:2");
+    OCIO_CHECK_EQUAL(OCIO::GetNumWatchedFiles(), 0);
+
+    OCIO::SetFileWatchEnabled(true);
+    OCIO_CHECK_ASSERT(OCIO::IsFileWatchEnabled());
+    OCIO_CHECK_EQUAL(OCIO::GetFileWatchMode(), OCIO::FILE_WATCH_NOTIFY);
+
+    OCIO::WatchFile("file.spi1d", "1:2");
+    OCIO_CHECK_EQUAL(OCIO::GetNumWatchedFiles(), 1);
+
+    // The mode changes remove the watched files.
+    OCIO::SetFileWatchEnabled(false);
+    OCIO_CHECK_ASSERT(!OCIO::IsFileWatchEnabled());
+    OCIO_CHECK_EQUAL(OCIO::GetNumWatchedFiles(), 0);
+}
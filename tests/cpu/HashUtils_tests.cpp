@@ -0,0 +1,138 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+
+#include <chrono>
+
+#include "HashUtils.cpp"
+
+#include "Logging.h"
+#include "md5/md5.h"
+#include "ops/lut3d/Lut3DOpData.h"
+#include "testutils/UnitTest.h"
+
+namespace OCIO = OCIO_NAMESPACE;
+
+
+OCIO_ADD_TEST(HashUtils, murmur3_verification)
+{
+    // The SMHasher verification test: hash the keys {0}, {0, 1}, ... {0, 1, ..., 254}
+    // using 256-N as the seed, then hash the concatenated results.
+
+    std::vector<OCIO::murmur3_byte_t> key(256);
+    std::vector<OCIO::murmur3_byte_t> hashes(16 * 256);
+
+    for (int i = 0; i < 256; ++i)
+    {
+        key[i] = (OCIO::murmur3_byte_t)i;
+
+        OCIO::murmur3_state_t state;
+        OCIO::murmur3_init(&state, 256 - i);
+        OCIO::murmur3_append(&state, key.data(), i);
+        OCIO::murmur3_finish(&state, &hashes[i * 16]);
+    }
+
+    OCIO::murmur3_state_t state;
+    OCIO::murmur3_init(&state, 0);
+    OCIO::murmur3_append(&state, hashes.data(), hashes.size());
+
+    OCIO::murmur3_byte_t digest[16];
+    OCIO::murmur3_finish(&state, digest);
+
+    const unsigned verification = digest[0] | (digest[1] << 8) | (digest[2] << 16)
+                                  | ((unsigned)digest[3] << 24);
+    OCIO_CHECK_EQUAL(verification, 0x6384BA69u);
+}
+
+OCIO_ADD_TEST(HashUtils, incremental)
+{
+    std::string str;
+    for (int i = 0; i < 100; ++i)
+    {
+        str += char('a' + i % 26);
+    }
+
+    const std::string hash = OCIO::CacheIDHash(str.c_str(), str.size());
+    OCIO_CHECK_EQUAL(hash.size(), 33);
+    OCIO_CHECK_EQUAL(hash[0], '$');
+
+    // Appending the data in pieces of any size gives the same hash.
+    for (size_t pieceSize = 1; pieceSize < 40; ++pieceSize)
+    {
+        OCIO::CacheIDHasher hasher;
+        for (size_t pos = 0; pos < str.size(); pos += pieceSize)
+        {
+            hasher.append(str.substr(pos, pieceSize));
+        }
+        OCIO_CHECK_EQUAL(hasher.getPrintableHash(), hash);
+    }
+
+    // The hash of a prefix does not prevent from appending more data.
+    OCIO::CacheIDHasher hasher;
+    hasher.append(str.substr(0, 50));
+    OCIO_CHECK_EQUAL(hasher.getPrintableHash(), OCIO::CacheIDHash(str.c_str(), 50));
+    hasher.append(str.substr(50));
+    OCIO_CHECK_EQUAL(hasher.getPrintableHash(), hash);
+
+    OCIO_CHECK_NE(OCIO::CacheIDHash(str.c_str(), 99), hash);
+    OCIO_CHECK_EQUAL(OCIO::CacheIDHash("", 0), OCIO::CacheIDHasher().getPrintableHash());
+}
+
+namespace
+{
+
+template<typename Func>
+double MeasureMicroSeconds(unsigned iterations, Func func)
+{
+    const auto start = std::chrono::steady_clock::now();
+    for (unsigned i = 0; i < iterations; ++i)
+    {
+        func();
+    }
+    const auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::micro>(end - start).count() / iterations;
+}
+
+} // anon.
+
+OCIO_ADD_TEST(HashUtils, benchmark)
+{
+    // Compare the cache identifier computation of a 65x65x65 3D LUT (i.e. 3.3 MB) with the
+    // MD5 hash previously used.
+
+    OCIO::Lut3DOpData lut(65);
+    const OCIO::Array::Values & values = lut.getArray().getValues();
+    const size_t size = values.size() * sizeof(float);
+
+    const unsigned iterations = 10;
+
+    const double md5Time = MeasureMicroSeconds(iterations, [&values, size]()
+    {
+        OCIO::md5_state_t state;
+        OCIO::md5_byte_t digest[16];
+
+        OCIO::md5_init(&state);
+        OCIO::md5_append(&state, (const OCIO::md5_byte_t *)values.data(), (int)size);
+        OCIO::md5_finish(&state, digest);
+    });
+
+    const double hashTime = MeasureMicroSeconds(iterations, [&values, size]()
+    {
+        OCIO::CacheIDHash((const char *)values.data(), size);
+    });
+
+    const double finalizeTime = MeasureMicroSeconds(iterations, [&lut]()
+    {
+        lut.finalize();
+    });
+
+    if (OCIO::GetLoggingLevel() >= OCIO::LOGGING_LEVEL_DEBUG)
+    {
+        std::ostringstream oss;
+        oss << "Cache ID of a 65^3 LUT: MD5 " << md5Time << " us, hash " << hashTime
+            << " us, Lut3DOpData::finalize " << finalizeTime << " us.";
+        OCIO::LogDebug(oss.str());
+    }
+
+    OCIO_CHECK_LT(hashTime, md5Time);
+}
@@ -0,0 +1,124 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+
+#include "LazyTransform.cpp"
+
+#include "testutils/UnitTest.h"
+
+namespace OCIO = OCIO_NAMESPACE;
+
+
+OCIO_ADD_TEST(LazyTransform, basic)
+{
+    OCIO::LazyTransform lazy;
+    OCIO_CHECK_ASSERT(!lazy.get());
+
+    // The loader is only called on first access.
+
+    int numCalls = 0;
+    lazy.setLoader([&numCalls]()
+    {
+        ++numCalls;
+        OCIO::ExponentTransformRcPtr exp = OCIO::ExponentTransform::Create();
+        const double values[4] = { 2.2, 2.2, 2.2, 1. };
+        exp->setValue(values);
+        return exp;
+    });
+    OCIO_CHECK_EQUAL(numCalls, 0);
+
+    // A copy shares the loader while the transform is not built.
+
+    OCIO::LazyTransform copy1;
+    copy1 = lazy;
+    OCIO_CHECK_EQUAL(numCalls, 0);
+
+    OCIO::ConstTransformRcPtr t = lazy.get();
+    OCIO_REQUIRE_ASSERT(t);
+    OCIO_CHECK_EQUAL(numCalls, 1);
+    OCIO_CHECK_EQUAL(lazy.get(), t);
+    OCIO_CHECK_EQUAL(numCalls, 1);
+
+    OCIO_REQUIRE_ASSERT(copy1.get());
+    OCIO_CHECK_EQUAL(numCalls, 2);
+    OCIO_CHECK_NE(copy1.get(), t);
+
+    // Once built, a copy is a deep copy of the transform.
+
+    OCIO::LazyTransform copy2;
+    copy2 = lazy;
+    OCIO_CHECK_EQUAL(numCalls, 2);
+    OCIO_REQUIRE_ASSERT(copy2.get());
+    OCIO_CHECK_NE(copy2.get(), t);
+    OCIO_CHECK_ASSERT(OCIO_DYNAMIC_POINTER_CAST<OCIO::ExponentTransform>(copy2.get()));
+
+    // Setting a transform drops the loader.
+
+    copy1.setLoader([&numCalls]() { ++numCalls; return OCIO::TransformRcPtr(); });
+    copy1.set(OCIO::MatrixTransform::Create());
+    OCIO_REQUIRE_ASSERT(copy1.get());
+    OCIO_CHECK_ASSERT(OCIO_DYNAMIC_POINTER_CAST<OCIO::MatrixTransform>(copy1.get()));
+    OCIO_CHECK_EQUAL(numCalls, 2);
+}
+
+OCIO_ADD_TEST(LazyTransform, loader_error)
+{
+    // A failing loader throws on each access until it succeeds.
+
+    int numCalls = 0;
+    OCIO::LazyTransform lazy;
+    lazy.setLoader([&numCalls]()
+    {
+        if (++numCalls < 3)
+        {
+            throw OCIO::Exception("Loading failed.");
+        }
+        return OCIO::MatrixTransform::Create();
+    });
+
+    OCIO_CHECK_THROW_WHAT(lazy.get(), OCIO::Exception, "Loading failed.");
+    OCIO_CHECK_THROW_WHAT(lazy.get(), OCIO::Exception, "Loading failed.");
+    OCIO_CHECK_ASSERT(lazy.get());
+    OCIO_CHECK_EQUAL(numCalls, 3);
+}
+
+OCIO_ADD_TEST(LazyTransform, set_transform_loader)
+{
+    // The loaders go through the public setters of the config elements.
+
+    int numCalls = 0;
+    const OCIO::TransformLoader loader = [&numCalls]()
+    {
+        ++numCalls;
+        return OCIO::MatrixTransform::Create();
+    };
+
+    OCIO::ColorSpaceRcPtr cs = OCIO::ColorSpace::Create();
+    OCIO::SetTransformLoader(*cs, OCIO::COLORSPACE_DIR_FROM_REFERENCE, loader);
+
+    OCIO::LookRcPtr look = OCIO::Look::Create();
+    OCIO::SetTransformLoader(*look, OCIO::TRANSFORM_DIR_INVERSE, loader);
+
+    OCIO::ViewTransformRcPtr vt = OCIO::ViewTransform::Create(OCIO::REFERENCE_SPACE_SCENE);
+    OCIO::SetTransformLoader(*vt, OCIO::VIEWTRANSFORM_DIR_TO_REFERENCE, loader);
+
+    OCIO_CHECK_EQUAL(numCalls, 0);
+
+    OCIO_CHECK_ASSERT(!cs->getTransform(OCIO::COLORSPACE_DIR_TO_REFERENCE));
+    OCIO_CHECK_ASSERT(OCIO_DYNAMIC_POINTER_CAST<const OCIO::MatrixTransform>(
+        cs->getTransform(OCIO::COLORSPACE_DIR_FROM_REFERENCE)));
+    OCIO_CHECK_EQUAL(numCalls, 1);
+
+    OCIO_CHECK_ASSERT(!look->getTransform());
+    OCIO_CHECK_ASSERT(OCIO_DYNAMIC_POINTER_CAST<const OCIO::MatrixTransform>(
+        look->getInverseTransform()));
+    OCIO_CHECK_EQUAL(numCalls, 2);
+
+    OCIO_CHECK_ASSERT(!vt->getTransform(OCIO::VIEWTRANSFORM_DIR_FROM_REFERENCE));
+    OCIO_CHECK_ASSERT(OCIO_DYNAMIC_POINTER_CAST<const OCIO::MatrixTransform>(
+        vt->getTransform(OCIO::VIEWTRANSFORM_DIR_TO_REFERENCE)));
+    OCIO_CHECK_EQUAL(numCalls, 3);
+
+    OCIO_CHECK_THROW_WHAT(OCIO::SetTransformLoader(*look, OCIO::TRANSFORM_DIR_UNKNOWN, loader),
+                          OCIO::Exception, "Unspecified TransformDirection");
+}
@@ -0,0 +1,112 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+
+#include "OpCostModel.cpp"
+
+#include "ops/lut1d/Lut1DOp.h"
+#include "ops/matrix/MatrixOp.h"
+#include "ops/noop/NoOps.h"
+#include "testutils/UnitTest.h"
+
+namespace OCIO = OCIO_NAMESPACE;
+
+
+OCIO_ADD_TEST(OpCostModel, default_costs)
+{
+    OCIO::ResetOpCostTable();
+
+    for (int entry = 0; entry < OCIO::OP_COST_NUM_ENTRIES; ++entry)
+    {
+        OCIO_CHECK_GT(OCIO::GetOpCost(OCIO::OpCostEntry(entry)), 0.0f);
+    }
+
+    OCIO_CHECK_EQUAL(OCIO::GetOpCost(OCIO::OP_COST_MATRIX), 1.0f);
+    OCIO_CHECK_LT(OCIO::GetOpCost(OCIO::OP_COST_LUT1D), OCIO::GetOpCost(OCIO::OP_COST_LUT1D_INVERSE));
+    OCIO_CHECK_LT(OCIO::GetOpCost(OCIO::OP_COST_LUT3D), OCIO::GetOpCost(OCIO::OP_COST_LUT3D_INVERSE));
+
+    OCIO::OpRcPtrVec ops;
+
+    OCIO::MatrixOpDataRcPtr matrix = std::make_shared<OCIO::MatrixOpData>();
+    matrix->setArrayValue(1, 0.5);
+    OCIO_CHECK_NO_THROW(OCIO::CreateMatrixOp(ops, matrix, OCIO::TRANSFORM_DIR_FORWARD));
+
+    OCIO::Lut1DOpDataRcPtr lut = std::make_shared<OCIO::Lut1DOpData>(16);
+    OCIO_CHECK_NO_THROW(OCIO::CreateLut1DOp(ops, lut, OCIO::TRANSFORM_DIR_FORWARD));
+    OCIO_CHECK_NO_THROW(OCIO::CreateLut1DOp(ops, lut, OCIO::TRANSFORM_DIR_INVERSE));
+
+    OCIO_CHECK_NO_THROW(OCIO::CreateFileNoOp(ops, "lut.clf"));
+    OCIO_REQUIRE_EQUAL(ops.size(), 4);
+
+    OCIO_CHECK_EQUAL(OCIO::GetOpCost(OCIO::ConstOpRcPtr(ops[0])),
+                     OCIO::GetOpCost(OCIO::OP_COST_MATRIX));
+    OCIO_CHECK_EQUAL(OCIO::GetOpCost(OCIO::ConstOpRcPtr(ops[1])),
+                     OCIO::GetOpCost(OCIO::OP_COST_LUT1D));
+    OCIO_CHECK_EQUAL(OCIO::GetOpCost(OCIO::ConstOpRcPtr(ops[2])),
+                     OCIO::GetOpCost(OCIO::OP_COST_LUT1D_INVERSE));
+    // No-op types are free.
+    OCIO_CHECK_EQUAL(OCIO::GetOpCost(OCIO::ConstOpRcPtr(ops[3])), 0.0f);
+
+    OCIO_CHECK_EQUAL(OCIO::GetOpVecCost(ops),
+                     OCIO::GetOpCost(OCIO::OP_COST_MATRIX)
+                     + OCIO::GetOpCost(OCIO::OP_COST_LUT1D)
+                     + OCIO::GetOpCost(OCIO::OP_COST_LUT1D_INVERSE));
+}
+
+OCIO_ADD_TEST(OpCostModel, load_table)
+{
+    OCIO::ResetOpCostTable();
+    OCIO_CHECK_ASSERT(!OCIO::IsOpCostTableLoaded());
+
+    const float lut3DCost = OCIO::GetOpCost(OCIO::OP_COST_LUT3D);
+
+    {
+        std::istringstream iss;
+        iss.str("# Generated by 'ocioperf --calibrate'.\n"
+                "\n"
+                "Matrix 1\n"
+                "  log   0.25  # Op types are case insensitive.\n"
+                "Lut1D 2.5\n");
+
+        OCIO_CHECK_NO_THROW(OCIO::LoadOpCostTable(iss));
+    }
+
+    OCIO_CHECK_ASSERT(OCIO::IsOpCostTableLoaded());
+    OCIO_CHECK_EQUAL(OCIO::GetOpCost(OCIO::OP_COST_LOG), 0.25f);
+    OCIO_CHECK_EQUAL(OCIO::GetOpCost(OCIO::OP_COST_LUT1D), 2.5f);
+    // Missing types keep their cost.
+    OCIO_CHECK_EQUAL(OCIO::GetOpCost(OCIO::OP_COST_LUT3D), lut3DCost);
+
+    // An invalid table does not change any cost.
+
+    {
+        std::istringstream iss;
+        iss.str("Log 4\n"
+                "Lut2D 1\n");
+
+        OCIO_CHECK_THROW_WHAT(OCIO::LoadOpCostTable(iss), OCIO::Exception,
+                              "Invalid op cost table at line 2: 'Lut2D 1'");
+    }
+    OCIO_CHECK_EQUAL(OCIO::GetOpCost(OCIO::OP_COST_LOG), 0.25f);
+
+    {
+        std::istringstream iss;
+        iss.str("Log 0\n");
+
+        OCIO_CHECK_THROW_WHAT(OCIO::LoadOpCostTable(iss), OCIO::Exception,
+                              "Expecting '<op type> <positive cost>'");
+    }
+
+    {
+        std::istringstream iss;
+        iss.str("Log 1 2\n");
+
+        OCIO_CHECK_THROW_WHAT(OCIO::LoadOpCostTable(iss), OCIO::Exception,
+                              "Invalid op cost table at line 1");
+    }
+    OCIO_CHECK_EQUAL(OCIO::GetOpCost(OCIO::OP_COST_LOG), 0.25f);
+
+    OCIO::ResetOpCostTable();
+    OCIO_CHECK_NE(OCIO::GetOpCost(OCIO::OP_COST_LOG), 0.25f);
+    OCIO_CHECK_ASSERT(!OCIO::IsOpCostTableLoaded());
+}
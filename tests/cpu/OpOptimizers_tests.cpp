@@ -2,6 +2,8 @@
 // Copyright Contributors to the OpenColorIO Project.
 
 
+#include <chrono>
+
 #include "OpOptimizers.cpp"
 
 #include "ops/cdl/CDLOp.h"
@@ -1041,6 +1043,220 @@ OCIO_ADD_TEST(OpOptimizers, range_lut)
     CompareRender(ops, optOps, __LINE__, 1e-6f);
 }
 
+OCIO_ADD_TEST(OpOptimizers, lut3d_absorption)
+{
+    // Matrix, Range & Lut1D ops following a Lut3D are applied to the lattice entries.
+
+    auto lut3d = std::make_shared<OCIO::Lut3DOpData>(17);
+    for (auto & val : lut3d->getArray().getValues())
+    {
+        val = 0.8f * val + 0.1f * val * val;
+    }
+
+    auto lut1d = std::make_shared<OCIO::Lut1DOpData>(1024);
+    for (auto & val : lut1d->getArray().getValues())
+    {
+        val = std::pow(val, 0.8f);
+    }
+
+    const double m44[16] = { 0.9, 0.1, 0.0, 0.0,
+                             0.0, 1.1, 0.0, 0.0,
+                             0.1, 0.1, 0.8, 0.0,
+                             0.0, 0.0, 0.0, 1.0 };
+
+    // Does not clamp any of the lattice entries.
+    auto rangeNoClamp = std::make_shared<OCIO::RangeOpData>(-0.5, 1.5, -0.5, 1.5);
+    // Clamps some of the lattice entries.
+    auto rangeClamp = std::make_shared<OCIO::RangeOpData>(0.1, 0.9, 0.1, 0.9);
+
+    OCIO::OpRcPtrVec ops;
+    OCIO_CHECK_NO_THROW(OCIO::CreateLut3DOp(ops, lut3d, OCIO::TRANSFORM_DIR_FORWARD));
+    OCIO_CHECK_NO_THROW(OCIO::CreateMatrixOp(ops, m44, OCIO::TRANSFORM_DIR_FORWARD));
+    OCIO_CHECK_NO_THROW(OCIO::CreateRangeOp(ops, rangeNoClamp, OCIO::TRANSFORM_DIR_FORWARD));
+    OCIO_CHECK_NO_THROW(OCIO::CreateLut1DOp(ops, lut1d, OCIO::TRANSFORM_DIR_FORWARD));
+    OCIO_CHECK_NO_THROW(OCIO::CreateRangeOp(ops, rangeClamp, OCIO::TRANSFORM_DIR_FORWARD));
+    OCIO_CHECK_EQUAL(ops.size(), 5);
+
+    // The lossless absorptions only.
+    {
+        OCIO::OpRcPtrVec optOps = ops.clone();
+        OCIO_CHECK_NO_THROW(OCIO::OptimizeOpVec(optOps, OCIO::BIT_DEPTH_F32, OCIO::BIT_DEPTH_F32,
+                                                OCIO::OPTIMIZATION_LOSSLESS));
+        OCIO_REQUIRE_EQUAL(optOps.size(), 3);
+        OCIO_CHECK_EQUAL(optOps[0]->getInfo(), "<Lut3DOp>");
+        OCIO_CHECK_EQUAL(optOps[1]->getInfo(), "<Lut1DOp>");
+        OCIO_CHECK_EQUAL(optOps[2]->getInfo(), "<RangeOp>");
+
+        CompareRender(ops, optOps, __LINE__, 1e-6f);
+    }
+
+    // The lossy absorptions are enabled along with the Lut3D composition.
+    {
+        OCIO::OpRcPtrVec optOps = ops.clone();
+        OCIO_CHECK_NO_THROW(OCIO::OptimizeOpVec(optOps, OCIO::BIT_DEPTH_F32, OCIO::BIT_DEPTH_F32,
+                                                OCIO::OPTIMIZATION_GOOD));
+        OCIO_REQUIRE_EQUAL(optOps.size(), 1);
+        OCIO_CHECK_EQUAL(optOps[0]->getInfo(), "<Lut3DOp>");
+
+        CompareRender(ops, optOps, __LINE__, 2e-2f);
+    }
+
+    // An inverse Lut3D does not absorb anything.
+    {
+        OCIO::OpRcPtrVec invOps;
+        OCIO_CHECK_NO_THROW(OCIO::CreateLut3DOp(invOps, lut3d, OCIO::TRANSFORM_DIR_INVERSE));
+        OCIO_CHECK_NO_THROW(OCIO::CreateMatrixOp(invOps, m44, OCIO::TRANSFORM_DIR_FORWARD));
+
+        OCIO_CHECK_NO_THROW(OCIO::OptimizeOpVec(invOps, OCIO::BIT_DEPTH_F32, OCIO::BIT_DEPTH_F32,
+                                                OCIO::OPTIMIZATION_GOOD));
+        OCIO_CHECK_EQUAL(invOps.size(), 2);
+    }
+
+    // A matrix changing the alpha is not absorbed.
+    {
+        const double m44Alpha[16] = { 0.9, 0.1, 0.0, 0.0,
+                                      0.0, 1.1, 0.0, 0.0,
+                                      0.1, 0.1, 0.8, 0.0,
+                                      0.0, 0.0, 0.0, 0.5 };
+
+        OCIO::OpRcPtrVec alphaOps;
+        OCIO_CHECK_NO_THROW(OCIO::CreateLut3DOp(alphaOps, lut3d, OCIO::TRANSFORM_DIR_FORWARD));
+        OCIO_CHECK_NO_THROW(OCIO::CreateMatrixOp(alphaOps, m44Alpha,
+                                                 OCIO::TRANSFORM_DIR_FORWARD));
+
+        OCIO::OpRcPtrVec optOps = alphaOps.clone();
+        OCIO_CHECK_NO_THROW(OCIO::OptimizeOpVec(optOps, OCIO::BIT_DEPTH_F32, OCIO::BIT_DEPTH_F32,
+                                                OCIO::OPTIMIZATION_GOOD));
+        OCIO_REQUIRE_EQUAL(optOps.size(), 2);
+        OCIO_CHECK_EQUAL(optOps[0]->getInfo(), "<Lut3DOp>");
+        OCIO_CHECK_EQUAL(optOps[1]->getInfo(), "<MatrixOffsetOp>");
+
+        CompareRender(alphaOps, optOps, __LINE__, 1e-6f);
+    }
+}
+
+namespace
+{
+
+// A long chain of ops (e.g. from a large CTF file) where most of the ops cannot be optimized
+// and where the nested inverse pairs need several passes to be removed.
+void CreateLongChain(OCIO::OpRcPtrVec & ops, unsigned numBlocks)
+{
+    const double m44[16] = { 0.9, 0.1, 0.0, 0.0,
+                             0.0, 1.1, 0.0, 0.0,
+                             0.1, 0.1, 0.8, 0.0,
+                             0.0, 0.0, 0.0, 1.0 };
+
+    for (unsigned i = 0; i < numBlocks; ++i)
+    {
+        auto lut1d = std::make_shared<OCIO::Lut1DOpData>(1024);
+        for (auto & val : lut1d->getArray().getValues())
+        {
+            val = std::pow(val, 0.8f + 0.001f * i);
+        }
+
+        // Only changes the highlights so the identity check must go through most of the LUT.
+        auto shaper = std::make_shared<OCIO::Lut1DOpData>(OCIO::Lut1DOpData::LUT_INPUT_HALF_CODE,
+                                                          65536);
+        auto & values = shaper->getArray().getValues();
+        for (size_t idx = 0; idx < values.size(); ++idx)
+        {
+            if (values[idx] > 100.0f + i)
+            {
+                values[idx] = 100.0f + i;
+            }
+        }
+
+        auto lut3d = std::make_shared<OCIO::Lut3DOpData>(17);
+        for (auto & val : lut3d->getArray().getValues())
+        {
+            val = 0.8f * val + 0.001f * i;
+        }
+
+        // Clamps some of the lattice entries.
+        auto range = std::make_shared<OCIO::RangeOpData>(0.1, 0.9, 0.1, 0.9);
+
+        const double base = 2.0 + 0.01 * i;
+
+        OCIO::CreateLut1DOp(ops, shaper, OCIO::TRANSFORM_DIR_FORWARD);
+        OCIO::CreateLut1DOp(ops, lut1d, OCIO::TRANSFORM_DIR_FORWARD);
+        OCIO::CreateLut3DOp(ops, lut3d, OCIO::TRANSFORM_DIR_FORWARD);
+        OCIO::CreateRangeOp(ops, range, OCIO::TRANSFORM_DIR_FORWARD);
+        OCIO::CreateLogOp(ops, base, OCIO::TRANSFORM_DIR_FORWARD);
+        OCIO::CreateMatrixOp(ops, m44, OCIO::TRANSFORM_DIR_FORWARD);
+        OCIO::CreateMatrixOp(ops, m44, OCIO::TRANSFORM_DIR_INVERSE);
+        OCIO::CreateLogOp(ops, base, OCIO::TRANSFORM_DIR_INVERSE);
+        OCIO::CreateFixedFunctionOp(ops, {}, OCIO::FixedFunctionOpData::RGB_TO_HSV);
+    }
+}
+
+} // anon.
+
+OCIO_ADD_TEST(OpOptimizers, long_chain)
+{
+    // The optimization passes only revisit the changed ops but must give the same result as
+    // checking all the ops at each pass.
+
+    OCIO::OpRcPtrVec ops;
+    CreateLongChain(ops, 100);
+    OCIO_REQUIRE_EQUAL(ops.size(), 900);
+
+    for (const auto flags : { OCIO::OPTIMIZATION_LOSSLESS, OCIO::OPTIMIZATION_GOOD })
+    {
+        OCIO::OpRcPtrVec allOps = ops.clone();
+        OCIO::OptimizationStats allStats;
+
+        const auto start = std::chrono::steady_clock::now();
+        OCIO::OptimizeOpVecPasses(allOps, flags, nullptr, allStats);
+        const auto mid = std::chrono::steady_clock::now();
+
+        OCIO::OpRcPtrVec changedOps = ops.clone();
+        OCIO::OptimizationStats changedStats;
+        OCIO::RejectedOptimizations rejected(changedOps.size());
+        OCIO::OptimizeOpVecPasses(changedOps, flags, &rejected, changedStats);
+        const auto end = std::chrono::steady_clock::now();
+
+        OCIO_CHECK_GT(allStats.m_passes, 1);
+        OCIO_CHECK_EQUAL(allStats.m_passes, changedStats.m_passes);
+        OCIO_CHECK_EQUAL(allStats.m_noops, changedStats.m_noops);
+        OCIO_CHECK_EQUAL(allStats.m_identityops, changedStats.m_identityops);
+        OCIO_CHECK_EQUAL(allStats.m_inverseops, changedStats.m_inverseops);
+        OCIO_CHECK_EQUAL(allStats.m_combines, changedStats.m_combines);
+
+        OCIO_CHECK_NO_THROW(allOps.finalize(flags));
+        OCIO_CHECK_NO_THROW(changedOps.finalize(flags));
+
+        OCIO_REQUIRE_EQUAL(allOps.size(), changedOps.size());
+        for (size_t idx = 0; idx < allOps.size(); ++idx)
+        {
+            OCIO_CHECK_EQUAL(allOps[idx]->getCacheID(), changedOps[idx]->getCacheID());
+        }
+
+        if (OCIO::IsDebugLoggingEnabled())
+        {
+            std::ostringstream oss;
+            oss << "Optimizing " << ops.size() << " ops: "
+                << std::chrono::duration<double, std::milli>(mid - start).count()
+                << " ms when checking all the ops at each pass, "
+                << std::chrono::duration<double, std::milli>(end - mid).count()
+                << " ms when only checking the changed ops.";
+            OCIO::LogDebug(oss.str());
+        }
+    }
+
+    // Check the result of the complete optimization.
+
+    OCIO::OpRcPtrVec optOps = ops.clone();
+    OCIO_CHECK_NO_THROW(OCIO::OptimizeOpVec(optOps, OCIO::BIT_DEPTH_F32, OCIO::BIT_DEPTH_F32,
+                                            OCIO::OPTIMIZATION_LOSSLESS));
+    OCIO_REQUIRE_EQUAL(optOps.size(), 500);
+    OCIO_CHECK_EQUAL(optOps[0]->getInfo(), "<Lut1DOp>");
+    OCIO_CHECK_EQUAL(optOps[1]->getInfo(), "<Lut1DOp>");
+    OCIO_CHECK_EQUAL(optOps[2]->getInfo(), "<Lut3DOp>");
+    OCIO_CHECK_EQUAL(optOps[3]->getInfo(), "<RangeOp>");
+    OCIO_CHECK_EQUAL(optOps[4]->getInfo(), "<FixedFunctionOp>");
+}
+
 OCIO_ADD_TEST(OpOptimizers, dynamic_ops)
 {
     // Non-identity matrix.
@@ -1229,6 +1445,113 @@ OCIO_ADD_TEST(OpOptimizers, multi_op_prefix)
     CompareRender(originalOps, optimizedOps, __LINE__, 5e-5f);
 }
 
+OCIO_ADD_TEST(OpOptimizers, cost_model_prefix)
+{
+    // The separable prefix is only replaced by a look-up if that is cheaper.
+
+    OCIO::OpRcPtrVec originalOps;
+
+    OCIO::LogOpDataRcPtr log = std::make_shared<OCIO::LogOpData>(2.0, OCIO::TRANSFORM_DIR_FORWARD);
+    OCIO_CHECK_NO_THROW(OCIO::CreateLogOp(originalOps, log, OCIO::TRANSFORM_DIR_FORWARD));
+    OCIO_REQUIRE_EQUAL(originalOps.size(), 1);
+
+    OCIO::OpRcPtrVec optimizedOps = originalOps.clone();
+    OCIO_CHECK_NO_THROW(OCIO::OptimizeOpVec(optimizedOps,
+                                            OCIO::BIT_DEPTH_UINT10,
+                                            OCIO::BIT_DEPTH_F32,
+                                            OCIO::OPTIMIZATION_DEFAULT));
+
+    OCIO_REQUIRE_EQUAL(optimizedOps.size(), 1U);
+    OCIO::ConstOpRcPtr o = optimizedOps[0];
+    OCIO_CHECK_EQUAL(o->data()->getType(), OCIO::OpData::Lut1DType);
+
+    // E.g. a computer where the log is very fast.
+    std::istringstream costs("Log 0.1\n");
+    OCIO_CHECK_NO_THROW(OCIO::LoadOpCostTable(costs));
+
+    optimizedOps = originalOps.clone();
+    OCIO_CHECK_NO_THROW(OCIO::OptimizeOpVec(optimizedOps,
+                                            OCIO::BIT_DEPTH_UINT10,
+                                            OCIO::BIT_DEPTH_F32,
+                                            OCIO::OPTIMIZATION_DEFAULT));
+    OCIO::ResetOpCostTable();
+
+    OCIO_REQUIRE_EQUAL(optimizedOps.size(), 1U);
+    o = optimizedOps[0];
+    OCIO_CHECK_EQUAL(o->data()->getType(), OCIO::OpData::LogType);
+}
+
+OCIO_ADD_TEST(OpOptimizers, default_cheap_prefix)
+{
+    // Without a cost table, a prefix of Matrix and Range ops is never replaced by a look-up.
+
+    OCIO::OpRcPtrVec originalOps;
+
+    OCIO::MatrixOpDataRcPtr matrix = std::make_shared<OCIO::MatrixOpData>();
+    matrix->setArrayValue(0, 2.);
+    OCIO_CHECK_NO_THROW(OCIO::CreateMatrixOp(originalOps, matrix, OCIO::TRANSFORM_DIR_FORWARD));
+
+    OCIO::RangeOpDataRcPtr range
+        = std::make_shared<OCIO::RangeOpData>(0., 1., -1000./65535., 66000./65535);
+    OCIO_CHECK_NO_THROW(OCIO::CreateRangeOp(originalOps, range, OCIO::TRANSFORM_DIR_FORWARD));
+
+    matrix = std::make_shared<OCIO::MatrixOpData>();
+    matrix->setArrayValue(5, 0.5);
+    OCIO_CHECK_NO_THROW(OCIO::CreateMatrixOp(originalOps, matrix, OCIO::TRANSFORM_DIR_FORWARD));
+    OCIO_REQUIRE_EQUAL(originalOps.size(), 3);
+
+    OCIO::ResetOpCostTable();
+    OCIO_CHECK_ASSERT(!OCIO::IsOpCostTableLoaded());
+
+    OCIO::OpRcPtrVec optimizedOps = originalOps.clone();
+    OCIO_CHECK_NO_THROW(OCIO::OptimizeOpVec(optimizedOps,
+                                            OCIO::BIT_DEPTH_UINT8,
+                                            OCIO::BIT_DEPTH_F32,
+                                            OCIO::OPTIMIZATION_DEFAULT));
+
+    // Even if the default costs would favor the look-up.
+    OCIO_CHECK_GT(OCIO::GetOpVecCost(originalOps), OCIO::GetOpCost(OCIO::OP_COST_LUT1D_LOOKUP));
+
+    OCIO_REQUIRE_EQUAL(optimizedOps.size(), 3U);
+    OCIO_CHECK_EQUAL(OCIO::ConstOpRcPtr(optimizedOps[0])->data()->getType(),
+                     OCIO::OpData::MatrixType);
+    OCIO_CHECK_EQUAL(OCIO::ConstOpRcPtr(optimizedOps[1])->data()->getType(),
+                     OCIO::OpData::RangeType);
+    OCIO_CHECK_EQUAL(OCIO::ConstOpRcPtr(optimizedOps[2])->data()->getType(),
+                     OCIO::OpData::MatrixType);
+}
+
+OCIO_ADD_TEST(OpOptimizers, cost_model_cheap_prefix)
+{
+    // A prefix of cheap ops is only replaced by a look-up if the look-up is even cheaper.
+
+    OCIO::OpRcPtrVec originalOps;
+
+    OCIO::MatrixOpDataRcPtr matrix = std::make_shared<OCIO::MatrixOpData>();
+    matrix->setArrayValue(0, 2.);
+    OCIO_CHECK_NO_THROW(OCIO::CreateMatrixOp(originalOps, matrix, OCIO::TRANSFORM_DIR_FORWARD));
+
+    OCIO::RangeOpDataRcPtr range
+        = std::make_shared<OCIO::RangeOpData>(0., 1., -1000./65535., 66000./65535);
+    OCIO_CHECK_NO_THROW(OCIO::CreateRangeOp(originalOps, range, OCIO::TRANSFORM_DIR_FORWARD));
+    OCIO_REQUIRE_EQUAL(originalOps.size(), 2);
+
+    // E.g. a computer where the look-up is very fast.
+    std::istringstream costs("Lut1DLookup 0.5\n");
+    OCIO_CHECK_NO_THROW(OCIO::LoadOpCostTable(costs));
+
+    OCIO::OpRcPtrVec optimizedOps = originalOps.clone();
+    OCIO_CHECK_NO_THROW(OCIO::OptimizeOpVec(optimizedOps,
+                                            OCIO::BIT_DEPTH_UINT8,
+                                            OCIO::BIT_DEPTH_F32,
+                                            OCIO::OPTIMIZATION_DEFAULT));
+    OCIO::ResetOpCostTable();
+
+    OCIO_REQUIRE_EQUAL(optimizedOps.size(), 1U);
+    OCIO_CHECK_EQUAL(OCIO::ConstOpRcPtr(optimizedOps[0])->data()->getType(),
+                     OCIO::OpData::Lut1DType);
+}
+
 OCIO_ADD_TEST(OpOptimizers, dyn_properties_prefix)
 {
     // Test prefix optimization of a complex transform.
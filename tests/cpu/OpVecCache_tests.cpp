@@ -0,0 +1,113 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+
+#include "OpVecCache.cpp"
+
+#include "testutils/UnitTest.h"
+
+namespace OCIO = OCIO_NAMESPACE;
+
+
+namespace
+{
+
+OCIO::TransformRcPtr CreateTransform(double gamma)
+{
+    OCIO::GroupTransformRcPtr group = OCIO::GroupTransform::Create();
+
+    OCIO::ExponentTransformRcPtr exp = OCIO::ExponentTransform::Create();
+    const double values[4] = { gamma, gamma, gamma, 1. };
+    exp->setValue(values);
+    group->appendTransform(exp);
+
+    OCIO::Lut3DTransformRcPtr lut = OCIO::Lut3DTransform::Create(17);
+    lut->setValue(16, 16, 16, 0.9f, 0.95f, 1.0f);
+    group->appendTransform(lut);
+
+    return group;
+}
+
+} // anon.
+
+OCIO_ADD_TEST(OpVecCache, processors)
+{
+    OCIO::ClearAllCaches();
+    OCIO_CHECK_EQUAL(OCIO::GetOpVecCacheSize(), 0);
+
+    OCIO::ConstConfigRcPtr config = OCIO::Config::Create();
+
+    // Two processors built separately from identical transforms share the optimized ops.
+
+    OCIO::ConstProcessorRcPtr proc1 = config->getProcessor(CreateTransform(2.2));
+    OCIO::ConstProcessorRcPtr proc2 = config->getProcessor(CreateTransform(2.2));
+
+    OCIO::ConstCPUProcessorRcPtr cpu1, cpu2;
+    OCIO_CHECK_NO_THROW(cpu1 = proc1->getDefaultCPUProcessor());
+    OCIO_CHECK_EQUAL(OCIO::GetOpVecCacheSize(), 1);
+    OCIO_CHECK_NO_THROW(cpu2 = proc2->getDefaultCPUProcessor());
+    OCIO_CHECK_EQUAL(OCIO::GetOpVecCacheSize(), 1);
+    OCIO_CHECK_EQUAL(std::string(cpu1->getCacheID()), std::string(cpu2->getCacheID()));
+
+    float pixel1[4] = { 0.5f, 0.4f, 0.3f, 1.0f };
+    float pixel2[4] = { 0.5f, 0.4f, 0.3f, 1.0f };
+    cpu1->applyRGBA(pixel1);
+    cpu2->applyRGBA(pixel2);
+    OCIO_CHECK_EQUAL(pixel1[0], pixel2[0]);
+    OCIO_CHECK_EQUAL(pixel1[1], pixel2[1]);
+    OCIO_CHECK_EQUAL(pixel1[2], pixel2[2]);
+
+    // The bit-depths, the optimization flags, the target and the ops are part of the key.
+
+    OCIO_CHECK_NO_THROW(proc2->getOptimizedCPUProcessor(OCIO::BIT_DEPTH_UINT8,
+                                                        OCIO::BIT_DEPTH_F32,
+                                                        OCIO::OPTIMIZATION_DEFAULT));
+    OCIO_CHECK_EQUAL(OCIO::GetOpVecCacheSize(), 2);
+
+    OCIO_CHECK_NO_THROW(proc2->getOptimizedCPUProcessor(OCIO::OPTIMIZATION_LOSSLESS));
+    OCIO_CHECK_EQUAL(OCIO::GetOpVecCacheSize(), 3);
+
+    OCIO_CHECK_NO_THROW(proc2->getDefaultGPUProcessor());
+    OCIO_CHECK_EQUAL(OCIO::GetOpVecCacheSize(), 4);
+
+    OCIO::ConstProcessorRcPtr proc3 = config->getProcessor(CreateTransform(2.4));
+    OCIO_CHECK_NO_THROW(proc3->getDefaultCPUProcessor());
+    OCIO_CHECK_EQUAL(OCIO::GetOpVecCacheSize(), 5);
+
+    OCIO::ClearAllCaches();
+    OCIO_CHECK_EQUAL(OCIO::GetOpVecCacheSize(), 0);
+
+    // Ops with dynamic properties are not cached.
+
+    OCIO::ExposureContrastTransformRcPtr ec = OCIO::ExposureContrastTransform::Create();
+    ec->setExposure(0.5);
+    ec->makeExposureDynamic();
+
+    OCIO::ConstProcessorRcPtr proc4 = config->getProcessor(ec);
+    OCIO::ConstCPUProcessorRcPtr cpu4;
+    OCIO_CHECK_NO_THROW(cpu4 = proc4->getDefaultCPUProcessor());
+    OCIO_CHECK_EQUAL(OCIO::GetOpVecCacheSize(), 0);
+    OCIO_CHECK_NO_THROW(cpu4->getDynamicProperty(OCIO::DYNAMIC_PROPERTY_EXPOSURE));
+}
+
+OCIO_ADD_TEST(OpVecCache, max_memory)
+{
+    OCIO::ClearAllCaches();
+
+    OCIO::ConstConfigRcPtr config = OCIO::Config::Create();
+
+    // A 17x17x17 3D LUT is bigger than 17*17*17*3*4 bytes.
+    const size_t prevMaxMemory = OCIO::SetOpVecCacheMaxMemory(2 * 17 * 17 * 17 * 3 * 4);
+
+    for (unsigned i = 0; i < 4; ++i)
+    {
+        OCIO::ConstProcessorRcPtr proc = config->getProcessor(CreateTransform(2.0 + 0.1 * i));
+        OCIO_CHECK_NO_THROW(proc->getDefaultCPUProcessor());
+    }
+    OCIO_CHECK_EQUAL(OCIO::GetOpVecCacheSize(), 1);
+
+    OCIO_CHECK_EQUAL(OCIO::SetOpVecCacheMaxMemory(0), 2 * 17 * 17 * 17 * 3 * 4);
+    OCIO_CHECK_EQUAL(OCIO::GetOpVecCacheSize(), 0);
+
+    OCIO::SetOpVecCacheMaxMemory(prevMaxMemory);
+}
@@ -2,12 +2,16 @@
 // Copyright Contributors to the OpenColorIO Project.
 
 
+#include <algorithm>
 #include <cstring>
+#include <fstream>
+#include <iterator>
 #include <set>
 
 #include "Platform.cpp"
 
 #include "testutils/UnitTest.h"
+#include "UnitTestUtils.h"
 
 namespace OCIO = OCIO_NAMESPACE;
 
@@ -132,3 +136,36 @@ OCIO_ADD_TEST(Platform, create_temp_filename)
     // Check that it only generates unique random strings.
     OCIO_CHECK_EQUAL(uids.size(), TestMax);
 }
+
+OCIO_ADD_TEST(Platform, list_directory)
+{
+    std::vector<std::string> names;
+    OCIO_CHECK_ASSERT(OCIO::Platform::ListDirectory(OCIO::getTestFilesDir(), names));
+    OCIO_CHECK_ASSERT(std::find(names.begin(), names.end(), "lut1d_1.spi1d") != names.end());
+    OCIO_CHECK_ASSERT(std::find(names.begin(), names.end(), ".") == names.end());
+    OCIO_CHECK_ASSERT(std::find(names.begin(), names.end(), "..") == names.end());
+
+    OCIO_CHECK_ASSERT(!OCIO::Platform::ListDirectory("/missing/directory", names));
+    OCIO_CHECK_ASSERT(names.empty());
+}
+
+OCIO_ADD_TEST(Platform, map_file)
+{
+    const std::string filepath = std::string(OCIO::getTestFilesDir()) + "/lut1d_1.spi1d";
+
+    const char * data = nullptr;
+    size_t size = 0;
+    OCIO_REQUIRE_ASSERT(OCIO::Platform::MapFile(filepath, data, size));
+
+    std::ifstream is(filepath.c_str(), std::ios_base::in | std::ios_base::binary);
+    const std::string content((std::istreambuf_iterator<char>(is)),
+                              std::istreambuf_iterator<char>());
+    OCIO_CHECK_EQUAL(size, content.size());
+    OCIO_CHECK_ASSERT(std::string(data, size) == content);
+
+    OCIO::Platform::UnmapFile(data, size);
+
+    OCIO_CHECK_ASSERT(!OCIO::Platform::MapFile("missing.file", data, size));
+    OCIO_CHECK_ASSERT(data == nullptr);
+    OCIO_CHECK_EQUAL(size, 0);
+}
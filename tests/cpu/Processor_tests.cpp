@@ -6,6 +6,7 @@
 
 #include "ops/exposurecontrast/ExposureContrastOp.h"
 #include "testutils/UnitTest.h"
+#include "UnitTestUtils.h"
 
 namespace OCIO = OCIO_NAMESPACE;
 
@@ -27,7 +28,7 @@ OCIO_ADD_TEST(Processor, basic)
     auto processorMat = config->getProcessor(mat);
     OCIO_CHECK_EQUAL(processorMat->getNumTransforms(), 1);
 
-    OCIO_CHECK_EQUAL(std::string(processorMat->getCacheID()), "$dff619808a13760b73a99db2e19a4dd2");
+    OCIO_CHECK_EQUAL(std::string(processorMat->getCacheID()), "$12eaeea90934fa4f259be1ded7c2b825");
 }
 
 OCIO_ADD_TEST(Processor, shared_dynamic_properties)
@@ -247,3 +248,102 @@ OCIO_ADD_TEST(Processor, channel_crosstalk)
                                              OCIO::BIT_DEPTH_F32,
                                              OCIO::OPTIMIZATION_DEFAULT)->hasChannelCrosstalk());
 }
+
+OCIO_ADD_TEST(Processor, incremental_rebuild)
+{
+    OCIO::ConfigRcPtr config = OCIO::Config::Create();
+    config->setMajorVersion(2);
+    OCIO::ConstContextRcPtr context = config->getCurrentContext();
+
+    OCIO::CDLTransformRcPtr cdl = OCIO::CDLTransform::Create();
+    const double slope[3] = { 1.1, 1.0, 0.9 };
+    cdl->setSlope(slope);
+
+    OCIO::GroupTransformRcPtr look = OCIO::GroupTransform::Create();
+    look->appendTransform(cdl);
+    look->appendTransform(OCIO::CreateFileTransform("lut3d_1.spi3d"));
+
+    OCIO::GroupTransformRcPtr group = OCIO::GroupTransform::Create();
+    group->appendTransform(OCIO::CreateFileTransform("lut1d_5.spi1d"));
+    group->appendTransform(look);
+
+    OCIO::ConstProcessorRcPtr proc1
+        = config->getProcessor(context, group, OCIO::TRANSFORM_DIR_FORWARD);
+    // The file transforms also add a file no-op.
+    OCIO_REQUIRE_EQUAL(proc1->getNumTransforms(), 5);
+
+    // Edit the CDL.
+
+    const double newSlope[3] = { 1.2, 1.0, 0.9 };
+    cdl->setSlope(newSlope);
+
+    OCIO::ConstProcessorRcPtr proc2;
+    OCIO_CHECK_NO_THROW(proc2 = config->getProcessor(proc1, context, group,
+                                                     OCIO::TRANSFORM_DIR_FORWARD));
+    OCIO_REQUIRE_EQUAL(proc2->getNumTransforms(), 5);
+
+    // The ops of the unchanged file transforms are shared with the previous processor.
+    // Note: The file no-ops are always created by a full rebuild while the LUT data comes
+    // from the file cache.
+    OCIO_CHECK_EQUAL(&proc1->getTransformFormatMetadata(0), &proc2->getTransformFormatMetadata(0));
+    OCIO_CHECK_NE(&proc1->getTransformFormatMetadata(2), &proc2->getTransformFormatMetadata(2));
+    OCIO_CHECK_EQUAL(&proc1->getTransformFormatMetadata(3), &proc2->getTransformFormatMetadata(3));
+
+    // The result is identical to a full rebuild.
+
+    OCIO::ConstProcessorRcPtr proc3 = config->getProcessor(context, group,
+                                                           OCIO::TRANSFORM_DIR_FORWARD);
+    OCIO_CHECK_EQUAL(std::string(proc2->getCacheID()), std::string(proc3->getCacheID()));
+    OCIO_CHECK_NE(&proc1->getTransformFormatMetadata(0), &proc3->getTransformFormatMetadata(0));
+    OCIO_CHECK_NE(std::string(proc1->getCacheID()), std::string(proc3->getCacheID()));
+
+    OCIO::ConstCPUProcessorRcPtr cpu1 = proc1->getDefaultCPUProcessor();
+    OCIO::ConstCPUProcessorRcPtr cpu2 = proc2->getDefaultCPUProcessor();
+    OCIO::ConstCPUProcessorRcPtr cpu3 = proc3->getDefaultCPUProcessor();
+
+    float pixel2[4] = { 0.5f, 0.4f, 0.3f, 1.0f };
+    float pixel3[4] = { 0.5f, 0.4f, 0.3f, 1.0f };
+    cpu2->applyRGBA(pixel2);
+    cpu3->applyRGBA(pixel3);
+    OCIO_CHECK_EQUAL(pixel2[0], pixel3[0]);
+    OCIO_CHECK_EQUAL(pixel2[1], pixel3[1]);
+    OCIO_CHECK_EQUAL(pixel2[2], pixel3[2]);
+
+    // The inverse direction reverses the order of the transforms.
+
+    OCIO::ConstProcessorRcPtr procInv;
+    OCIO_CHECK_NO_THROW(procInv = config->getProcessor(proc2, context, group,
+                                                       OCIO::TRANSFORM_DIR_INVERSE));
+    OCIO_REQUIRE_EQUAL(procInv->getNumTransforms(), 5);
+    OCIO_CHECK_EQUAL(std::string(procInv->getCacheID()),
+                     std::string(config->getProcessor(context, group,
+                                                      OCIO::TRANSFORM_DIR_INVERSE)->getCacheID()));
+
+    // Nothing is reused once the config is modified.
+
+    config->setDescription("Modified");
+
+    OCIO::ConstProcessorRcPtr proc4;
+    OCIO_CHECK_NO_THROW(proc4 = config->getProcessor(proc2, context, group,
+                                                     OCIO::TRANSFORM_DIR_FORWARD));
+    OCIO_REQUIRE_EQUAL(proc4->getNumTransforms(), 5);
+    OCIO_CHECK_NE(&proc2->getTransformFormatMetadata(0), &proc4->getTransformFormatMetadata(0));
+    OCIO_CHECK_EQUAL(std::string(proc2->getCacheID()), std::string(proc4->getCacheID()));
+
+    // Nor once the caches are cleared.
+
+    OCIO::ConstProcessorRcPtr proc5 = config->getProcessor(proc4, context, group,
+                                                           OCIO::TRANSFORM_DIR_FORWARD);
+    OCIO_CHECK_EQUAL(&proc4->getTransformFormatMetadata(0), &proc5->getTransformFormatMetadata(0));
+
+    OCIO::ClearAllCaches();
+
+    OCIO::ConstProcessorRcPtr proc6 = config->getProcessor(proc5, context, group,
+                                                           OCIO::TRANSFORM_DIR_FORWARD);
+    OCIO_CHECK_NE(&proc5->getTransformFormatMetadata(0), &proc6->getTransformFormatMetadata(0));
+
+    // A null previous processor is a full rebuild.
+
+    OCIO_CHECK_NO_THROW(config->getProcessor(OCIO::ConstProcessorRcPtr(), context, group,
+                                             OCIO::TRANSFORM_DIR_FORWARD));
+}
@@ -5926,7 +5926,7 @@ OCIO_ADD_TEST(FileFormatCTF, bake_1d)
 
     const std::string expectedCLF{
 R"(<?xml version="1.0" encoding="UTF-8"?>
-<ProcessList compCLFversion="3" id="$4dd1c89df8002b409e089089ce8f24e7">
+<ProcessList compCLFversion="3" id="$77e7c55bf17708096285db09de3473aa">
     <LUT1D inBitDepth="32f" outBitDepth="32f">
         <Array dim="2 3">
           0           0           0
@@ -5942,7 +5942,7 @@ R"(<?xml version="1.0" encoding="UTF-8"?>
     baker->setFormat(OCIO::FILEFORMAT_CTF);
     baker->bake(outputCTF);
     const std::string expectedCTF{ R"(<?xml version="1.0" encoding="UTF-8"?>
-<ProcessList version="1.3" id="$4dd1c89df8002b409e089089ce8f24e7">
+<ProcessList version="1.3" id="$77e7c55bf17708096285db09de3473aa">
     <LUT1D inBitDepth="32f" outBitDepth="32f">
         <Array dim="2 3">
           0           0           0
@@ -6139,7 +6139,7 @@ OCIO_ADD_TEST(FileFormatCTF, bake_1d_3d)
 
     const std::string expectedCLF{
 R"(<?xml version="1.0" encoding="UTF-8"?>
-<ProcessList compCLFversion="3" id="$4dd1c89df8002b409e089089ce8f24e7">
+<ProcessList compCLFversion="3" id="$77e7c55bf17708096285db09de3473aa">
     <Range inBitDepth="32f" outBitDepth="32f">
         <minInValue> -0.125 </minInValue>
         <maxInValue> 1.125 </maxInValue>
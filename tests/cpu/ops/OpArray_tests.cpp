@@ -0,0 +1,173 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+#include <atomic>
+#include <thread>
+
+#include "ops/OpArray.cpp"
+
+#include "ops/lut1d/Lut1DOpData.h"
+#include "ops/lut3d/Lut3DOpData.h"
+#include "testutils/UnitTest.h"
+
+namespace OCIO = OCIO_NAMESPACE;
+
+
+namespace
+{
+
+OCIO::Lut3DOpDataRcPtr CreateLut3D(float scale)
+{
+    OCIO::Lut3DOpDataRcPtr lut = std::make_shared<OCIO::Lut3DOpData>(17);
+    lut->getArray().scale(scale);
+    return lut;
+}
+
+} // anon.
+
+OCIO_ADD_TEST(OpArray, intern_luts)
+{
+    size_t numLuts = 0, numUsers = 0, memory = 0;
+    OCIO::GetSharedLutStats(numLuts, numUsers, memory);
+    const size_t prevNumLuts = numLuts;
+    const size_t prevNumUsers = numUsers;
+    const size_t prevMemory = memory;
+
+    const size_t lutMemory = 17 * 17 * 17 * 3 * sizeof(float);
+
+    {
+        // Two LUTs built separately from identical values share them once finalized.
+
+        OCIO::Lut3DOpDataRcPtr lut1 = CreateLut3D(0.5f);
+        OCIO::Lut3DOpDataRcPtr lut2 = CreateLut3D(0.5f);
+        OCIO::Lut3DOpDataRcPtr lut3 = CreateLut3D(0.25f);
+        OCIO_CHECK_ASSERT(!lut1->getArray().sharesValuesWith(lut2->getArray()));
+
+        OCIO_CHECK_NO_THROW(lut1->finalize());
+        OCIO_CHECK_NO_THROW(lut2->finalize());
+        OCIO_CHECK_NO_THROW(lut3->finalize());
+
+        OCIO_CHECK_ASSERT(lut1->getArray().sharesValuesWith(lut2->getArray()));
+        OCIO_CHECK_ASSERT(!lut1->getArray().sharesValuesWith(lut3->getArray()));
+
+        OCIO::GetSharedLutStats(numLuts, numUsers, memory);
+        OCIO_CHECK_EQUAL(numLuts, prevNumLuts + 2);
+        OCIO_CHECK_EQUAL(numUsers, prevNumUsers + 3);
+        OCIO_CHECK_EQUAL(memory, prevMemory + 2 * lutMemory);
+
+        // Finalizing again does not change anything.
+
+        OCIO_CHECK_NO_THROW(lut2->finalize());
+        OCIO::GetSharedLutStats(numLuts, numUsers, memory);
+        OCIO_CHECK_EQUAL(numLuts, prevNumLuts + 2);
+        OCIO_CHECK_EQUAL(numUsers, prevNumUsers + 3);
+
+        // Modifying a LUT detaches its values.
+
+        lut2->getArray().scale(2.0f);
+        OCIO_CHECK_ASSERT(!lut1->getArray().sharesValuesWith(lut2->getArray()));
+
+        OCIO::GetSharedLutStats(numLuts, numUsers, memory);
+        OCIO_CHECK_EQUAL(numLuts, prevNumLuts + 2);
+        OCIO_CHECK_EQUAL(numUsers, prevNumUsers + 2);
+        OCIO_CHECK_EQUAL(memory, prevMemory + 2 * lutMemory);
+
+        // Identical 1D LUTs are shared too.
+
+        OCIO::Lut1DOpDataRcPtr lut1D1 = std::make_shared<OCIO::Lut1DOpData>(1024);
+        OCIO::Lut1DOpDataRcPtr lut1D2 = std::make_shared<OCIO::Lut1DOpData>(1024);
+        OCIO_CHECK_NO_THROW(lut1D1->finalize());
+        OCIO_CHECK_NO_THROW(lut1D2->finalize());
+        OCIO_CHECK_ASSERT(lut1D1->getArray().sharesValuesWith(lut1D2->getArray()));
+    }
+
+    // The table does not keep the values alive.
+
+    OCIO::GetSharedLutStats(numLuts, numUsers, memory);
+    OCIO_CHECK_EQUAL(numLuts, prevNumLuts);
+    OCIO_CHECK_EQUAL(numUsers, prevNumUsers);
+    OCIO_CHECK_EQUAL(memory, prevMemory);
+}
+
+OCIO_ADD_TEST(OpArray, intern_hash_collision)
+{
+    // Arrays with the same hash but different values are not shared.
+
+    OCIO::Lut3DOpDataRcPtr lut = CreateLut3D(0.5f);
+    lut->getArray().updateContentHash();
+
+    const OCIO::Array & array = lut->getArray();
+    auto values = std::make_shared<OCIO::Array::Values>(array.getValues());
+    (*values)[0] = 1.0f;
+
+    // Fake a collision.
+    {
+        OCIO::AutoMutex lock(OCIO::g_internedArraysMutex);
+        OCIO::g_internedArrays.emplace(array.getContentHash(), values);
+    }
+
+    OCIO_CHECK_NO_THROW(lut->finalize());
+    OCIO_CHECK_NE(&array.getValues(), values.get());
+    OCIO_CHECK_EQUAL(array.getValues()[0], 0.0f);
+}
+
+OCIO_ADD_TEST(OpArray, intern_then_modify)
+{
+    // Modifying a finalized array never changes the values that could be interned, even if
+    // no other array shares them yet.
+
+    OCIO::Lut3DOpDataRcPtr lut = CreateLut3D(0.5f);
+    OCIO_CHECK_NO_THROW(lut->finalize());
+
+    const OCIO::Array & array = lut->getArray();
+    const OCIO::Array::Values * interned = &array.getValues();
+    lut->getArray()[0] = 1.0f;
+    OCIO_CHECK_NE(&array.getValues(), interned);
+
+    OCIO::Lut3DOpDataRcPtr lut2 = CreateLut3D(0.5f);
+    OCIO_CHECK_NO_THROW(lut2->finalize());
+    OCIO_CHECK_EQUAL(lut2->getArray().getValues()[0], 0.0f);
+}
+
+OCIO_ADD_TEST(OpArray, intern_while_modified)
+{
+    // One thread modifies its finalized arrays while another one interns identical arrays.
+
+    constexpr int numIterations = 200;
+
+    std::atomic<int> numErrors{ 0 };
+
+    std::thread modifier([&numErrors]()
+    {
+        for (int i = 0; i < numIterations; ++i)
+        {
+            OCIO::Lut3DOpDataRcPtr lut = CreateLut3D(0.5f);
+            lut->finalize();
+            lut->getArray().scale(2.0f);
+
+            if (lut->getArray().getValues().back() != 1.0f)
+            {
+                ++numErrors;
+            }
+        }
+    });
+
+    std::thread interner([&numErrors]()
+    {
+        for (int i = 0; i < numIterations; ++i)
+        {
+            OCIO::Lut3DOpDataRcPtr lut = CreateLut3D(0.5f);
+            lut->finalize();
+
+            if (lut->getArray().getValues().back() != 0.5f)
+            {
+                ++numErrors;
+            }
+        }
+    });
+
+    modifier.join();
+    interner.join();
+
+    OCIO_CHECK_EQUAL(numErrors.load(), 0);
+}
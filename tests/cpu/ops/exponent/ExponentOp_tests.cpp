@@ -85,6 +85,45 @@ OCIO_ADD_TEST(ExponentOp, value_limits)
     ValidateOp(source4, ops[0], result4, error);
 }
 
+OCIO_ADD_TEST(ExponentOp, math_accuracy)
+{
+    const double exp1[4] = { 2.4, 0.45, 1.8, 1. };
+
+    OCIO::OpRcPtrVec ops;
+    OCIO_CHECK_NO_THROW(OCIO::CreateExponentOp(ops, exp1, OCIO::TRANSFORM_DIR_FORWARD));
+    OCIO_REQUIRE_EQUAL(ops.size(), 1);
+
+    constexpr long numPixels = 256;
+    std::vector<float> input(numPixels * 4);
+    for (long idx = 0; idx < numPixels * 4; ++idx)
+    {
+        input[idx] = -0.5f + 4.0f * (float)idx / (float)(numPixels * 4 - 1);
+    }
+    input[0] = std::numeric_limits<float>::quiet_NaN();
+
+    std::vector<float> exact(input);
+    OCIO_CHECK_NO_THROW(ops[0]->finalize(OCIO::OPTIMIZATION_EXACT_MATH));
+    ops[0]->apply(exact.data(), numPixels);
+    OCIO_CHECK_EQUAL(exact[0], 0.0f);
+
+    // Only the preview accuracy differs from the standard library.
+    const std::pair<OCIO::OptimizationFlags, float> flags[]
+        = { { OCIO::OPTIMIZATION_DEFAULT, 0.0f }, { OCIO::OPTIMIZATION_DRAFT, 2e-3f } };
+
+    for (const auto & flag : flags)
+    {
+        std::vector<float> res(input);
+        OCIO_CHECK_NO_THROW(ops[0]->finalize(flag.first));
+        ops[0]->apply(res.data(), numPixels);
+
+        for (long idx = 0; idx < numPixels * 4; ++idx)
+        {
+            OCIO_CHECK_ASSERT(OCIO::EqualWithSafeRelError(res[idx], exact[idx],
+                                                          flag.second, 1.0f));
+        }
+    }
+}
+
 OCIO_ADD_TEST(ExponentOp, combining)
 {
     const float error = 1e-6f;
@@ -286,6 +325,35 @@ OCIO_ADD_TEST(ExponentOp, cache_id)
 
     OCIO_CHECK_EQUAL(opCacheID0, opCacheID2);
     OCIO_CHECK_NE(opCacheID0, opCacheID1);
+
+    // The math accuracy is part of the cacheID.
+    OCIO_CHECK_NO_THROW(ops[2]->finalize(OCIO::OPTIMIZATION_FAST_MATH_PREVIEW));
+    OCIO_CHECK_NE(opCacheID0, std::string(ops[2]->getCacheID()));
+}
+
+OCIO_ADD_TEST(ExponentOp, math_accuracy_equality)
+{
+    const double exp1[4] = { 2.0, 2.1, 3.0, 3.1 };
+
+    OCIO::OpRcPtrVec ops;
+    OCIO_CHECK_NO_THROW(OCIO::CreateExponentOp(ops, exp1, OCIO::TRANSFORM_DIR_FORWARD));
+    OCIO_CHECK_NO_THROW(OCIO::CreateExponentOp(ops, exp1, OCIO::TRANSFORM_DIR_FORWARD));
+    OCIO_REQUIRE_EQUAL(ops.size(), 2);
+
+    OCIO::ConstOpRcPtr op0 = ops[0];
+    OCIO::ConstOpRcPtr op1 = ops[1];
+    OCIO_CHECK_ASSERT(*op0->data() == *op1->data());
+    OCIO_CHECK_ASSERT(ops[0]->canCombineWith(op1));
+
+    // The ops using different math accuracies are neither combined nor identical.
+    OCIO_CHECK_NO_THROW(ops[1]->finalize(OCIO::OPTIMIZATION_FAST_MATH_PREVIEW));
+    OCIO_CHECK_ASSERT(!(*op0->data() == *op1->data()));
+    OCIO_CHECK_ASSERT(!ops[0]->canCombineWith(op1));
+
+    const double exp2[4] = { 2.0, 2.1, 3.0, 3.2 };
+    OCIO::ExponentOpData data1(exp1);
+    OCIO::ExponentOpData data2(exp2);
+    OCIO_CHECK_ASSERT(!(data1 == data2));
 }
 
 OCIO_ADD_TEST(ExponentOp, create_transform)
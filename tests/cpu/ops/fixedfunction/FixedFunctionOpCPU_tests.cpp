@@ -417,3 +417,62 @@ OCIO_ADD_TEST(FixedFunctionOpCPU, XYZ_TO_LUV)
     img = outputFrame;
     ApplyFixedFunction(&img[0], &inputFrame[0], 2, dataFInv, 1e-5f, __LINE__);
 }
+
+OCIO_ADD_TEST(FixedFunctionOpCPU, vectorized_matches_scalar)
+{
+    // The renderers process blocks of 4 pixels with SSE and the remaining pixels
+    // with the scalar code: processing an image in one call must give exactly the
+    // same result as processing it one pixel at a time.
+
+    const long num_samples = 43;
+
+    std::vector<float> input_32f(num_samples * 4);
+    for (long idx = 0; idx < num_samples * 4; ++idx)
+    {
+        const float val = float((idx * 37) % 101) / 50.f - 0.4f;
+        input_32f[idx] = (idx % 4 == 3) ? float(idx % 5) * 0.25f : val;
+    }
+    // Add some achromatic and zero pixels.
+    for (long ch = 0; ch < 3; ++ch)
+    {
+        input_32f[4 + ch]  = 0.f;
+        input_32f[8 + ch]  = 0.18f;
+        input_32f[12 + ch] = -0.5f;
+    }
+
+    for (int style = OCIO::FixedFunctionOpData::ACES_RED_MOD_03_FWD;
+         style <= OCIO::FixedFunctionOpData::LUV_TO_XYZ; ++style)
+    {
+        const OCIO::FixedFunctionOpData::Style s = OCIO::FixedFunctionOpData::Style(style);
+
+        OCIO::FixedFunctionOpData::Params params;
+        if (s == OCIO::FixedFunctionOpData::REC2100_SURROUND_FWD
+            || s == OCIO::FixedFunctionOpData::REC2100_SURROUND_INV)
+        {
+            params.push_back(0.78);
+        }
+
+        OCIO::ConstFixedFunctionOpDataRcPtr funcData
+            = std::make_shared<OCIO::FixedFunctionOpData>(params, s);
+
+        OCIO::ConstOpCPURcPtr op;
+        OCIO_CHECK_NO_THROW(op = OCIO::GetFixedFunctionCPURenderer(funcData));
+
+        std::vector<float> bulk(input_32f);
+        OCIO_CHECK_NO_THROW(op->apply(&bulk[0], &bulk[0], num_samples));
+
+        std::vector<float> single(input_32f);
+        for (long idx = 0; idx < num_samples; ++idx)
+        {
+            OCIO_CHECK_NO_THROW(op->apply(&single[idx * 4], &single[idx * 4], 1));
+        }
+
+        for (long idx = 0; idx < num_samples * 4; ++idx)
+        {
+            if (!(std::isnan(bulk[idx]) && std::isnan(single[idx])))
+            {
+                OCIO_CHECK_EQUAL(bulk[idx], single[idx]);
+            }
+        }
+    }
+}
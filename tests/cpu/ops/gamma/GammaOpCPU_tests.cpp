@@ -748,3 +748,58 @@ OCIO_ADD_TEST(GammaOpCPU, apply_moncurve_mirror_style_rev)
     ApplyGamma(ops[0], input_32f, expected_32f, numPixels, __LINE__, errorThreshold);
 }
 
+
+OCIO_ADD_TEST(GammaOpCPU, apply_moncurve_math_accuracy)
+{
+    // The accuracy of the pow evaluations is selected by the optimization flags.
+    constexpr long numPixels = 256;
+    std::vector<float> input(numPixels * 4);
+    for (long idx = 0; idx < numPixels * 4; ++idx)
+    {
+        input[idx] = -0.5f + 2.0f * (float)idx / (float)(numPixels * 4 - 1);
+    }
+
+    const OCIO::GammaOpData::Params redParams   = { 2.4, 0.055 };
+    const OCIO::GammaOpData::Params greenParams = { 2.2, 0.2 };
+    const OCIO::GammaOpData::Params blueParams  = { 1.8, 0.1 };
+    const OCIO::GammaOpData::Params alphaParams = { 1.0, 0.0 };
+
+    const OCIO::GammaOpData::Style styles[] = { OCIO::GammaOpData::MONCURVE_FWD,
+                                                OCIO::GammaOpData::MONCURVE_REV,
+                                                OCIO::GammaOpData::MONCURVE_MIRROR_FWD,
+                                                OCIO::GammaOpData::MONCURVE_MIRROR_REV };
+
+    for (const auto style : styles)
+    {
+        auto gammaData = std::make_shared<OCIO::GammaOpData>(style,
+                                                             redParams,
+                                                             greenParams,
+                                                             blueParams,
+                                                             alphaParams);
+        OCIO::OpRcPtrVec ops;
+        OCIO_CHECK_NO_THROW(OCIO::CreateGammaOp(ops, gammaData, OCIO::TRANSFORM_DIR_FORWARD));
+        OCIO_REQUIRE_EQUAL(ops.size(), 1);
+
+        std::vector<float> exact(input);
+        OCIO_CHECK_NO_THROW(ops[0]->finalize(OCIO::OPTIMIZATION_EXACT_MATH));
+        OCIO_CHECK_EQUAL(gammaData->getMathAccuracy(), OCIO::MATH_ACCURACY_EXACT);
+        ops[0]->apply(exact.data(), numPixels);
+
+        const std::pair<OCIO::OptimizationFlags, float> flags[]
+            = { { OCIO::OPTIMIZATION_DEFAULT, 5e-5f }, { OCIO::OPTIMIZATION_DRAFT, 2e-3f } };
+
+        for (const auto & flag : flags)
+        {
+            std::vector<float> res(input);
+            OCIO_CHECK_NO_THROW(ops[0]->finalize(flag.first));
+            ops[0]->apply(res.data(), numPixels);
+
+            for (long idx = 0; idx < numPixels * 4; ++idx)
+            {
+                OCIO_CHECK_ASSERT(OCIO::EqualWithSafeRelError(res[idx], exact[idx],
+                                                              flag.second, 1.0f));
+            }
+        }
+        OCIO_CHECK_EQUAL(gammaData->getMathAccuracy(), OCIO::MATH_ACCURACY_PREVIEW);
+    }
+}
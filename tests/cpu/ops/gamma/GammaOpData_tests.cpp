@@ -381,6 +381,10 @@ OCIO_ADD_TEST(GammaOpData, equality)
                          paramsR1, paramsG1, paramsB1, paramsA1);
 
     OCIO_CHECK_ASSERT(g4 == g1);
+
+    // The math accuracy changes the CPU evaluation.
+    g4.setMathAccuracy(OCIO::MATH_ACCURACY_PREVIEW);
+    OCIO_CHECK_ASSERT(!(g4 == g1));
 }
 
 namespace
@@ -501,6 +505,29 @@ void TestMayComposeStyle(OCIO::GammaOpData::Style s1, OCIO::GammaOpData::Style s
 }
 }
 
+OCIO_ADD_TEST(GammaOpData, math_accuracy)
+{
+    const OCIO::GammaOpData::Params params = { 2.4 };
+
+    OCIO::GammaOpData g1(OCIO::GammaOpData::BASIC_FWD, params, params, params, params);
+    OCIO::GammaOpDataRcPtr g2 = g1.inverse();
+    OCIO::GammaOpDataRcPtr g3 = g1.clone();
+
+    OCIO_CHECK_ASSERT(g1.isInverse(*g2));
+    OCIO_CHECK_ASSERT(g1.mayCompose(*g3));
+    OCIO_CHECK_NO_THROW(g1.finalize());
+    OCIO_CHECK_NO_THROW(g3->finalize());
+    OCIO_CHECK_EQUAL(g1.getCacheID(), g3->getCacheID());
+
+    // The ops using different math accuracies are neither inverses, composed nor identical.
+    g2->setMathAccuracy(OCIO::MATH_ACCURACY_EXACT);
+    g3->setMathAccuracy(OCIO::MATH_ACCURACY_EXACT);
+    OCIO_CHECK_ASSERT(!g1.isInverse(*g2));
+    OCIO_CHECK_ASSERT(!g1.mayCompose(*g3));
+    OCIO_CHECK_NO_THROW(g3->finalize());
+    OCIO_CHECK_NE(g1.getCacheID(), g3->getCacheID());
+}
+
 OCIO_ADD_TEST(GammaOpData, mayCompose)
 {
     TestMayComposeStyle(OCIO::GammaOpData::BASIC_FWD,
@@ -586,3 +586,43 @@ OCIO_ADD_TEST(LogOpCPU, cameralin2log_test)
     OCIO_CHECK_ASSERT(OCIO::IsNan(rgba[10]));
 }
 
+
+OCIO_ADD_TEST(LogOpCPU, math_accuracy)
+{
+    // Compare the HIGH and PREVIEW accuracies against the EXACT one.
+    constexpr long numPixels = 256;
+    std::vector<float> input(numPixels * 4);
+    for (long idx = 0; idx < numPixels * 4; ++idx)
+    {
+        input[idx] = -0.5f + 2.5f * (float)idx / (float)(numPixels * 4 - 1);
+    }
+
+    const OCIO::LogOpData::Params params{ 0.25, 0.6, 1.1, 0.05 };
+    OCIO::LogOpDataRcPtr lin2log = std::make_shared<OCIO::LogOpData>(
+        OCIO::TRANSFORM_DIR_FORWARD, 10.0, params, params, params);
+    OCIO::LogOpDataRcPtr log2lin = lin2log->inverse();
+
+    for (auto & log : { lin2log, log2lin })
+    {
+        std::vector<float> exact(numPixels * 4);
+        log->setMathAccuracy(OCIO::MATH_ACCURACY_EXACT);
+        OCIO::ConstLogOpDataRcPtr constLog = log;
+        OCIO::GetLogRenderer(constLog)->apply(input.data(), exact.data(), numPixels);
+
+        const std::pair<OCIO::MathAccuracy, float> accuracies[]
+            = { { OCIO::MATH_ACCURACY_HIGH, 2e-5f }, { OCIO::MATH_ACCURACY_PREVIEW, 5e-4f } };
+
+        for (const auto & accuracy : accuracies)
+        {
+            std::vector<float> res(numPixels * 4);
+            log->setMathAccuracy(accuracy.first);
+            OCIO::GetLogRenderer(constLog)->apply(input.data(), res.data(), numPixels);
+
+            for (long idx = 0; idx < numPixels * 4; ++idx)
+            {
+                OCIO_CHECK_ASSERT(OCIO::EqualWithSafeRelError(res[idx], exact[idx],
+                                                              accuracy.second, 1.0f));
+            }
+        }
+    }
+}
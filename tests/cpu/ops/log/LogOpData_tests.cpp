@@ -220,6 +220,33 @@ OCIO_ADD_TEST(LogOpData, log_inverse)
 
 }
 
+OCIO_ADD_TEST(LogOpData, math_accuracy)
+{
+    OCIO::LogOpData::Params params{ 1.5, 10.0, 1.1, 1.0 };
+
+    OCIO::LogOpData logOp0(OCIO::TRANSFORM_DIR_FORWARD, 10.0, params, params, params);
+    OCIO::LogOpDataRcPtr logOp1 = logOp0.clone();
+    OCIO::LogOpDataRcPtr invLogOp0 = logOp0.inverse();
+
+    OCIO_CHECK_ASSERT(logOp0 == *logOp1);
+    OCIO_CHECK_NO_THROW(logOp0.finalize());
+    OCIO_CHECK_NO_THROW(logOp1->finalize());
+    OCIO_CHECK_EQUAL(logOp0.getCacheID(), logOp1->getCacheID());
+
+    // The ops using different math accuracies are neither inverses nor identical.
+    logOp1->setMathAccuracy(OCIO::MATH_ACCURACY_PREVIEW);
+    invLogOp0->setMathAccuracy(OCIO::MATH_ACCURACY_PREVIEW);
+
+    OCIO_CHECK_ASSERT(!(logOp0 == *logOp1));
+    OCIO_CHECK_NO_THROW(logOp1->finalize());
+    OCIO_CHECK_NE(logOp0.getCacheID(), logOp1->getCacheID());
+
+    OCIO::ConstLogOpDataRcPtr constInvLogOp0 = invLogOp0;
+    OCIO_CHECK_ASSERT(!logOp0.isInverse(constInvLogOp0));
+    OCIO::ConstLogOpDataRcPtr constLogOp1 = logOp1;
+    OCIO_CHECK_ASSERT(constLogOp1->isInverse(constInvLogOp0));
+}
+
 OCIO_ADD_TEST(LogOpData, identity_replacement)
 {
     OCIO::LogOpData::Params paramsR{ 1.5, 10.0, 2.0, 1.0 };
@@ -2,8 +2,13 @@
 // Copyright Contributors to the OpenColorIO Project.
 
 
+#include <chrono>
+#include <random>
+
 #include "ops/lut1d/Lut1DOpCPU.cpp"
 
+#include "Logging.h"
+#include "ops/lut1d/Lut1DOp.h"
 #include "testutils/UnitTest.h"
 #include "UnitTestUtils.h"
 
@@ -2574,3 +2579,376 @@ OCIO_ADD_TEST(Lut1DRenderer, lut_1d_inv_half_domain_hue_adjust)
     }
 }
 
+
+OCIO_ADD_TEST(Lut1DRenderer, lut_1d_inv_search_index)
+{
+    // The search index must return exactly the same entry as std::lower_bound
+    // over the whole segment, including for flat spots and steep sections.
+    constexpr long dim = 4096;
+    std::vector<float> lut(dim);
+    for (long i = 0; i < dim; ++i)
+    {
+        const float x = (float)i / (float)(dim - 1);
+        lut[i] = (i > 1000 && i < 1500) ? 0.3f : std::pow(x, 4.f) * 3.f - 0.5f;
+    }
+    std::sort(lut.begin(), lut.end());
+
+    const float * start = lut.data();
+    const float * end = lut.data() + dim - 1;
+
+    OCIO::InvLutSearchIndex index;
+    index.build(start, end);
+
+    const float qnan = std::numeric_limits<float>::quiet_NaN();
+    std::vector<float> values{ *start, *end, 0.3f, qnan, -1.f, 5.f };
+    for (long i = 0; i < dim; ++i)
+    {
+        values.push_back(lut[i]);
+        values.push_back(OCIO::AddULP(lut[i], 1));
+        values.push_back(OCIO::AddULP(lut[i], -1));
+    }
+
+    for (const float val : values)
+    {
+        OCIO_CHECK_EQUAL(index.lowerBound(start, end, val) - start,
+                         std::lower_bound(start, end, val) - start);
+    }
+
+    // Small segments are not indexed but still searched correctly.
+    OCIO::InvLutSearchIndex smallIndex;
+    smallIndex.build(start, start + 10);
+    OCIO_CHECK_EQUAL(smallIndex.lowerBound(start, start + 10, lut[5]) - start,
+                     std::lower_bound(start, start + 10, lut[5]) - start);
+}
+
+OCIO_ADD_TEST(Lut1DRenderer, lut_1d_inv_large_exact)
+{
+    // The exact inverse of a large LUT must not depend on the search index.
+    constexpr unsigned long dim = 4096;
+    OCIO::Lut1DOpDataRcPtr lutData = std::make_shared<OCIO::Lut1DOpData>(dim);
+
+    OCIO::Array::Values & vals = lutData->getArray().getValues();
+    for (unsigned long i = 0; i < dim; ++i)
+    {
+        const float x = (float)i / (float)(dim - 1);
+        vals[i * 3 + 0] = std::pow(x, 1.f / 2.2f);
+        vals[i * 3 + 1] = 1.f - x * x;
+        vals[i * 3 + 2] = std::min(x * 1.5f, 0.9f);
+    }
+
+    auto invLut = lutData->inverse();
+    OCIO_CHECK_NO_THROW(invLut->finalize());
+    invLut->setInversionQuality(OCIO::LUT_INVERSION_EXACT);
+
+    OCIO::ConstLut1DOpDataRcPtr constInvLut = invLut;
+    OCIO::ConstOpCPURcPtr cpuOp;
+    OCIO_CHECK_NO_THROW(cpuOp = OCIO::GetLut1DRenderer(constInvLut,
+                                                       OCIO::BIT_DEPTH_F32,
+                                                       OCIO::BIT_DEPTH_F32));
+
+    constexpr long NB_PIXELS = 1024;
+    std::vector<float> inImage(NB_PIXELS * 4);
+    for (long i = 0; i < NB_PIXELS * 4; ++i)
+    {
+        inImage[i] = -0.1f + 1.2f * (float)i / (float)(NB_PIXELS * 4 - 1);
+    }
+    std::vector<float> outImage(NB_PIXELS * 4, -1.f);
+    cpuOp->apply(inImage.data(), outImage.data(), NB_PIXELS);
+
+    // Reference computed without any search index.
+    const OCIO::InvLutSearchIndex noIndex;
+    for (unsigned c = 0; c < 3; ++c)
+    {
+        const OCIO::Lut1DOpData::ComponentProperties & props
+            = c == 0 ? invLut->getRedProperties()
+                     : (c == 1 ? invLut->getGreenProperties() : invLut->getBlueProperties());
+
+        std::vector<float> tmpLut(dim);
+        for (unsigned long i = 0; i < dim; ++i)
+        {
+            tmpLut[i] = props.isIncreasing ? vals[i * 3 + c] : -vals[i * 3 + c];
+        }
+
+        OCIO::ComponentParams params;
+        OCIO::ComponentParams::setComponentParams(params, props, tmpLut.data(), 0.f);
+
+        for (long idx = 0; idx < NB_PIXELS; ++idx)
+        {
+            const float expected = OCIO::FindLutInv(params.lutStart,
+                                                    params.startOffset,
+                                                    params.lutEnd,
+                                                    noIndex,
+                                                    params.flipSign,
+                                                    1.f / (float)(dim - 1),
+                                                    inImage[idx * 4 + c]);
+            OCIO_CHECK_EQUAL(outImage[idx * 4 + c], expected);
+        }
+    }
+}
+
+OCIO_ADD_TEST(Lut1DRenderer, lut_1d_single_lut)
+{
+    // Only one LUT is stored when the three curves are identical.
+
+    OCIO::Lut1DOpDataRcPtr lut
+        = std::make_shared<OCIO::Lut1DOpData>(OCIO::Lut1DOpData::LUT_STANDARD, 1024);
+    lut->getArray().scale(0.5f);
+
+    OCIO::ConstLut1DOpDataRcPtr constLut = lut;
+
+    {
+        OCIO::ConstOpCPURcPtr cpuOp;
+        OCIO_CHECK_NO_THROW(cpuOp = OCIO::GetLut1DRenderer(constLut,
+                                                           OCIO::BIT_DEPTH_F32,
+                                                           OCIO::BIT_DEPTH_F32));
+        auto op = OCIO::DynamicPtrCast<const OCIO::BaseLut1DRenderer<OCIO::BIT_DEPTH_F32,
+                                                                     OCIO::BIT_DEPTH_F32>>(cpuOp);
+        OCIO_REQUIRE_ASSERT(op);
+        OCIO_CHECK_ASSERT(op->hasSingleLut());
+
+        float pixel[4] = { 0.2f, 0.4f, 1.0f, 1.0f };
+        cpuOp->apply(pixel, pixel, 1);
+        OCIO_CHECK_CLOSE(pixel[0], 0.1f, 1e-6f);
+        OCIO_CHECK_CLOSE(pixel[1], 0.2f, 1e-6f);
+        OCIO_CHECK_CLOSE(pixel[2], 0.5f, 1e-6f);
+        OCIO_CHECK_EQUAL(pixel[3], 1.0f);
+    }
+
+    {
+        OCIO::ConstOpCPURcPtr cpuOp;
+        OCIO_CHECK_NO_THROW(cpuOp = OCIO::GetLut1DRenderer(constLut,
+                                                           OCIO::BIT_DEPTH_UINT10,
+                                                           OCIO::BIT_DEPTH_UINT10));
+        auto op = OCIO::DynamicPtrCast<const OCIO::BaseLut1DRenderer<OCIO::BIT_DEPTH_UINT10,
+                                                                     OCIO::BIT_DEPTH_UINT10>>(cpuOp);
+        OCIO_REQUIRE_ASSERT(op);
+        OCIO_CHECK_ASSERT(op->isLookup());
+        OCIO_CHECK_ASSERT(op->hasSingleLut());
+
+        uint16_t pixel[4] = { 0, 200, 1023, 1023 };
+        cpuOp->apply(pixel, pixel, 1);
+        OCIO_CHECK_EQUAL(pixel[0], 0);
+        OCIO_CHECK_EQUAL(pixel[1], 100);
+        OCIO_CHECK_EQUAL(pixel[2], 512);
+        OCIO_CHECK_EQUAL(pixel[3], 1023);
+    }
+
+    // Different curves.
+
+    lut->getArray()[1] = 0.1f;
+
+    {
+        OCIO::ConstOpCPURcPtr cpuOp;
+        OCIO_CHECK_NO_THROW(cpuOp = OCIO::GetLut1DRenderer(constLut,
+                                                           OCIO::BIT_DEPTH_F32,
+                                                           OCIO::BIT_DEPTH_F32));
+        auto op = OCIO::DynamicPtrCast<const OCIO::BaseLut1DRenderer<OCIO::BIT_DEPTH_F32,
+                                                                     OCIO::BIT_DEPTH_F32>>(cpuOp);
+        OCIO_REQUIRE_ASSERT(op);
+        OCIO_CHECK_ASSERT(!op->hasSingleLut());
+    }
+}
+
+namespace
+{
+
+// Half domain LUT with smooth curves: a gamma for red, a scaled gamma for green and the
+// identity for blue.
+OCIO::Lut1DOpDataRcPtr CreateSmoothHalfLut(float gamma = 2.2f)
+{
+    OCIO::Lut1DOpDataRcPtr lut
+        = std::make_shared<OCIO::Lut1DOpData>(OCIO::Lut1DOpData::LUT_INPUT_HALF_CODE, 65536);
+
+    OCIO::Array::Values & values = lut->getArray().getValues();
+    for (unsigned code = 0; code < 65536; ++code)
+    {
+        half h;
+        h.setBits((unsigned short)code);
+        if (h.isFinite())
+        {
+            const float x = h;
+            const float y = std::copysign(std::pow(std::fabs(x), 1.0f / gamma), x);
+            values[code * 3 + 0] = y;
+            values[code * 3 + 1] = 2.0f * y;
+        }
+    }
+
+    return lut;
+}
+
+} // anon.
+
+OCIO_ADD_TEST(Lut1DRenderer, lut_1d_half_segmented)
+{
+    OCIO::Lut1DOpDataRcPtr lut = CreateSmoothHalfLut();
+    OCIO::ConstLut1DOpDataRcPtr constLut = lut;
+
+    // The approximation is not used unless allowed.
+
+    OCIO::ConstOpCPURcPtr cpuOp;
+    OCIO_CHECK_NO_THROW(cpuOp = OCIO::GetLut1DRenderer(constLut,
+                                                       OCIO::BIT_DEPTH_F32,
+                                                       OCIO::BIT_DEPTH_F32));
+    auto op = OCIO::DynamicPtrCast<const OCIO::Lut1DRendererHalfCode<OCIO::BIT_DEPTH_F32,
+                                                                     OCIO::BIT_DEPTH_F32>>(cpuOp);
+    OCIO_REQUIRE_ASSERT(op);
+    OCIO_CHECK_ASSERT(!op->isSegmented());
+
+    // Only a dedicated flag allows it, the default optimizations keep the exact LUT.
+
+    OCIO::OpRcPtrVec ops;
+    OCIO_CHECK_NO_THROW(OCIO::CreateLut1DOp(ops, lut, OCIO::TRANSFORM_DIR_FORWARD));
+    OCIO_CHECK_NO_THROW(ops.finalize(OCIO::OPTIMIZATION_DEFAULT));
+    OCIO_CHECK_ASSERT(!lut->isApproximationAllowed());
+    const std::string exactCacheID = ops[0]->getCacheID();
+
+    OCIO_CHECK_NO_THROW(ops.finalize(OCIO::OPTIMIZATION_GOOD));
+    OCIO_CHECK_ASSERT(!lut->isApproximationAllowed());
+
+    OCIO_CHECK_NO_THROW(ops.finalize(OCIO::OPTIMIZATION_LUT1D_APPROX));
+    OCIO_CHECK_ASSERT(lut->isApproximationAllowed());
+
+    // The approximated LUT neither shares the cacheID nor equals the exact one.
+    OCIO_CHECK_NE(ops[0]->getCacheID(), exactCacheID);
+    OCIO::Lut1DOpDataRcPtr exactLut = lut->clone();
+    exactLut->setApproximationAllowed(false);
+    OCIO_CHECK_ASSERT(!(*lut == *exactLut));
+
+    OCIO_CHECK_NO_THROW(cpuOp = OCIO::GetLut1DRenderer(constLut,
+                                                       OCIO::BIT_DEPTH_F32,
+                                                       OCIO::BIT_DEPTH_F32));
+    op = OCIO::DynamicPtrCast<const OCIO::Lut1DRendererHalfCode<OCIO::BIT_DEPTH_F32,
+                                                                OCIO::BIT_DEPTH_F32>>(cpuOp);
+    OCIO_REQUIRE_ASSERT(op);
+    OCIO_CHECK_ASSERT(op->isSegmented());
+
+    // The renderer using the complete LUTs.
+    OCIO::Lut1DRendererHalfCode<OCIO::BIT_DEPTH_F32, OCIO::BIT_DEPTH_F32>
+        refOp(constLut, OCIO::BIT_DEPTH_F32);
+    OCIO_CHECK_ASSERT(!refOp.isSegmented());
+
+    // All the half values, the values in between and special values.
+    std::vector<float> inImg;
+    for (unsigned code = 0; code < 65536; ++code)
+    {
+        half h0, h1;
+        h0.setBits((unsigned short)code);
+        h1.setBits((unsigned short)(code + 1));
+
+        const float x = h0;
+        const float midX = (h0.isFinite() && h1.isFinite()) ? 0.5f * (x + (float)h1) : x;
+        inImg.insert(inImg.end(), { x, midX, -midX, 1.0f });
+    }
+    const float qnan = std::numeric_limits<float>::quiet_NaN();
+    const float inf  = std::numeric_limits<float>::infinity();
+    inImg.insert(inImg.end(), { qnan, inf, -inf, 1.0f,
+                                65504.f, -65504.f, 1e10f, 0.0f,
+                                1e-10f, -1e-10f, 3e-8f, 0.0f });
+
+    const long numPixels = (long)inImg.size() / 4;
+
+    std::vector<float> outImg(inImg.size()), refImg(inImg.size());
+    cpuOp->apply(inImg.data(), outImg.data(), numPixels);
+    refOp.apply(inImg.data(), refImg.data(), numPixels);
+
+    for (size_t idx = 0; idx < outImg.size(); ++idx)
+    {
+        if (OCIO::IsNan(refImg[idx]))
+        {
+            OCIO_CHECK_ASSERT(OCIO::IsNan(outImg[idx]));
+        }
+        else if (std::isinf(refImg[idx]))
+        {
+            OCIO_CHECK_EQUAL(outImg[idx], refImg[idx]);
+        }
+        else
+        {
+            const float tol = 2e-5f * std::max(std::fabs(refImg[idx]), 1e-3f);
+            OCIO_CHECK_CLOSE_FROM(outImg[idx], refImg[idx], tol, idx);
+        }
+    }
+
+    // A LUT which is not smooth keeps its complete form.
+
+    for (unsigned code = 0; code < 65536; code += 7)
+    {
+        lut->getArray()[code * 3] *= (code % 2) ? 1.001f : 0.999f;
+    }
+
+    OCIO_CHECK_NO_THROW(cpuOp = OCIO::GetLut1DRenderer(constLut,
+                                                       OCIO::BIT_DEPTH_F32,
+                                                       OCIO::BIT_DEPTH_F32));
+    op = OCIO::DynamicPtrCast<const OCIO::Lut1DRendererHalfCode<OCIO::BIT_DEPTH_F32,
+                                                                OCIO::BIT_DEPTH_F32>>(cpuOp);
+    OCIO_REQUIRE_ASSERT(op);
+    OCIO_CHECK_ASSERT(!op->isSegmented());
+}
+
+OCIO_ADD_TEST(Lut1DRenderer, lut_1d_half_segmented_benchmark)
+{
+    // Compare a chain of half domain LUTs using the complete and the segmented LUTs.
+
+    typedef OCIO::Lut1DRendererHalfCode<OCIO::BIT_DEPTH_F32, OCIO::BIT_DEPTH_F32> Renderer;
+
+    std::vector<std::shared_ptr<Renderer>> segmentedOps, completeOps;
+    for (float gamma : { 2.2f, 1.0f / 2.4f, 1.8f, 1.0f / 1.6f })
+    {
+        OCIO::Lut1DOpDataRcPtr lut = CreateSmoothHalfLut(gamma);
+        lut->setApproximationAllowed(true);
+
+        OCIO::ConstLut1DOpDataRcPtr constLut = lut;
+        segmentedOps.push_back(std::make_shared<Renderer>(constLut));
+        OCIO_CHECK_ASSERT(segmentedOps.back()->isSegmented());
+
+        completeOps.push_back(std::make_shared<Renderer>(constLut, OCIO::BIT_DEPTH_F32));
+    }
+
+    constexpr long numPixels = 512 * 512;
+
+    // Scene-linear values spread over the half float range.
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<float> dist(-14.0f, 10.0f);
+
+    std::vector<float> inImg(numPixels * 4);
+    for (auto & value : inImg)
+    {
+        value = std::exp2(dist(gen));
+    }
+
+    std::vector<float> segmentedImg(inImg.size()), completeImg(inImg.size());
+
+    auto measure = [&inImg](const std::vector<std::shared_ptr<Renderer>> & ops,
+                            std::vector<float> & outImg)
+    {
+        constexpr unsigned iterations = 5;
+
+        const auto start = std::chrono::steady_clock::now();
+        for (unsigned i = 0; i < iterations; ++i)
+        {
+            outImg = inImg;
+            for (const auto & op : ops)
+            {
+                op->apply(outImg.data(), outImg.data(), numPixels);
+            }
+        }
+        const auto end = std::chrono::steady_clock::now();
+        return std::chrono::duration<double, std::milli>(end - start).count() / iterations;
+    };
+
+    const double completeTime  = measure(completeOps, completeImg);
+    const double segmentedTime = measure(segmentedOps, segmentedImg);
+
+    if (OCIO::GetLoggingLevel() >= OCIO::LOGGING_LEVEL_DEBUG)
+    {
+        std::ostringstream oss;
+        oss << "Chain of 4 half domain Lut1Ds on 512x512 pixels: complete LUTs "
+            << completeTime << " ms, segmented LUTs " << segmentedTime << " ms.";
+        OCIO::LogDebug(oss.str());
+    }
+
+    for (size_t idx = 0; idx < inImg.size(); ++idx)
+    {
+        const float tol = 1e-4f * std::max(std::fabs(completeImg[idx]), 1e-2f);
+        OCIO_CHECK_CLOSE_FROM(segmentedImg[idx], completeImg[idx], tol, idx);
+    }
+}
@@ -2,10 +2,15 @@
 // Copyright Contributors to the OpenColorIO Project.
 
 
+#include <chrono>
 #include <limits>
+#include <random>
+#include <sstream>
 
 #include "ops/lut3d/Lut3DOpCPU.cpp"
 
+#include "Logging.h"
+#include "ops/lut3d/Lut3DOp.h"
 #include "testutils/UnitTest.h"
 
 namespace OCIO = OCIO_NAMESPACE;
@@ -55,3 +60,298 @@ OCIO_ADD_TEST(Lut3DRenderer, nan_tetra_test)
     Lut3DRendererNaNTest(OCIO::INTERP_TETRAHEDRAL);
 }
 
+
+namespace
+{
+
+// Create a LUT which is linear except in the highlights, allowing the adaptive form.
+OCIO::Lut3DOpDataRcPtr CreateHighlightLut(OCIO::Interpolation interpol, unsigned long dim)
+{
+    OCIO::Lut3DOpDataRcPtr lut = std::make_shared<OCIO::Lut3DOpData>(interpol, dim);
+    lut->setApproximationTolerance(OCIO::LUT3D_APPROXIMATION_TOLERANCE);
+
+    float * values = &lut->getArray().getValues()[0];
+    for (unsigned long r = 0; r < dim; ++r)
+    {
+        for (unsigned long g = 0; g < dim; ++g)
+        {
+            for (unsigned long b = 0; b < dim; ++b)
+            {
+                const float in[3] = { (float)r / (float)(dim - 1),
+                                      (float)g / (float)(dim - 1),
+                                      (float)b / (float)(dim - 1) };
+                const float luma = 0.25f * in[0] + 0.5f * in[1] + 0.25f * in[2];
+                const float knee = std::max(luma - 0.75f, 0.0f);
+
+                const unsigned long idx = ((r * dim + g) * dim + b) * 3;
+                values[idx]     = 0.9f * in[0] + 0.1f * in[1] - 4.0f * knee * knee;
+                values[idx + 1] = 0.95f * in[1] + 0.05f * in[2] - 4.0f * knee * knee;
+                values[idx + 2] = in[2] - 2.0f * knee * knee * knee;
+            }
+        }
+    }
+
+    return lut;
+}
+
+void Lut3DAdaptiveTest(OCIO::Interpolation interpol)
+{
+    OCIO::ConstLut3DOpDataRcPtr lut = CreateHighlightLut(interpol, 65);
+
+    OCIO::ConstOpCPURcPtr renderer = OCIO::GetLut3DRenderer(lut);
+
+    typedef OCIO::Lut3DAdaptiveRenderer<true> TetraRenderer;
+    typedef OCIO::Lut3DAdaptiveRenderer<false> LinearRenderer;
+
+    size_t memory = 0;
+    if (interpol == OCIO::INTERP_TETRAHEDRAL)
+    {
+        auto adaptive = OCIO_DYNAMIC_POINTER_CAST<const TetraRenderer>(renderer);
+        OCIO_REQUIRE_ASSERT(adaptive);
+        memory = adaptive->getMemorySize();
+    }
+    else
+    {
+        auto adaptive = OCIO_DYNAMIC_POINTER_CAST<const LinearRenderer>(renderer);
+        OCIO_REQUIRE_ASSERT(adaptive);
+        memory = adaptive->getMemorySize();
+    }
+    OCIO_CHECK_LT(memory, 65 * 65 * 65 * 4 * sizeof(float) / 2);
+
+    OCIO::ConstOpCPURcPtr uniform;
+    if (interpol == OCIO::INTERP_TETRAHEDRAL)
+    {
+        uniform = std::make_shared<OCIO::Lut3DTetrahedralRenderer>(lut);
+    }
+    else
+    {
+        uniform = std::make_shared<OCIO::Lut3DRenderer>(lut);
+    }
+
+    // Compare both representations on (and between) the LUT entries.
+    const long numPixels = 97 * 97 * 97;
+    std::vector<float> pixels(numPixels * 4);
+    for (long i = 0; i < numPixels; ++i)
+    {
+        pixels[4 * i]     = (float)(i / (97 * 97)) / 96.0f;
+        pixels[4 * i + 1] = (float)((i / 97) % 97) / 96.0f;
+        pixels[4 * i + 2] = (float)(i % 97) / 96.0f;
+        pixels[4 * i + 3] = 0.5f;
+    }
+
+    std::vector<float> adaptiveRes(pixels.size());
+    std::vector<float> uniformRes(pixels.size());
+    renderer->apply(pixels.data(), adaptiveRes.data(), numPixels);
+    uniform->apply(pixels.data(), uniformRes.data(), numPixels);
+
+    for (size_t i = 0; i < pixels.size(); ++i)
+    {
+        OCIO_CHECK_CLOSE(adaptiveRes[i], uniformRes[i], 5e-5f);
+    }
+}
+
+// Measure the max relative error (with an absolute floor of 1) between the adaptive and the
+// uniform representations on random inputs, i.e. mostly between the LUT entries.
+float Lut3DAdaptiveRandomError(OCIO::ConstLut3DOpDataRcPtr & lut)
+{
+    OCIO::ConstOpCPURcPtr renderer = OCIO::GetLut3DRenderer(lut);
+
+    OCIO::ConstOpCPURcPtr uniform;
+    if (lut->getConcreteInterpolation() == OCIO::INTERP_TETRAHEDRAL)
+    {
+        OCIO_CHECK_ASSERT(
+            OCIO_DYNAMIC_POINTER_CAST<const OCIO::Lut3DAdaptiveRenderer<true>>(renderer));
+        uniform = std::make_shared<OCIO::Lut3DTetrahedralRenderer>(lut);
+    }
+    else
+    {
+        OCIO_CHECK_ASSERT(
+            OCIO_DYNAMIC_POINTER_CAST<const OCIO::Lut3DAdaptiveRenderer<false>>(renderer));
+        uniform = std::make_shared<OCIO::Lut3DRenderer>(lut);
+    }
+
+    constexpr long numPixels = 256 * 1024;
+
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<float> dist(0.0f, 1.0f);
+
+    std::vector<float> pixels(numPixels * 4);
+    for (auto & value : pixels)
+    {
+        value = dist(gen);
+    }
+
+    std::vector<float> adaptiveRes(pixels.size());
+    std::vector<float> uniformRes(pixels.size());
+    renderer->apply(pixels.data(), adaptiveRes.data(), numPixels);
+    uniform->apply(pixels.data(), uniformRes.data(), numPixels);
+
+    float maxError = 0.0f;
+    for (size_t i = 0; i < pixels.size(); ++i)
+    {
+        const float error = std::fabs(adaptiveRes[i] - uniformRes[i])
+                            / std::max(std::fabs(uniformRes[i]), 1.0f);
+        maxError = std::max(maxError, error);
+    }
+
+    return maxError;
+}
+
+} // anon.
+
+OCIO_ADD_TEST(Lut3DRenderer, adaptive_linear_test)
+{
+    Lut3DAdaptiveTest(OCIO::INTERP_LINEAR);
+}
+
+OCIO_ADD_TEST(Lut3DRenderer, adaptive_tetra_test)
+{
+    Lut3DAdaptiveTest(OCIO::INTERP_TETRAHEDRAL);
+}
+
+OCIO_ADD_TEST(Lut3DRenderer, adaptive_random_error)
+{
+    // The tolerance is only enforced on the LUT entries so measure the error between them.
+
+    for (const auto interpol : { OCIO::INTERP_LINEAR, OCIO::INTERP_TETRAHEDRAL })
+    {
+        OCIO::ConstLut3DOpDataRcPtr lut = CreateHighlightLut(interpol, 65);
+
+        const float error = Lut3DAdaptiveRandomError(lut);
+        OCIO_CHECK_LE(error, 2.0f * OCIO::LUT3D_APPROXIMATION_TOLERANCE);
+    }
+
+    // A larger tolerance also keeps the error between the entries of the same order.
+    for (const auto interpol : { OCIO::INTERP_LINEAR, OCIO::INTERP_TETRAHEDRAL })
+    {
+        OCIO::Lut3DOpDataRcPtr lut = CreateHighlightLut(interpol, 65);
+        lut->setApproximationTolerance(1e-3f);
+
+        OCIO::ConstLut3DOpDataRcPtr lutConst = lut;
+        const float error = Lut3DAdaptiveRandomError(lutConst);
+        OCIO_CHECK_LE(error, 2e-3f);
+    }
+}
+
+OCIO_ADD_TEST(Lut3DRenderer, adaptive_fallback)
+{
+    // Too small.
+    {
+        OCIO::ConstLut3DOpDataRcPtr lut = CreateHighlightLut(OCIO::INTERP_TETRAHEDRAL, 17);
+        OCIO::ConstOpCPURcPtr renderer = OCIO::GetLut3DRenderer(lut);
+        OCIO_CHECK_ASSERT(OCIO_DYNAMIC_POINTER_CAST<const OCIO::Lut3DTetrahedralRenderer>(renderer));
+    }
+
+    // Not a multiple of the block size.
+    {
+        OCIO::ConstLut3DOpDataRcPtr lut = CreateHighlightLut(OCIO::INTERP_TETRAHEDRAL, 64);
+        OCIO::ConstOpCPURcPtr renderer = OCIO::GetLut3DRenderer(lut);
+        OCIO_CHECK_ASSERT(OCIO_DYNAMIC_POINTER_CAST<const OCIO::Lut3DTetrahedralRenderer>(renderer));
+    }
+
+    // Noise everywhere.
+    {
+        OCIO::Lut3DOpDataRcPtr lut = CreateHighlightLut(OCIO::INTERP_LINEAR, 33);
+        OCIO::Array::Values & values = lut->getArray().getValues();
+        for (size_t i = 0; i < values.size(); ++i)
+        {
+            values[i] += (i % 7) * 0.001f;
+        }
+
+        OCIO::ConstLut3DOpDataRcPtr lutConst = lut;
+        OCIO::ConstOpCPURcPtr renderer = OCIO::GetLut3DRenderer(lutConst);
+        OCIO_CHECK_ASSERT(OCIO_DYNAMIC_POINTER_CAST<const OCIO::Lut3DRenderer>(renderer));
+
+        // Unless the tolerance is larger than the noise.
+        lut->setApproximationTolerance(0.1f);
+        renderer = OCIO::GetLut3DRenderer(lutConst);
+        OCIO_CHECK_ASSERT(
+            OCIO_DYNAMIC_POINTER_CAST<const OCIO::Lut3DAdaptiveRenderer<false>>(renderer));
+    }
+
+    // Not allowed.
+    {
+        OCIO::Lut3DOpDataRcPtr lut = CreateHighlightLut(OCIO::INTERP_TETRAHEDRAL, 65);
+        lut->setApproximationTolerance(0.0f);
+
+        OCIO::ConstLut3DOpDataRcPtr lutConst = lut;
+        OCIO::ConstOpCPURcPtr renderer = OCIO::GetLut3DRenderer(lutConst);
+        OCIO_CHECK_ASSERT(OCIO_DYNAMIC_POINTER_CAST<const OCIO::Lut3DTetrahedralRenderer>(renderer));
+    }
+}
+
+OCIO_ADD_TEST(Lut3DRenderer, adaptive_optimization_flags)
+{
+    // Only OPTIMIZATION_LUT3D_APPROX allows the adaptive form.
+
+    OCIO::Lut3DOpDataRcPtr lut = CreateHighlightLut(OCIO::INTERP_TETRAHEDRAL, 65);
+
+    OCIO::OpRcPtrVec ops;
+    OCIO_CHECK_NO_THROW(OCIO::CreateLut3DOp(ops, lut, OCIO::TRANSFORM_DIR_FORWARD));
+
+    OCIO_CHECK_NO_THROW(ops.finalize(OCIO::OPTIMIZATION_DEFAULT));
+    OCIO_CHECK_EQUAL(lut->getApproximationTolerance(), 0.0f);
+    OCIO_CHECK_ASSERT(OCIO_DYNAMIC_POINTER_CAST<const OCIO::Lut3DTetrahedralRenderer>(
+        OCIO::ConstOpRcPtr(ops[0])->getCPUOp()));
+
+    OCIO_CHECK_NO_THROW(ops.finalize(OCIO::OPTIMIZATION_GOOD));
+    OCIO_CHECK_EQUAL(lut->getApproximationTolerance(), 0.0f);
+    OCIO_CHECK_ASSERT(OCIO_DYNAMIC_POINTER_CAST<const OCIO::Lut3DTetrahedralRenderer>(
+        OCIO::ConstOpRcPtr(ops[0])->getCPUOp()));
+
+    const std::string exactID = ops[0]->getCacheID();
+    OCIO::Lut3DOpDataRcPtr exactLut = lut->clone();
+
+    OCIO_CHECK_NO_THROW(ops.finalize(OCIO::OPTIMIZATION_LUT3D_APPROX));
+    OCIO_CHECK_EQUAL(lut->getApproximationTolerance(), OCIO::LUT3D_APPROXIMATION_TOLERANCE);
+    OCIO_CHECK_ASSERT(OCIO_DYNAMIC_POINTER_CAST<const OCIO::Lut3DAdaptiveRenderer<true>>(
+        OCIO::ConstOpRcPtr(ops[0])->getCPUOp()));
+
+    // The approximation is not the same op.
+    OCIO_CHECK_NE(ops[0]->getCacheID(), exactID);
+    OCIO_CHECK_ASSERT(!(*lut == *exactLut));
+}
+
+OCIO_ADD_TEST(Lut3DRenderer, adaptive_benchmark)
+{
+    OCIO::ConstLut3DOpDataRcPtr lut = CreateHighlightLut(OCIO::INTERP_TETRAHEDRAL, 65);
+
+    OCIO::ConstOpCPURcPtr adaptive = OCIO::GetLut3DRenderer(lut);
+    OCIO::ConstOpCPURcPtr uniform = std::make_shared<OCIO::Lut3DTetrahedralRenderer>(lut);
+
+    const long numPixels = 1024 * 1024;
+    std::vector<float> pixels(numPixels * 4);
+    for (long i = 0; i < numPixels; ++i)
+    {
+        // Pseudo-random pixels to defeat the cache locality.
+        pixels[4 * i]     = (float)((i * 7919) % 1021) / 1020.0f;
+        pixels[4 * i + 1] = (float)((i * 104729) % 1019) / 1018.0f;
+        pixels[4 * i + 2] = (float)((i * 1299709) % 1013) / 1012.0f;
+        pixels[4 * i + 3] = 1.0f;
+    }
+    std::vector<float> res(pixels.size());
+
+    // Warm up.
+    uniform->apply(pixels.data(), res.data(), numPixels);
+    adaptive->apply(pixels.data(), res.data(), numPixels);
+
+    const auto start = std::chrono::high_resolution_clock::now();
+    adaptive->apply(pixels.data(), res.data(), numPixels);
+    const auto middle = std::chrono::high_resolution_clock::now();
+    uniform->apply(pixels.data(), res.data(), numPixels);
+    const auto end = std::chrono::high_resolution_clock::now();
+
+    if (OCIO::GetLoggingLevel() >= OCIO::LOGGING_LEVEL_DEBUG)
+    {
+        const auto adaptiveRenderer
+            = OCIO_DYNAMIC_POINTER_CAST<const OCIO::Lut3DAdaptiveRenderer<true>>(adaptive);
+
+        std::ostringstream oss;
+        oss << "Adaptive 3D LUT: "
+            << (adaptiveRenderer ? adaptiveRenderer->getMemorySize() : 0) << " bytes in "
+            << std::chrono::duration<double, std::milli>(middle - start).count()
+            << " ms, uniform 3D LUT: " << 65 * 65 * 65 * 4 * sizeof(float) << " bytes in "
+            << std::chrono::duration<double, std::milli>(end - middle).count() << " ms.";
+        OCIO::LogDebug(oss.str());
+    }
+}
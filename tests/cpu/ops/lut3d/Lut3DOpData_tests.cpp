@@ -4,6 +4,8 @@
 
 #include "ops/lut3d/Lut3DOpData.cpp"
 
+#include "ops/lut3d/Lut3DOpCPU.h"
+
 #include "testutils/UnitTest.h"
 #include "UnitTestUtils.h"
 
@@ -103,6 +105,113 @@ OCIO_ADD_TEST(Lut3DOpData, equality)
     OCIO_CHECK_ASSERT(*l4 == *l5);
 }
 
+OCIO_ADD_TEST(Lut3DOpData, content_hash)
+{
+    OCIO::Lut3DOpDataRcPtr l1 = std::make_shared<OCIO::Lut3DOpData>(OCIO::INTERP_LINEAR, 33);
+    l1->getArray()[0] = 0.5f;
+    OCIO::Lut3DOpDataRcPtr l2 = l1->clone();
+
+    // The hash is computed by the finalization.
+    OCIO_CHECK_ASSERT(l1->getArray().getContentHash().empty());
+    OCIO_CHECK_NO_THROW(l1->finalize());
+    OCIO_CHECK_NO_THROW(l2->finalize());
+    OCIO_CHECK_ASSERT(!l1->getArray().getContentHash().empty());
+    OCIO_CHECK_EQUAL(l1->getArray().getContentHash(), l2->getArray().getContentHash());
+    OCIO_CHECK_ASSERT(*l1 == *l2);
+
+    // A copy keeps the hash.
+    OCIO::Lut3DOpDataRcPtr l3 = l1->clone();
+    OCIO_CHECK_EQUAL(l3->getArray().getContentHash(), l1->getArray().getContentHash());
+
+    // Any non-const access to the values resets the hash.
+    l2->getArray()[1] = 0.25f;
+    OCIO_CHECK_ASSERT(l2->getArray().getContentHash().empty());
+    OCIO_CHECK_ASSERT(!(*l1 == *l2));
+
+    OCIO_CHECK_NO_THROW(l2->finalize());
+    OCIO_CHECK_NE(l1->getArray().getContentHash(), l2->getArray().getContentHash());
+    OCIO_CHECK_ASSERT(!(*l1 == *l2));
+
+    l3->getArray().getValues();
+    OCIO_CHECK_ASSERT(l3->getArray().getContentHash().empty());
+    l3->getArray().scale(2.0f);
+    l3->getArray().scale(0.5f);
+    OCIO_CHECK_NO_THROW(l3->finalize());
+    OCIO_CHECK_EQUAL(l3->getArray().getContentHash(), l1->getArray().getContentHash());
+    OCIO_CHECK_ASSERT(*l1 == *l3);
+
+    // The finalized inverse LUT has the same hash.
+    OCIO::ConstLut3DOpDataRcPtr cl1 = l1;
+    OCIO::Lut3DOpDataRcPtr inv = l1->inverse();
+    OCIO_CHECK_NO_THROW(inv->finalize());
+    OCIO_CHECK_EQUAL(inv->getArray().getContentHash(), l1->getArray().getContentHash());
+    OCIO::ConstLut3DOpDataRcPtr cinv = inv;
+    OCIO_CHECK_ASSERT(cl1->isInverse(cinv));
+
+    OCIO::ConstLut3DOpDataRcPtr cl2 = l2;
+    OCIO_CHECK_ASSERT(!cl2->isInverse(cinv));
+
+    // The values modified through a reference obtained before the finalization are hashed
+    // again by the next finalization.
+    OCIO::Lut3DOpDataRcPtr l6 = std::make_shared<OCIO::Lut3DOpData>(OCIO::INTERP_LINEAR, 5);
+    OCIO::Array::Values & values = l6->getArray().getValues();
+    values[0] = 0.0625f;
+    OCIO_CHECK_NO_THROW(l6->finalize());
+    const std::string hash = l6->getArray().getContentHash();
+    const std::string cacheID = l6->getCacheID();
+
+    values[0] = 0.125f;
+    OCIO_CHECK_NO_THROW(l6->finalize());
+    OCIO_CHECK_NE(l6->getArray().getContentHash(), hash);
+    OCIO_CHECK_NE(l6->getCacheID(), cacheID);
+}
+
+OCIO_ADD_TEST(Lut3DOpData, copy_on_write)
+{
+    OCIO::Lut3DOpDataRcPtr l1 = std::make_shared<OCIO::Lut3DOpData>(OCIO::INTERP_LINEAR, 33);
+    l1->getArray()[0] = 0.5f;
+
+    // The values of an array which is not finalized are copied.
+    OCIO::Lut3DOpDataRcPtr l2 = l1->clone();
+    OCIO_CHECK_ASSERT(!l2->getArray().sharesValuesWith(l1->getArray()));
+
+    // The values of a finalized array are shared.
+    OCIO_CHECK_NO_THROW(l1->finalize());
+    l2 = l1->clone();
+    OCIO_CHECK_ASSERT(l2->getArray().sharesValuesWith(l1->getArray()));
+
+    OCIO::Lut3DOpDataRcPtr inv = l1->inverse();
+    OCIO_CHECK_ASSERT(inv->getArray().sharesValuesWith(l1->getArray()));
+
+    // Finalizing again, creating a renderer or reading the values keep the values shared.
+    OCIO_CHECK_NO_THROW(l2->finalize());
+    OCIO::ConstLut3DOpDataRcPtr cl2 = l2;
+    OCIO_CHECK_NO_THROW(OCIO::GetLut3DRenderer(cl2));
+    OCIO_CHECK_EQUAL(cl2->getArray()[0], 0.5f);
+    OCIO_CHECK_EQUAL(cl2->getArray().getValues()[0], 0.5f);
+    OCIO_CHECK_ASSERT(l2->getArray().sharesValuesWith(l1->getArray()));
+
+    // Any non-const access makes a copy first.
+    OCIO::ConstLut3DOpDataRcPtr cl1 = l1;
+    OCIO::ConstLut3DOpDataRcPtr cinv = inv;
+
+    l2->getArray()[0] = 0.25f;
+    OCIO_CHECK_ASSERT(!l2->getArray().sharesValuesWith(l1->getArray()));
+    OCIO_CHECK_ASSERT(inv->getArray().sharesValuesWith(l1->getArray()));
+    OCIO_CHECK_EQUAL(cl1->getArray()[0], 0.5f);
+    OCIO_CHECK_EQUAL(cl2->getArray()[0], 0.25f);
+    OCIO_CHECK_ASSERT(!l1->getArray().getContentHash().empty());
+
+    inv->getArray().scale(2.0f);
+    OCIO_CHECK_EQUAL(cl1->getArray()[0], 0.5f);
+    OCIO_CHECK_EQUAL(cinv->getArray()[0], 1.0f);
+
+    // The last owner of the values does not need a copy.
+    const float * values = l1->getArray().getValues().data();
+    l1->getArray()[1] = 0.125f;
+    OCIO_CHECK_EQUAL(l1->getArray().getValues().data(), values);
+}
+
 OCIO_ADD_TEST(Lut3DOpData, interpolation)
 {
     OCIO::Lut3DOpData l(2);
@@ -298,3 +298,140 @@ OCIO_ADD_TEST(FileTransform, validate)
     tr->setSrc("");
     OCIO_CHECK_THROW(tr->validate(), OCIO::Exception);
 }
+
+OCIO_ADD_TEST(FileTransform, file_cache)
+{
+    OCIO::ClearAllCaches();
+
+    size_t numFiles = 1, memory = 1, numHits = 1, numMisses = 1;
+    OCIO::GetFileCacheStats(numFiles, memory, numHits, numMisses);
+    OCIO_CHECK_EQUAL(numFiles, 0);
+    OCIO_CHECK_EQUAL(memory, 0);
+    OCIO_CHECK_EQUAL(numHits, 0);
+    OCIO_CHECK_EQUAL(numMisses, 0);
+
+    const std::string lut1DPath(std::string(OCIO::getTestFilesDir()) + "/lut1d_1.spi1d");
+    const std::string lut3DPath(std::string(OCIO::getTestFilesDir()) + "/lut3d_1.spi3d");
+
+    OCIO::FileFormat * format = nullptr;
+    OCIO::CachedFileRcPtr cachedFile;
+    OCIO_CHECK_NO_THROW(OCIO::GetCachedFileAndFormat(format, cachedFile, lut1DPath));
+    OCIO_REQUIRE_ASSERT(cachedFile);
+
+    // The 1D LUT has 512 RGB entries.
+    OCIO_CHECK_ASSERT(cachedFile->getMemorySize() >= 512 * 3 * sizeof(float));
+
+    OCIO::CachedFileRcPtr cachedFile2;
+    OCIO_CHECK_NO_THROW(OCIO::GetCachedFileAndFormat(format, cachedFile2, lut1DPath));
+    OCIO_CHECK_EQUAL(cachedFile, cachedFile2);
+
+    OCIO_CHECK_NO_THROW(OCIO::GetCachedFileAndFormat(format, cachedFile2, lut3DPath));
+
+    // The load errors are cached too.
+    const std::string missingPath(std::string(OCIO::getTestFilesDir()) + "/missing.spi1d");
+    OCIO_CHECK_THROW(OCIO::GetCachedFileAndFormat(format, cachedFile2, missingPath),
+                     OCIO::Exception);
+    OCIO_CHECK_THROW(OCIO::GetCachedFileAndFormat(format, cachedFile2, missingPath),
+                     OCIO::Exception);
+
+    OCIO::GetFileCacheStats(numFiles, memory, numHits, numMisses);
+    OCIO_CHECK_EQUAL(numFiles, 3);
+    OCIO_CHECK_ASSERT(memory > cachedFile->getMemorySize() + cachedFile2->getMemorySize());
+    OCIO_CHECK_EQUAL(numHits, 2);
+    OCIO_CHECK_EQUAL(numMisses, 3);
+
+    // Evict by path: the file is read again.
+    OCIO::ClearCachesForFile(lut1DPath.c_str());
+    OCIO::GetFileCacheStats(numFiles, memory, numHits, numMisses);
+    OCIO_CHECK_EQUAL(numFiles, 2);
+
+    OCIO_CHECK_NO_THROW(OCIO::GetCachedFileAndFormat(format, cachedFile2, lut1DPath));
+    OCIO_CHECK_NE(cachedFile, cachedFile2);
+    OCIO::GetFileCacheStats(numFiles, memory, numHits, numMisses);
+    OCIO_CHECK_EQUAL(numFiles, 3);
+    OCIO_CHECK_EQUAL(numMisses, 4);
+
+    // Unknown files are ignored.
+    OCIO_CHECK_NO_THROW(OCIO::ClearCachesForFile("unknown.spi1d"));
+    OCIO_CHECK_NO_THROW(OCIO::ClearCachesForFile(nullptr));
+
+    // Lowering the memory limit evicts the files.
+    const size_t prevMaxMemory = OCIO::SetFileCacheMaxMemory(0);
+    OCIO::GetFileCacheStats(numFiles, memory, numHits, numMisses);
+    OCIO_CHECK_EQUAL(numFiles, 0);
+    OCIO_CHECK_EQUAL(memory, 0);
+
+    // The file being inserted is never evicted, even if it does not fit in the memory limit,
+    // but it is evicted by the next insertion.
+    OCIO_CHECK_NO_THROW(OCIO::GetCachedFileAndFormat(format, cachedFile2, lut1DPath));
+    OCIO_CHECK_ASSERT(cachedFile2);
+    OCIO::GetFileCacheStats(numFiles, memory, numHits, numMisses);
+    OCIO_CHECK_EQUAL(numFiles, 1);
+    OCIO_CHECK_ASSERT(memory > cachedFile2->getMemorySize());
+
+    OCIO_CHECK_NO_THROW(OCIO::GetCachedFileAndFormat(format, cachedFile2, lut3DPath));
+    OCIO::GetFileCacheStats(numFiles, memory, numHits, numMisses);
+    OCIO_CHECK_EQUAL(numFiles, 1);
+
+    const size_t prevNumHits = numHits;
+    OCIO_CHECK_NO_THROW(OCIO::GetCachedFileAndFormat(format, cachedFile2, lut3DPath));
+    OCIO::GetFileCacheStats(numFiles, memory, numHits, numMisses);
+    OCIO_CHECK_EQUAL(numHits, prevNumHits + 1);
+
+    OCIO_CHECK_EQUAL(OCIO::SetFileCacheMaxMemory(prevMaxMemory), 0);
+    OCIO_CHECK_EQUAL(prevMaxMemory, 1024 * 1024 * 1024);
+
+    OCIO::ClearAllCaches();
+    OCIO::GetFileCacheStats(numFiles, memory, numHits, numMisses);
+    OCIO_CHECK_EQUAL(numFiles, 0);
+    OCIO_CHECK_EQUAL(numHits, 0);
+    OCIO_CHECK_EQUAL(numMisses, 0);
+}
+
+OCIO_ADD_TEST(FileTransform, file_cache_lru)
+{
+    // The least recently used files of a shard are evicted first, except the kept one, and
+    // the memory limit applies to all the shards.
+
+    OCIO::ClearAllCaches();
+    const size_t prevMaxMemory = OCIO::SetFileCacheMaxMemory(250);
+
+    OCIO::FileCacheShard shard;
+    for (const char * path : { "a", "b", "c", "d" })
+    {
+        OCIO::FileCacheEntry & entry = shard.m_entries[path];
+        entry.m_memory = 100;
+        shard.m_lru.push_front(path);
+        entry.m_lruPos = shard.m_lru.begin();
+        shard.m_memory += entry.m_memory;
+    }
+    OCIO::g_fileCacheMemory += shard.m_memory;
+
+    // Use "b" then "a".
+    shard.m_lru.splice(shard.m_lru.begin(), shard.m_lru, shard.m_entries["b"].m_lruPos);
+    shard.m_lru.splice(shard.m_lru.begin(), shard.m_lru, shard.m_entries["a"].m_lruPos);
+
+    // "c" is the least recently used file but it is kept.
+    OCIO::EvictShardFiles(shard, "c");
+    OCIO_CHECK_EQUAL(shard.m_memory, 200);
+    OCIO_CHECK_EQUAL(OCIO::g_fileCacheMemory.load(), 200);
+    OCIO_CHECK_EQUAL(shard.m_entries.size(), 2);
+    OCIO_CHECK_EQUAL(shard.m_entries.count("c"), 1);
+    OCIO_CHECK_EQUAL(shard.m_entries.count("a"), 1);
+    OCIO_CHECK_EQUAL(shard.m_lru.back(), "c");
+
+    // The files of the other shards count too.
+    OCIO::g_fileCacheMemory += 100;
+    OCIO::EvictShardFiles(shard, std::string());
+    OCIO_CHECK_EQUAL(shard.m_memory, 100);
+    OCIO_CHECK_EQUAL(OCIO::g_fileCacheMemory.load(), 200);
+    OCIO_CHECK_EQUAL(shard.m_lru.size(), 1);
+    OCIO_CHECK_EQUAL(shard.m_lru.front(), "a");
+
+    OCIO::EraseFile(shard, shard.m_entries.find("a"));
+    OCIO_CHECK_EQUAL(shard.m_memory, 0);
+    OCIO_CHECK_EQUAL(OCIO::g_fileCacheMemory.load(), 100);
+
+    OCIO::g_fileCacheMemory -= 100;
+    OCIO::SetFileCacheMaxMemory(prevMaxMemory);
+}